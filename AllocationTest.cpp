@@ -0,0 +1,112 @@
+//AllocationTest.cpp
+//
+//Purpose: Test that the parameter-block (Param_Data) paths price without heap allocation. The global operator new is replaced by a counting one, and:
+//           - the steady-state scalar loop (Black-Scholes prices and Greeks, divided differences, perpetual American prices, and the cached prices and Greeks of
+//             a EuropeanOption whose spot moves) must perform no allocation at all;
+//           - each Matrix evaluation must perform exactly one allocation, that of the result vector it returns, whatever the number of mesh points.
+//         Returns 0 on success, 1 on failure.
+//
+//         Usage: allocation_test [iterations]
+//         Defaults: 100000 iterations
+//
+//Modification date: 10/18/2026
+
+
+#include "BSExactPricingEngine.hpp"
+#include "DividedDifferences.hpp"
+#include "AmericanOption.hpp"
+#include "EuropeanOption.hpp"
+#include "Matrix.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+
+// Counting replacements of the global allocation functions. Every other form of operator new (arrays, nothrow) is defined by the library in terms of these.
+static std::atomic<std::size_t> g_allocations(0);
+
+void* operator new(std::size_t size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    void* p = std::malloc(size > 0 ? size : 1);
+    if(p == nullptr){throw std::bad_alloc();}
+    return p;
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+
+static bool Check(const std::string& name, const std::size_t& allocations, const std::size_t& expected)
+{
+    std::cout << name << ": " << allocations << " allocations, expected " << expected << (allocations == expected ? "" : "  <-- FAILED") << std::endl;
+    return allocations == expected;
+}
+
+
+int main(int argc, char* argv[])
+{
+    const std::size_t iterations = (argc > 1) ? static_cast<std::size_t>(std::atol(argv[1])) : 100000;
+    bool ok = true;
+
+    // Steady-state scalar loop
+    EuropeanOption option(60.0, 65.0, 0.25, 0.08, 0.30, Option_Type::Call, Exercise_Type::Spot);
+    AmericanOption american;
+    volatile double sink = 0.0;     // Keeps the results alive
+
+    std::size_t before = g_allocations.load();
+    for(std::size_t i = 0; i < iterations; i++)
+    {
+        option.setS(50.0 + static_cast<double>(i % 200) * 0.1);     // Invalidates the cache, so that every iteration reprices
+        Param_Data params = option.params();
+        params.m_h = 0.01;
+
+        double total = BSExactPricingEngine::Call_Price_BS(params) + BSExactPricingEngine::Put_Price_BS(params);
+        total += BSExactPricingEngine::Call_Delta_BS(params) + BSExactPricingEngine::Put_Delta_BS(params) + BSExactPricingEngine::Gamma_BS(params);
+        total += BSExactPricingEngine::Vega_BS(params) + BSExactPricingEngine::Call_Theta_BS(params) + BSExactPricingEngine::Put_Theta_BS(params);
+        total += BSExactPricingEngine::Greeks_BS(params).m_vanna;
+        total += DividedDifferences::Delta_Call_DividedDiff(params) + DividedDifferences::Delta_Put_DividedDiff(params) + DividedDifferences::Gamma_DividedDiff(params);
+
+        Param_Data perpetual = american.params();
+        perpetual.m_S = params.m_S;
+        total += AmericanOption::Price_Call_American_Perp(perpetual) + AmericanOption::Price_Put_American_Perp(perpetual);
+
+        total += option.Price_BS() + option.Delta_BS() + option.Gamma_BS() + option.Vega_BS() + option.Theta_BS();
+        sink = sink + total;
+    }
+    ok = Check("Scalar loop, " + std::to_string(iterations) + " iterations", g_allocations.load() - before, 0) && ok;
+
+    // Matrix evaluations: one allocation each, the result vector, independent of the mesh size
+    Param_Data base = option.params();
+    base.m_h = 0.01;
+    for(std::size_t points = 10; points <= 10000; points *= 10)
+    {
+        Matrix spot_mesh(base, 10.0, 10.0 + static_cast<double>(points - 1) * 0.1, 0.1, Param_Type::S, Base_Type::European);
+        Matrix h_mesh(base, 0.001, 0.001 + static_cast<double>(points - 1) * 0.001, 0.001, Param_Type::h, Base_Type::European);
+        Matrix american_mesh(american.params(), 10.0, 10.0 + static_cast<double>(points - 1) * 0.1, 0.1, Param_Type::S, Base_Type::American);
+
+        const std::size_t calls = 20;
+        before = g_allocations.load();
+        for(std::size_t c = 0; c < calls; c++)
+        {
+            sink = sink + spot_mesh.MatrixPricer_BS(Option_Type::Call, Exercise_Type::Spot).back();
+            sink = sink + spot_mesh.Matrix_Gamma_BS(Option_Type::Call, Exercise_Type::Spot).back();
+            sink = sink + h_mesh.Matrix_Delta_DividedDiff(Option_Type::Put, Exercise_Type::Spot).back();
+            sink = sink + h_mesh.Matrix_Gamma_DividedDiff(Exercise_Type::Spot).back();
+            sink = sink + american_mesh.Matrix_Pricer_Perp(Option_Type::Put, Exercise_Type::Spot).back();
+        }
+        ok = Check("Matrix evaluations, " + std::to_string(spot_mesh.getMatrixData().size()) + " points", g_allocations.load() - before, 5 * calls) && ok;
+    }
+
+    std::cout << (ok ? "PASSED" : "FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -1,92 +1,430 @@
-//AmericanOption.hpp
-//
-//Purpose: Defining American option instances, with appropriate data members, and pricing functionalities.
-//
-//Modification date: 1/20/2023
-
-    
-#ifndef AmericanOption_hpp			// Header guards to prevent multiple definitions of same class
-#define AmericanOption_hpp
-    
-#include "BSExactPricingEngine.hpp"	// BSExactPricingEngine 
-#include "OptionData.hpp"   		// Header file for struct holding option data, for encapsulation
-#include <vector>					// Vector library
-#include <sstream>					// For os stream/ << operator overloading
-#include <cmath>    				// For pow() function
-#include <cstdlib>  				// For rand() function
-#include <iostream>	
-#include <string>	
-
-
-class AmericanOption
-{
-    private:
-        OptionData option_data;	// Private struct holding data members for American options (S,K,R,Sig,B)
-
-    public:
-    //CONSTRUCTORS AND DESTRUCTOR (canonical header file principles)
-
-        AmericanOption();                                               // Default constructor
-        AmericanOption(const double& newS, const double& newK, const double& newR, const double& newSig, const double& newB,const Option_Type& new_optiontype, const Exercise_Type& new_exercise); // Overloaded constructor with provided option parameters
-        AmericanOption(const AmericanOption& source);                   // Copy constructor
-        ~AmericanOption();                                              // Destructor
-        AmericanOption& operator = (const AmericanOption& source);      // Assignment operator
-
-    // MEMBER FUNCTIONS:
-
-        void Init();                                // Rather than tediously list initialize values, we create an Init() function to facilitate default initialization
-        void Copy(const AmericanOption& source);    // Rather than tediously implement copying option data members, we centralize this effort with one function doing so. It makes code cleaner.   
-            
-        std::string print_OptionType() const;       // Print whether it is a call or put
-        std::string print_ExerciseType() const;     // Print whether it is a spot option or a future
-        std::string ToString() const;               // Printing out all information on the option at hand 
-
-        void toggle_optiontype();                   //  Toggle function to switch option types: call or put
-        void toggle_exercisetype();                 //  Toggle exercise types: spot option or future, taking into consideration the changes in value for B.
-
-        void set_OptionType(const Option_Type& source_optiontype);			// Setter function for option type: call or put
-        void set_ExerciseType(const Exercise_Type& source_exercisetype);	// Setter function for exercise type: spot or future
-
-        std::vector<double> vector_data() const;    // Vector to store data members efficiently, and be abe to pass them as arguments in functions rather than give individual data members
-
-    //GETTERS
-        double const& getS() const;         // Getter function for asset's price
-        double const& getK() const;         // Getter function for strike price of asset at hand
-        double const& getR() const;         // Getter function for interest rate
-        double const& getSig() const;       // Getter function for volatility of asset at hand
-        double const& getB() const;         // Getter function for cost of carry
-        int const& getID() const;           // Getter ID function      
-
-    //SETTERS:
-
-        void setS(const double& newS);       // Setter function for underlying price of asset at hand
-        void setK(const double& newK);       // Setter function for strike price of asset at hand
-        void setR(const double& newR);       // Setter function for interest rate
-        void setSig(const double& newSig);   // Setter function for volatility of asset at hand
-		void setB(const double& newB);		 //Setter function for cost of carry at hand
-        //void setAll(const double& ... );   // After careful thought, I believe it does not make sense to have such a function. It would be better to simply create a new instance if deemed appropriate.
-
-
-    // Exact formula for a perpetual american option
-
-
-		// Formulae for pricing perpetual american call and put options. I would have created a new pricing engine just for american options, but deemed it 
-		// unnecessary for the purpose of this exercise, given it only required only defining two functions
-        double Price_American_Perp() const;	  // General pricing function to call, which will call either Price_Call_American_Perp() or Price_Put_American_Perp as a function of the option type. Had I
-		// created header and source files for the Pricing of perpetual american options, Price_American_Perp() would have remained in this class, and Price_Call_American_Perp() and Price_Put_American_Perp()
-		// would have been called into that PricingEngine file.
-
-
-		// Call exact pricing formulae for American option
-		double Price_Call_American_Perp(const double&S, const double&K, const double&R, const double&Sig, const double&B ) const;	//Taking S,K,R,Sig,B as arguments
-		static double Price_Call_American_Perp(std::vector<double>& source_params);	// Taking vector as argument. Static in order to be able to call function before having an instance being created
-
-		// Put exact pricing formulae for American option
-		double Price_Put_American_Perp(const double&S, const double&K, const double&R, const double&Sig, const double&B ) const;	//Taking S,K,R,Sig,B as arguments
-		static double Price_Put_American_Perp(std::vector<double>& source_params);	// Taking vector as argument. Static in order to be able to call function before having an instance being created
-};
-
-std::ostream& operator << (std::ostream &os, const AmericanOption& source);
-
-#endif //AmericanOption_hpp
-
+//BSExactPricingEngine.cpp
+// The design pattern was inspired by Mark Joshi's "C++ Design Patterns and Derivatives Pricing"
+//
+//Purpose: Black-Scholes pricing engine for the computing of: exact prices for calls and puts, and computing of greeks: delta, gamma, vega, theta, and the
+//         higher-order vanna, volga, charm, speed and color.
+//
+//Modification date: 1/15/2023
+
+
+#include "BSExactPricingEngine.hpp"
+#include "PricingKernels.hpp"   // BS_Kernel<double>, which holds the formulae: the functions below are out-of-line wrappers over it
+#include <cmath>        // For exp(), log(), sqrt(), erfc()
+#include <algorithm>    // For std::min(), std::max()
+#include <stdexcept>
+
+
+// Default constructor
+BSExactPricingEngine::BSExactPricingEngine():PricingEngine()     //Including PricingEngine base class part
+{
+    //std::cout << "Default constructor in BSExactPricingEngine used." << std::endl;
+}
+
+// Destructor
+BSExactPricingEngine::~BSExactPricingEngine()
+{
+    //std::cout << "Destructor in BSExactPricingEngine used." << std::endl;
+}
+
+
+// D1 and D2 arguments, and normal distribution functions
+
+double BSExactPricingEngine::D1(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B)
+{
+    // D1 = ( ln(S/K) + (B + Sig^2/2)T ) / ( Sig*sqrt(T) )
+    return BS_Kernel<double>::D1(S,K,T,Sig,B);
+}
+
+double BSExactPricingEngine::D2(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B)
+{
+    // D2 = D1 - Sig*sqrt(T)
+    return BS_Kernel<double>::D2(D1(S,K,T,R,Sig,B), Sig*sqrt(T));
+}
+
+double BSExactPricingEngine::N(const double& x)
+{
+    // CDF of the standard normal distribution, using the complementary error function
+    return BS_Kernel<double>::N(x);
+}
+
+double BSExactPricingEngine::n(const double& x)
+{
+    // PDF of the standard normal distribution
+    return BS_Kernel<double>::n(x);
+}
+
+double BSExactPricingEngine::Inverse_N(const double& p)
+{
+    if(!(p > 0.0 && p < 1.0)){throw std::invalid_argument("Error: inverse normal CDF requires a probability in (0,1).");}
+    return BS_Kernel<double>::Inverse_N(p);
+}
+
+
+// IMPLIED VOLATILITY
+
+double BSExactPricingEngine::Implied_Vol_BS(const Option_Type& optiontype, const double& price, const double& S, const double& K, const double& T, const double& R,
+    const double& B)
+{
+    // No-arbitrage bounds: the discounted intrinsic value of the forward below, the discounted forward (call) or strike (put) above
+    const double DF_R = exp(-R*T), F = S*exp(B*T);
+    const double lower = (optiontype == Option_Type::Call) ? std::max(DF_R*(F - K), 0.0) : std::max(DF_R*(K - F), 0.0);
+    const double upper = (optiontype == Option_Type::Call) ? DF_R*F : DF_R*K;
+    if(!(T > 0.0) || !(price >= lower) || !(price < upper)){throw std::invalid_argument("Error: price outside the no-arbitrage bounds of the implied volatility.");}
+    if(price == lower){return 0.0;}
+
+    const bool call = (optiontype == Option_Type::Call);
+    auto price_at = [&](const double& Sig){return call ? BS_Kernel<double>::Call_Price(S, K, T, R, Sig, B) : BS_Kernel<double>::Put_Price(S, K, T, R, Sig, B);};
+
+    const double tolerance = 1e-12*(1.0 + price);
+    double low = 0.0, high = 1.0;       // Bracket of the root: the price is increasing in Sig
+    while(price_at(high) < price)
+    {
+        low = high;
+        high *= 2.0;
+        if(high > 1e3){throw std::invalid_argument("Error: implied volatility beyond 1000%.");}
+    }
+
+    // Initial guess of Manaster and Koehler, which makes Newton's iterations monotone in most cases
+    double Sig = std::min(std::max(sqrt(2.0*std::fabs(log(F/K))/T), 0.1), high);
+    for(int iteration = 0; iteration < 100; iteration++)
+    {
+        const double difference = price_at(Sig) - price;
+        if(std::fabs(difference) < tolerance){return Sig;}
+        if(difference > 0.0){high = Sig;} else {low = Sig;}
+
+        const double vega = BS_Kernel<double>::Vega(S, K, T, R, Sig, B);
+        double next = Sig - difference/vega;
+        if(!(next > low && next < high)){next = 0.5*(low + high);}     // Bisection when Newton leaves the bracket, or when the vega vanishes
+        if(high - low < 1e-15*high){return next;}
+        Sig = next;
+    }
+    return Sig;
+}
+
+double BSExactPricingEngine::Implied_Vol_BS(const Option_Type& optiontype, const double& price, const Param_Data& source_params)
+{
+    return Implied_Vol_BS(optiontype, price, source_params.m_S, source_params.m_K, source_params.m_T, source_params.m_R, source_params.m_B);
+}
+
+void BSExactPricingEngine::Implied_Vol_BS_Batch(const Option_Type& optiontype, const std::vector<double>& prices, const std::vector<Param_Data>& source_params,
+    std::vector<double>& results)
+{
+    if(prices.size() != source_params.size()){throw std::invalid_argument("Error: Batch vectors are not of the same size.");}
+    results.resize(prices.size());
+    for(std::size_t i = 0; i < prices.size(); i++)
+    {
+        results[i] = Implied_Vol_BS(optiontype, prices[i], source_params[i]);
+    }
+}
+
+
+// PRICES
+
+double BSExactPricingEngine::Call_Price_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B)
+{
+    // C = S*exp((B-R)T)*N(d1) - K*exp(-RT)*N(d2)
+    return BS_Kernel<double>::Call_Price(S,K,T,R,Sig,B);
+}
+
+double BSExactPricingEngine::Call_Price_BS(const std::vector<double>& source_params)
+{
+    //Vector of parameter data goes as such:
+    //source_params[0]  = S variable
+    //source_params[1]  = K variable
+    //source_params[2]  = T variable
+    //source_params[3]  = R variable
+    //source_params[4]  = Sig variable
+    //source_params[5]  = B variable
+    return Call_Price_BS(source_params[0], source_params[1], source_params[2], source_params[3], source_params[4], source_params[5]);
+}
+
+double BSExactPricingEngine::Call_Price_BS(const Param_Data& source_params)
+{
+    return Call_Price_BS(source_params.m_S, source_params.m_K, source_params.m_T, source_params.m_R, source_params.m_Sig, source_params.m_B);
+}
+
+double BSExactPricingEngine::Put_Price_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B)
+{
+    // P = K*exp(-RT)*N(-d2) - S*exp((B-R)T)*N(-d1)
+    return BS_Kernel<double>::Put_Price(S,K,T,R,Sig,B);
+}
+
+double BSExactPricingEngine::Put_Price_BS(const std::vector<double>& source_params)
+{
+    return Put_Price_BS(source_params[0], source_params[1], source_params[2], source_params[3], source_params[4], source_params[5]);
+}
+
+double BSExactPricingEngine::Put_Price_BS(const Param_Data& source_params)
+{
+    return Put_Price_BS(source_params.m_S, source_params.m_K, source_params.m_T, source_params.m_R, source_params.m_Sig, source_params.m_B);
+}
+
+void BSExactPricingEngine::Call_Put_Price_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B, double& call, double& put)
+{
+    // One evaluation of D1, D2 and of the discounting terms, shared by the call and the put
+    BS_Kernel<double>::Call_Put_Price(S,K,T,R,Sig,B,call,put);
+}
+
+BS_Greeks BSExactPricingEngine::Greeks_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B)
+{
+    double sqrt_T = sqrt(T);
+    double d1 = D1(S,K,T,R,Sig,B), d2 = d1 - Sig*sqrt_T;
+    double carry = exp((B-R)*T), discount = exp(-R*T);
+    double Nd1 = N(d1), Nd2 = N(d2), N_d1 = N(-d1), N_d2 = N(-d2), nd1 = n(d1);
+
+    BS_Greeks greeks;
+    greeks.m_call_price = S*carry*Nd1 - K*discount*Nd2;
+    greeks.m_put_price = K*discount*N_d2 - S*carry*N_d1;
+    greeks.m_call_delta = carry*Nd1;
+    greeks.m_put_delta = carry*(Nd1 - 1.0);
+    greeks.m_gamma = nd1*carry / (S*Sig*sqrt_T);
+    greeks.m_vega = S*carry*nd1*sqrt_T;
+
+    double time_decay = -(S*Sig*carry*nd1) / (2.0*sqrt_T);     // Term shared by the call and put thetas
+    greeks.m_call_theta = time_decay - (B-R)*S*carry*Nd1 - R*K*discount*Nd2;
+    greeks.m_put_theta = time_decay + (B-R)*S*carry*N_d1 + R*K*discount*N_d2;
+
+    // Higher-order Greeks, from the same d1, d2, n(d1) and N(d1): a few multiplications each
+    double sig_sqrt_T = Sig*sqrt_T;
+    double charm_decay = -carry*nd1*(B/sig_sqrt_T - d2/(2.0*T));    // Term shared by the call and put charms
+    greeks.m_vanna = -carry*nd1*d2 / Sig;
+    greeks.m_volga = greeks.m_vega*d1*d2 / Sig;
+    greeks.m_call_charm = charm_decay - (B-R)*carry*Nd1;
+    greeks.m_put_charm = charm_decay + (B-R)*carry*N_d1;
+    greeks.m_speed = -greeks.m_gamma*(1.0 + d1/sig_sqrt_T) / S;
+    greeks.m_color = greeks.m_gamma*(R - B + B*d1/sig_sqrt_T + (1.0 - d1*d2)/(2.0*T));
+    return greeks;
+}
+
+BS_Greeks BSExactPricingEngine::Greeks_BS(const Param_Data& source_params)
+{
+    return Greeks_BS(source_params.m_S, source_params.m_K, source_params.m_T, source_params.m_R, source_params.m_Sig, source_params.m_B);
+}
+
+void BSExactPricingEngine::Greeks_BS_Batch(const std::vector<Param_Data>& source_params, std::vector<BS_Greeks>& results)
+{
+    results.resize(source_params.size());
+    for(std::size_t i = 0; i < source_params.size(); i++)
+    {
+        results[i] = Greeks_BS(source_params[i]);
+    }
+}
+
+
+// DELTAS
+
+double BSExactPricingEngine::Call_Delta_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B)
+{
+    // Delta call = exp((B-R)T)*N(d1)
+    return BS_Kernel<double>::Call_Delta(S,K,T,R,Sig,B);
+}
+
+double BSExactPricingEngine::Call_Delta_BS(const std::vector<double>& source_params)
+{
+    return Call_Delta_BS(source_params[0], source_params[1], source_params[2], source_params[3], source_params[4], source_params[5]);
+}
+
+double BSExactPricingEngine::Call_Delta_BS(const Param_Data& source_params)
+{
+    return Call_Delta_BS(source_params.m_S, source_params.m_K, source_params.m_T, source_params.m_R, source_params.m_Sig, source_params.m_B);
+}
+
+double BSExactPricingEngine::Put_Delta_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B)
+{
+    // Delta put = exp((B-R)T)*(N(d1) - 1)
+    return BS_Kernel<double>::Put_Delta(S,K,T,R,Sig,B);
+}
+
+double BSExactPricingEngine::Put_Delta_BS(const std::vector<double>& source_params)
+{
+    return Put_Delta_BS(source_params[0], source_params[1], source_params[2], source_params[3], source_params[4], source_params[5]);
+}
+
+double BSExactPricingEngine::Put_Delta_BS(const Param_Data& source_params)
+{
+    return Put_Delta_BS(source_params.m_S, source_params.m_K, source_params.m_T, source_params.m_R, source_params.m_Sig, source_params.m_B);
+}
+
+
+// GAMMA AND VEGA (same for calls and puts)
+
+double BSExactPricingEngine::Gamma_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B)
+{
+    // Gamma = n(d1)*exp((B-R)T) / (S*Sig*sqrt(T))
+    return BS_Kernel<double>::Gamma(S,K,T,R,Sig,B);
+}
+
+double BSExactPricingEngine::Gamma_BS(const std::vector<double>& source_params)
+{
+    return Gamma_BS(source_params[0], source_params[1], source_params[2], source_params[3], source_params[4], source_params[5]);
+}
+
+double BSExactPricingEngine::Gamma_BS(const Param_Data& source_params)
+{
+    return Gamma_BS(source_params.m_S, source_params.m_K, source_params.m_T, source_params.m_R, source_params.m_Sig, source_params.m_B);
+}
+
+double BSExactPricingEngine::Vega_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B)
+{
+    // Vega = S*exp((B-R)T)*n(d1)*sqrt(T)
+    return BS_Kernel<double>::Vega(S,K,T,R,Sig,B);
+}
+
+double BSExactPricingEngine::Vega_BS(const std::vector<double>& source_params)
+{
+    return Vega_BS(source_params[0], source_params[1], source_params[2], source_params[3], source_params[4], source_params[5]);
+}
+
+double BSExactPricingEngine::Vega_BS(const Param_Data& source_params)
+{
+    return Vega_BS(source_params.m_S, source_params.m_K, source_params.m_T, source_params.m_R, source_params.m_Sig, source_params.m_B);
+}
+
+
+// THETAS
+
+double BSExactPricingEngine::Call_Theta_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B)
+{
+    // Theta call = -S*Sig*exp((B-R)T)*n(d1)/(2sqrt(T)) - (B-R)*S*exp((B-R)T)*N(d1) - R*K*exp(-RT)*N(d2)
+    return BS_Kernel<double>::Call_Theta(S,K,T,R,Sig,B);
+}
+
+double BSExactPricingEngine::Call_Theta_BS(const std::vector<double>& source_params)
+{
+    return Call_Theta_BS(source_params[0], source_params[1], source_params[2], source_params[3], source_params[4], source_params[5]);
+}
+
+double BSExactPricingEngine::Call_Theta_BS(const Param_Data& source_params)
+{
+    return Call_Theta_BS(source_params.m_S, source_params.m_K, source_params.m_T, source_params.m_R, source_params.m_Sig, source_params.m_B);
+}
+
+double BSExactPricingEngine::Put_Theta_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B)
+{
+    // Theta put = -S*Sig*exp((B-R)T)*n(d1)/(2sqrt(T)) + (B-R)*S*exp((B-R)T)*N(-d1) + R*K*exp(-RT)*N(-d2)
+    return BS_Kernel<double>::Put_Theta(S,K,T,R,Sig,B);
+}
+
+double BSExactPricingEngine::Put_Theta_BS(const std::vector<double>& source_params)
+{
+    return Put_Theta_BS(source_params[0], source_params[1], source_params[2], source_params[3], source_params[4], source_params[5]);
+}
+
+double BSExactPricingEngine::Put_Theta_BS(const Param_Data& source_params)
+{
+    return Put_Theta_BS(source_params.m_S, source_params.m_K, source_params.m_T, source_params.m_R, source_params.m_Sig, source_params.m_B);
+}
+
+
+// PRICES FROM DISCOUNT FACTORS
+
+double BSExactPricingEngine::Call_Price_BS_DF(const double& S, const double& K, const double& T, const double& Sig, const double& DF_R, const double& DF_B)
+{
+    // With F = S/DF_B the forward, C = DF_R*( F*N(d1) - K*N(d2) ), and d1 = ( ln(F/K) + Sig^2*T/2 ) / ( Sig*sqrt(T) )
+    double F = S / DF_B, sig_sqrt_T = Sig*sqrt(T);
+    double d1 = log(F/K)/sig_sqrt_T + 0.5*sig_sqrt_T;
+    return DF_R*(F*N(d1) - K*N(d1 - sig_sqrt_T));
+}
+
+double BSExactPricingEngine::Put_Price_BS_DF(const double& S, const double& K, const double& T, const double& Sig, const double& DF_R, const double& DF_B)
+{
+    // P = DF_R*( K*N(-d2) - F*N(-d1) )
+    double F = S / DF_B, sig_sqrt_T = Sig*sqrt(T);
+    double d1 = log(F/K)/sig_sqrt_T + 0.5*sig_sqrt_T;
+    return DF_R*(K*N(sig_sqrt_T - d1) - F*N(-d1));
+}
+
+void BSExactPricingEngine::Price_BS_Batch(const Option_Type& optiontype, const std::vector<double>& S, const std::vector<double>& K, const std::vector<double>& Sig,
+    const DiscountCache& cache, std::vector<double>& results)
+{
+    const std::vector<std::size_t>& index = cache.getIndex();   // Position of the expiry of each option among the distinct expiries
+    if(S.size() != index.size() || K.size() != index.size() || Sig.size() != index.size())
+    {
+        throw std::invalid_argument("Error: Batch vectors are not of the same size as the discount factor cache.");
+    }
+
+    // Discount factors, forwards factors and sqrt(T) were computed once per distinct expiry, so that no exponential is evaluated per option
+    const double* DF_R = cache.getDF_R().data();
+    const double* DF_B = cache.getDF_B().data();
+    const double* sqrt_T = cache.getSqrtT().data();
+
+    results.resize(index.size());
+    const double sign = (optiontype == Option_Type::Call) ? 1.0 : -1.0;    // Calls and puts only differ in the sign of the arguments: P = DF_R*( K*N(-d2) - F*N(-d1) )
+
+    for(std::size_t i = 0; i < index.size(); i++)
+    {
+        const std::size_t e = index[i];
+        double F = S[i] / DF_B[e], sig_sqrt_T = Sig[i]*sqrt_T[e];
+        double d1 = log(F/K[i])/sig_sqrt_T + 0.5*sig_sqrt_T;
+        results[i] = sign*DF_R[e]*(F*N(sign*d1) - K[i]*N(sign*(d1 - sig_sqrt_T)));
+    }
+}
+
+
+// HIGHER-ORDER GREEKS
+
+double BSExactPricingEngine::Vanna_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B)
+{
+    // Vanna = d(delta)/d(Sig) = -exp((B-R)T)*n(d1)*d2/Sig
+    return BS_Kernel<double>::Vanna(S,K,T,R,Sig,B);
+}
+
+double BSExactPricingEngine::Vanna_BS(const Param_Data& source_params)
+{
+    return Vanna_BS(source_params.m_S, source_params.m_K, source_params.m_T, source_params.m_R, source_params.m_Sig, source_params.m_B);
+}
+
+double BSExactPricingEngine::Volga_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B)
+{
+    // Volga = d(vega)/d(Sig) = vega*d1*d2/Sig
+    return BS_Kernel<double>::Volga(S,K,T,R,Sig,B);
+}
+
+double BSExactPricingEngine::Volga_BS(const Param_Data& source_params)
+{
+    return Volga_BS(source_params.m_S, source_params.m_K, source_params.m_T, source_params.m_R, source_params.m_Sig, source_params.m_B);
+}
+
+double BSExactPricingEngine::Call_Charm_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B)
+{
+    // Charm call = -exp((B-R)T)*( n(d1)*(B/(Sig*sqrt(T)) - d2/(2T)) + (B-R)*N(d1) )
+    return BS_Kernel<double>::Call_Charm(S,K,T,R,Sig,B);
+}
+
+double BSExactPricingEngine::Call_Charm_BS(const Param_Data& source_params)
+{
+    return Call_Charm_BS(source_params.m_S, source_params.m_K, source_params.m_T, source_params.m_R, source_params.m_Sig, source_params.m_B);
+}
+
+double BSExactPricingEngine::Put_Charm_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B)
+{
+    // Charm put = -exp((B-R)T)*( n(d1)*(B/(Sig*sqrt(T)) - d2/(2T)) - (B-R)*N(-d1) )
+    return BS_Kernel<double>::Put_Charm(S,K,T,R,Sig,B);
+}
+
+double BSExactPricingEngine::Put_Charm_BS(const Param_Data& source_params)
+{
+    return Put_Charm_BS(source_params.m_S, source_params.m_K, source_params.m_T, source_params.m_R, source_params.m_Sig, source_params.m_B);
+}
+
+double BSExactPricingEngine::Speed_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B)
+{
+    // Speed = d(gamma)/dS = -gamma*(1 + d1/(Sig*sqrt(T)))/S
+    return BS_Kernel<double>::Speed(S,K,T,R,Sig,B);
+}
+
+double BSExactPricingEngine::Speed_BS(const Param_Data& source_params)
+{
+    return Speed_BS(source_params.m_S, source_params.m_K, source_params.m_T, source_params.m_R, source_params.m_Sig, source_params.m_B);
+}
+
+double BSExactPricingEngine::Color_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B)
+{
+    // Color = d(gamma)/dt = gamma*( R - B + B*d1/(Sig*sqrt(T)) + (1 - d1*d2)/(2T) )
+    return BS_Kernel<double>::Color(S,K,T,R,Sig,B);
+}
+
+double BSExactPricingEngine::Color_BS(const Param_Data& source_params)
+{
+    return Color_BS(source_params.m_S, source_params.m_K, source_params.m_T, source_params.m_R, source_params.m_Sig, source_params.m_B);
+}
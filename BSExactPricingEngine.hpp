@@ -1,71 +1,136 @@
-//BSExactPricingEngine.hpp
-// The design pattern was inspired by Mark Joshi's "C++ Design Patterns and Derivatives Pricing"
-//
-//Purpose: Black-Scholes pricing engine for the computing of: exact prices for calls and puts, and computing of greeks: delta, gamma, vega, theta. 
-//
-//Modification date: 1/15/2023
-
-#ifndef BSExactPricingEngine_hpp
-#define BSExactPricingEngine_hpp
-
-
-#include "PricingEngine.hpp"    //PricingEngine base class
-#include <vector>
-
-class BSExactPricingEngine: public PricingEngine
-{
-private:
-		
-	static double D1(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B);   // D1 argument needed for the computation of Black Scholes formulae
-	static double D2(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B);   // D2 argument needed for the computation of Black Scholes formulae
-
-	static double N(const double& x);            // CDF of normal distribution
-	static double n(const double& x);            // PDF of normal distribution
-
-public:
-
-    BSExactPricingEngine();                      // Default constructor
-    virtual ~BSExactPricingEngine();             // Destructor
-
-// PRICING & GREEKS/SENSITIVITIES
-
-    // Call exact price using Black-Scholes formula
-    static double Call_Price_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B); // Takes S,K,T,R,Sig,B as arguments 
-    static double Call_Price_BS(const std::vector<double>& source_params); // Taking a vector of parameter data as argument
-    
-    //Put exact price using Black-Scholes formula
-    static double Put_Price_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B);  // Takes S,K,T,R,Sig,B as arguments 
-    static double Put_Price_BS(const std::vector<double>& source_params); // Taking a vector of parameter data as argument
-
-    // Call delta formula using Black-Scholes formula
-    static double Call_Delta_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B);  // Takes S,K,T,R,Sig,B as arguments 
-    static double Call_Delta_BS(const std::vector<double>& source_params); // Taking a vector of parameter data as argument
-    
-    // Put delta formula using Black-Scholes formula
-    static double Put_Delta_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B);  // Takes S,K,T,R,Sig,B as arguments 
-    static double Put_Delta_BS(const std::vector<double>& source_params); // Taking a vector of parameter data as argument
-
-    // Gamma formula for call and put using Black-Scholes formula
-    static double Gamma_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B);      // Takes S,K,T,R,Sig,B as arguments 
-    static double Gamma_BS(const std::vector<double>& source_params); // Taking a vector of parameter data as argument
-
-    // Vega formula for call and put using Black-Scholes formula
-    static double Vega_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B);       // Takes S,K,T,R,Sig,B as arguments 
-    static double Vega_BS(const std::vector<double>& source_params); // Taking a vector of parameter data as argument
-
-    // Call theta formula using Black-Scholes formula
-    static double Call_Theta_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B);  // Takes S,K,T,R,Sig,B as arguments 
-    static double Call_Theta_BS(const std::vector<double>& source_params); // Taking a vector of parameter data as argument
-
-    // Put delta formula using Black-Scholes formula
-    static double Put_Theta_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B);   // Takes S,K,T,R,Sig,B as arguments 
-    static double Put_Theta_BS(const std::vector<double>& source_params); // Taking a vector of parameter data as argument
-
-    //Add additional Greeks: First-order: rho, lambda, epsilon, 
-    //                       Second-order: vanna, charm, vomma, veta, vera, 
-    //                       Third-order:  speed, zomma, color, ultima
-
-
-};
-
+//BSExactPricingEngine.hpp
+// The design pattern was inspired by Mark Joshi's "C++ Design Patterns and Derivatives Pricing"
+//
+//Purpose: Black-Scholes pricing engine for the computing of: exact prices for calls and puts, and computing of greeks: delta, gamma, vega, theta, and the
+//         higher-order vanna, volga, charm, speed and color. The formulae are those of BS_Kernel<double> in PricingKernels.hpp, which takes its arguments by value
+//         and inlines into the caller: the static functions below are out-of-line wrappers over it, and hot loops call the kernel directly.
+//
+//Modification date: 1/15/2023
+
+#ifndef BSExactPricingEngine_hpp
+#define BSExactPricingEngine_hpp
+
+
+#include "PricingEngine.hpp"    //PricingEngine base class
+#include "OptionData.hpp"       //Option_Type enum class, for batch functions
+#include "TermStructure.hpp"    //DiscountCache, for pricing from precomputed discount factors
+#include <vector>
+
+// Prices and Greeks of both the call and the put, as computed in one fused evaluation by Greeks_BS()
+struct BS_Greeks
+{
+    double m_call_price, m_put_price;       // Call and put prices
+    double m_call_delta, m_put_delta;       // Call and put deltas
+    double m_gamma, m_vega;                 // Gamma and vega, the same for calls and puts
+    double m_call_theta, m_put_theta;       // Call and put thetas
+    double m_vanna, m_volga;                // d(delta)/d(Sig) and d(vega)/d(Sig), the same for calls and puts
+    double m_call_charm, m_put_charm;       // Call and put charms: d(delta)/dt = -d(delta)/dT, with the sign convention of theta
+    double m_speed;                         // d(gamma)/dS, the same for calls and puts
+    double m_color;                         // d(gamma)/dt = -d(gamma)/dT, the same for calls and puts
+};
+
+class BSExactPricingEngine: public PricingEngine
+{
+private:
+		
+	static double D1(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B);   // D1 argument needed for the computation of Black Scholes formulae
+	static double D2(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B);   // D2 argument needed for the computation of Black Scholes formulae
+
+	static double N(const double& x);            // CDF of normal distribution
+	static double n(const double& x);            // PDF of normal distribution
+
+public:
+
+    BSExactPricingEngine();                      // Default constructor
+    virtual ~BSExactPricingEngine();             // Destructor
+
+// PRICING & GREEKS/SENSITIVITIES
+
+    // Call exact price using Black-Scholes formula
+    static double Call_Price_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B); // Takes S,K,T,R,Sig,B as arguments 
+    static double Call_Price_BS(const std::vector<double>& source_params); // Taking a vector of parameter data as argument
+    static double Call_Price_BS(const Param_Data& source_params);         // Taking a parameter block as argument, without allocation
+    
+    //Put exact price using Black-Scholes formula
+    static double Put_Price_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B);  // Takes S,K,T,R,Sig,B as arguments 
+    static double Put_Price_BS(const std::vector<double>& source_params); // Taking a vector of parameter data as argument
+    static double Put_Price_BS(const Param_Data& source_params);         // Taking a parameter block as argument, without allocation
+
+    // Call delta formula using Black-Scholes formula
+    static double Call_Delta_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B);  // Takes S,K,T,R,Sig,B as arguments 
+    static double Call_Delta_BS(const std::vector<double>& source_params); // Taking a vector of parameter data as argument
+    static double Call_Delta_BS(const Param_Data& source_params);         // Taking a parameter block as argument, without allocation
+    
+    // Put delta formula using Black-Scholes formula
+    static double Put_Delta_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B);  // Takes S,K,T,R,Sig,B as arguments 
+    static double Put_Delta_BS(const std::vector<double>& source_params); // Taking a vector of parameter data as argument
+    static double Put_Delta_BS(const Param_Data& source_params);         // Taking a parameter block as argument, without allocation
+
+    // Gamma formula for call and put using Black-Scholes formula
+    static double Gamma_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B);      // Takes S,K,T,R,Sig,B as arguments 
+    static double Gamma_BS(const std::vector<double>& source_params); // Taking a vector of parameter data as argument
+    static double Gamma_BS(const Param_Data& source_params);         // Taking a parameter block as argument, without allocation
+
+    // Vega formula for call and put using Black-Scholes formula
+    static double Vega_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B);       // Takes S,K,T,R,Sig,B as arguments 
+    static double Vega_BS(const std::vector<double>& source_params); // Taking a vector of parameter data as argument
+    static double Vega_BS(const Param_Data& source_params);         // Taking a parameter block as argument, without allocation
+
+    // Call theta formula using Black-Scholes formula
+    static double Call_Theta_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B);  // Takes S,K,T,R,Sig,B as arguments 
+    static double Call_Theta_BS(const std::vector<double>& source_params); // Taking a vector of parameter data as argument
+    static double Call_Theta_BS(const Param_Data& source_params);         // Taking a parameter block as argument, without allocation
+
+    // Put delta formula using Black-Scholes formula
+    static double Put_Theta_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B);   // Takes S,K,T,R,Sig,B as arguments 
+    static double Put_Theta_BS(const std::vector<double>& source_params); // Taking a vector of parameter data as argument
+    static double Put_Theta_BS(const Param_Data& source_params);         // Taking a parameter block as argument, without allocation
+
+    // Second and third-order Greeks: vanna and volga (vomma) in volatility, charm and color in time (sign convention of theta), speed in S
+    static double Vanna_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B);
+    static double Vanna_BS(const Param_Data& source_params);
+    static double Volga_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B);
+    static double Volga_BS(const Param_Data& source_params);
+    static double Call_Charm_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B);
+    static double Call_Charm_BS(const Param_Data& source_params);
+    static double Put_Charm_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B);
+    static double Put_Charm_BS(const Param_Data& source_params);
+    static double Speed_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B);
+    static double Speed_BS(const Param_Data& source_params);
+    static double Color_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B);
+    static double Color_BS(const Param_Data& source_params);
+
+    // Call and put prices in one fused evaluation, sharing D1, D2 and the discounting terms. Results are written into call and put.
+    static void Call_Put_Price_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B, double& call, double& put);
+
+    // Prices, deltas, gamma, vega, thetas and the higher-order Greeks of the call and the put in one fused evaluation, sharing D1, D2, N(), n() and the discounting terms
+    static BS_Greeks Greeks_BS(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B);
+    static BS_Greeks Greeks_BS(const Param_Data& source_params);
+    static void Greeks_BS_Batch(const std::vector<Param_Data>& source_params, std::vector<BS_Greeks>& results);   // Fused evaluation of each option, results resized to match
+
+    // Inverse of the CDF of the normal distribution, for p in (0,1), e.g. to turn uniforms into normals. Its batch form is Inverse_N_Batch_Dispatch() in KernelDispatch.hpp.
+    static double Inverse_N(const double& p);
+
+    // Implied volatility: the Sig at which the Black-Scholes price of the option equals the price given (m_Sig of the parameter block is not used). Newton's
+    // method on Sig, safeguarded by bisection on a bracket of the root; throws if the price is outside the no-arbitrage bounds.
+    static double Implied_Vol_BS(const Option_Type& optiontype, const double& price, const double& S, const double& K, const double& T, const double& R, const double& B);
+    static double Implied_Vol_BS(const Option_Type& optiontype, const double& price, const Param_Data& source_params);
+    static void Implied_Vol_BS_Batch(const Option_Type& optiontype, const std::vector<double>& prices, const std::vector<Param_Data>& source_params,
+        std::vector<double>& results);      // Results resized to match
+
+    // Call and put prices from discount factors DF_R = exp(-R*T) and DF_B = exp(-B*T), typically precomputed from a TermStructure
+    static double Call_Price_BS_DF(const double& S, const double& K, const double& T, const double& Sig, const double& DF_R, const double& DF_B);
+    static double Put_Price_BS_DF(const double& S, const double& K, const double& T, const double& Sig, const double& DF_R, const double& DF_B);
+
+    // Batch pricing, using the discount factors cached once per distinct expiry rather than computing exponentials per option. Results are written into the vector provided.
+    static void Price_BS_Batch(const Option_Type& optiontype, const std::vector<double>& S, const std::vector<double>& K, const std::vector<double>& Sig,
+        const DiscountCache& cache, std::vector<double>& results);
+
+    //Add additional Greeks: First-order: rho, lambda, epsilon, 
+    //                       Second-order: veta, vera, 
+    //                       Third-order:  zomma, ultima
+
+
+};
+
 #endif //PricingEngine_hpp
\ No newline at end of file
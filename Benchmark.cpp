@@ -0,0 +1,439 @@
+//Benchmark.cpp
+//
+//Purpose: Benchmark suite of the pricing library, reporting the time per operation of the hot paths: scalar and fused Black-Scholes, the batch kernels under each
+//         available instruction-set variant, Matrix pricing, columnar export and text reports, divided differences against the finite-difference engine, the
+//         Chebyshev proxy and the price cache against direct pricing, Monte Carlo paths, Heston strike ladders, local volatility PDE sweeps against one solve per
+//         option, SVI and Heston calibration (cold and warm-started), and risk aggregation. It is also the training run of profile-guided builds (see
+//         CMakeLists.txt): with --quick, every benchmark runs with a tenth of its iterations, which covers the same code paths.
+//
+//Modification date: 10/18/2026
+
+
+#include "BSExactPricingEngine.hpp"
+#include "DividedDifferences.hpp"
+#include "FiniteDifferenceEngine.hpp"
+#include "Matrix.hpp"
+#include "ChebyshevProxy.hpp"
+#include "PriceCache.hpp"
+#include "RiskAggregator.hpp"
+#include "MonteCarloEngine.hpp"
+#include "HestonEngine.hpp"
+#include "LocalVolEngine.hpp"
+#include "CalibrationEngine.hpp"
+#include "KernelDispatch.hpp"
+#include "EuropeanOption.hpp"
+#include "ReportFormatter.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <random>
+#include <vector>
+
+static volatile double Sink = 0.0;     // Results are accumulated here, so that the compiler cannot drop the benchmarked calls
+
+// Runs function(iterations) once to warm up, then times it, and prints and returns the time per operation (operations = iterations * operations_per_iteration)
+template<typename Function>
+static double Benchmark_Run(const char* name, const std::size_t& iterations, const std::size_t& operations_per_iteration, const Function& function)
+{
+    function(iterations / 10 + 1);
+    auto start = std::chrono::steady_clock::now();
+    function(iterations);
+    auto end = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    double operations = double(iterations)*double(operations_per_iteration);
+    std::printf("%-48s %12.1f ns/op %14.0f ops\n", name, ns / operations, operations);
+    return ns / operations;
+}
+
+int main(int argc, char* argv[])
+{
+    const bool quick = (argc > 1 && std::strcmp(argv[1], "--quick") == 0);
+    const std::size_t scale = quick ? 1 : 10;
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    const std::size_t batch = 4096;
+    std::vector<Param_Data> options(batch);
+    Param_Columns<double> columns;
+    columns.resize(batch);
+    for(std::size_t i = 0; i < batch; i++)
+    {
+        Param_Data p = {80.0 + 40.0*uniform(generator), 100.0, 0.1 + 1.9*uniform(generator), 0.05, 0.1 + 0.4*uniform(generator), 0.05, 0.0};
+        options[i] = p;
+        columns.S[i] = p.m_S; columns.K[i] = p.m_K; columns.T[i] = p.m_T; columns.R[i] = p.m_R; columns.Sig[i] = p.m_Sig; columns.B[i] = p.m_B;
+    }
+    std::printf("Kernel variant detected: %s%s\n", Kernel_ISA_Name(Kernel_ISA_Detected()).c_str(), quick ? " (quick run)" : "");
+
+    // Scalar Black-Scholes: the static API of BSExactPricingEngine against the inline kernel it wraps
+    Benchmark_Run("Call_Price_BS (static wrapper)", 10*scale, batch, [&](std::size_t iterations)
+    {
+        double sum = 0.0;
+        for(std::size_t k = 0; k < iterations; k++)
+            for(std::size_t i = 0; i < batch; i++){sum += BSExactPricingEngine::Call_Price_BS(options[i]);}
+        Sink = Sink + sum;
+    });
+    Benchmark_Run("BS_Kernel<double>::Call_Price (inline)", 10*scale, batch, [&](std::size_t iterations)
+    {
+        double sum = 0.0;
+        for(std::size_t k = 0; k < iterations; k++)
+        {
+            for(std::size_t i = 0; i < batch; i++)
+            {
+                const Param_Data& p = options[i];
+                sum += BS_Kernel<double>::Call_Price(p.m_S, p.m_K, p.m_T, p.m_R, p.m_Sig, p.m_B);
+            }
+        }
+        Sink = Sink + sum;
+    });
+    Benchmark_Run("Greeks_BS (fused, all Greeks)", 10*scale, batch, [&](std::size_t iterations)
+    {
+        double sum = 0.0;
+        for(std::size_t k = 0; k < iterations; k++)
+            for(std::size_t i = 0; i < batch; i++){sum += BSExactPricingEngine::Greeks_BS(options[i]).m_speed;}
+        Sink = Sink + sum;
+    });
+
+    // Batch kernels, under every variant available in this build and on this CPU
+    std::vector<double> results(batch);
+    Param_Columns<float> columns_float;
+    columns_float.resize(batch);
+    for(std::size_t i = 0; i < batch; i++)
+    {
+        columns_float.S[i] = float(columns.S[i]); columns_float.K[i] = float(columns.K[i]); columns_float.T[i] = float(columns.T[i]);
+        columns_float.R[i] = float(columns.R[i]); columns_float.Sig[i] = float(columns.Sig[i]); columns_float.B[i] = float(columns.B[i]);
+    }
+    std::vector<float> results_float(batch);
+    std::vector<double> uniforms(batch);
+    for(std::size_t i = 0; i < batch; i++){uniforms[i] = (double(i) + 0.5) / double(batch);}
+    const Kernel_ISA variants[4] = {Kernel_ISA::Generic, Kernel_ISA::SSE4, Kernel_ISA::AVX2, Kernel_ISA::AVX512};
+    for(int v = 0; v < 4; v++)
+    {
+        if(!Kernel_ISA_Available(variants[v])){continue;}
+        Kernel_ISA_Select(variants[v]);
+        std::string name_double = "Price_BS_Batch_Dispatch double, " + Kernel_ISA_Name(variants[v]);
+        std::string name_float = "Price_BS_Batch_Dispatch float, " + Kernel_ISA_Name(variants[v]);
+        Benchmark_Run(name_double.c_str(), 10*scale, batch, [&](std::size_t iterations)
+        {
+            for(std::size_t k = 0; k < iterations; k++)
+            {
+                Price_BS_Batch_Dispatch(Option_Type::Call, batch, columns.S.data(), columns.K.data(), columns.T.data(), columns.R.data(), columns.Sig.data(),
+                    columns.B.data(), results.data());
+            }
+            Sink = Sink + results[0];
+        });
+        Benchmark_Run(name_float.c_str(), 10*scale, batch, [&](std::size_t iterations)
+        {
+            for(std::size_t k = 0; k < iterations; k++)
+            {
+                Price_BS_Batch_Dispatch(Option_Type::Call, batch, columns_float.S.data(), columns_float.K.data(), columns_float.T.data(), columns_float.R.data(),
+                    columns_float.Sig.data(), columns_float.B.data(), results_float.data());
+            }
+            Sink = Sink + results_float[0];
+        });
+        std::string name_inverse = "Inverse_N_Batch_Dispatch double, " + Kernel_ISA_Name(variants[v]);
+        Benchmark_Run(name_inverse.c_str(), 10*scale, batch, [&](std::size_t iterations)
+        {
+            for(std::size_t k = 0; k < iterations; k++)
+            {
+                Inverse_N_Batch_Dispatch(batch, uniforms.data(), results.data());
+            }
+            Sink = Sink + results[0];
+        });
+    }
+    Kernel_ISA_Select(Kernel_ISA_Detected());
+
+    // Matrix pricing over a mesh of S
+    Matrix matrix(options[0], 50.0, 150.0, 0.01, Param_Type::S, Base_Type::European);
+    Benchmark_Run("Matrix::MatrixPricer_BS (10000 points)", scale, std::size_t(matrix.size_matrix()), [&](std::size_t iterations)
+    {
+        for(std::size_t k = 0; k < iterations; k++){Sink = Sink + matrix.MatrixPricer_BS(Option_Type::Call, Exercise_Type::Spot)[0];}
+    });
+
+    // Binary columnar export of the matrix with its prices and deltas (10 columns), plain and delta-encoded, and reading the file back
+    const std::vector<std::vector<double>> matrix_results = {matrix.MatrixPricer_BS(Option_Type::Call, Exercise_Type::Spot),
+        matrix.Matrix_Delta_BS(Option_Type::Call, Exercise_Type::Spot)};
+    const std::string export_path = "/tmp/pricing_benchmark.col";
+    Benchmark_Run("Matrix::Export_Columnar plain (point)", scale, matrix_results[0].size(), [&](std::size_t iterations)
+    {
+        for(std::size_t k = 0; k < iterations; k++){matrix.Export_Columnar(export_path, {"price", "delta"}, matrix_results, Column_Encoding::Plain);}
+    });
+    Benchmark_Run("Matrix::Export_Columnar delta (point)", scale, matrix_results[0].size(), [&](std::size_t iterations)
+    {
+        for(std::size_t k = 0; k < iterations; k++){matrix.Export_Columnar(export_path, {"price", "delta"}, matrix_results, Column_Encoding::Delta, Column_Encoding::Delta);}
+    });
+    std::vector<double> column;
+    Benchmark_Run("ColumnarReader::Read_Column delta (point)", scale, matrix_results[0].size(), [&](std::size_t iterations)
+    {
+        for(std::size_t k = 0; k < iterations; k++)
+        {
+            ColumnarReader reader(export_path);
+            const std::vector<std::string> names = reader.Column_Names();
+            for(std::size_t c = 0; c < names.size(); c++){reader.Read_Column(names[c], column); Sink = Sink + column[0];}
+        }
+    });
+    std::remove(export_path.c_str());
+
+    // Reports: a book of options formatted with stringstreams (as ToString() and Four_Greeks_BS() used to), against one reused ReportBuffer; and the mesh
+    // and prices written to a file line by line with std::endl (as Print_Vector() used to), against ReportBuffer text and CSV
+    std::vector<EuropeanOption> book;
+    for(std::size_t i = 0; i < 1024; i++)
+    {
+        const Param_Data& p = options[i];
+        book.push_back(EuropeanOption(p.m_S, p.m_K, p.m_T, p.m_R, p.m_Sig, (i % 2) ? Option_Type::Put : Option_Type::Call, Exercise_Type::Spot));
+    }
+    Benchmark_Run("Book report, stringstream (option)", scale, book.size(), [&](std::size_t iterations)
+    {
+        for(std::size_t k = 0; k < iterations; k++)
+        {
+            std::string report;
+            for(std::size_t i = 0; i < book.size(); i++)
+            {
+                const EuropeanOption& o = book[i];
+                std::stringstream ss, greeks;
+                ss << "Type: " << o.print_OptionType() << " " << o.print_ExerciseType() << "; S: " << o.getS() << "; T: " << o.getT() << "; K:" << o.getK()
+                   << "; R: " << o.getR() << "; Sig: " << o.getSig() << "; B: " << o.getB() << "; ID: " << o.getID() << "\n";
+                ss << "Price of option using the Black-Scholes exact pricing formula is: " << o.Price_BS();
+                greeks << "Delta: " << o.Delta_BS() << " Gamma: " << o.Gamma_BS() << "; Theta: " << o.Theta_BS() << "; Vega: " << o.Vega_BS();
+                report += ss.str() + "\n" + greeks.str() + "\n";
+            }
+            Sink = Sink + double(report.size());
+        }
+    });
+    ReportBuffer book_report;
+    Benchmark_Run("Book report, ReportBuffer (option)", scale, book.size(), [&](std::size_t iterations)
+    {
+        for(std::size_t k = 0; k < iterations; k++)
+        {
+            book_report.clear();
+            for(std::size_t i = 0; i < book.size(); i++)
+            {
+                book[i].ToString(book_report);
+                book_report << "\n";
+                book[i].Four_Greeks_BS(book_report);
+                book_report << "\n";
+            }
+            Sink = Sink + double(book_report.size());
+        }
+    });
+    std::ofstream null_file("/dev/null");
+    const std::vector<double>& prices_column = matrix_results[0];
+    Benchmark_Run("Mesh report, std::endl per line (point)", scale, prices_column.size(), [&](std::size_t iterations)
+    {
+        for(std::size_t k = 0; k < iterations; k++)
+        {
+            for(std::size_t i = 0; i < prices_column.size(); i++){null_file << "S at: " << matrix.getMesh()[i] << " = " << prices_column[i] << std::endl;}
+        }
+    });
+    Benchmark_Run("Mesh report, ReportBuffer text (point)", scale, prices_column.size(), [&](std::size_t iterations)
+    {
+        ReportBuffer buffer(null_file);
+        for(std::size_t k = 0; k < iterations; k++){buffer.Text("S", matrix.getMesh(), prices_column);}
+        buffer.Flush(true);
+    });
+    Benchmark_Run("Mesh report, ReportBuffer CSV (point)", scale, prices_column.size(), [&](std::size_t iterations)
+    {
+        ReportBuffer buffer(null_file);
+        for(std::size_t k = 0; k < iterations; k++){buffer.CSV({"S", "price", "delta"}, {matrix.getMesh(), matrix_results[0], matrix_results[1]});}
+        buffer.Flush(true);
+    });
+
+    // Bumped Greeks: 2-point divided differences against the 4th order stencil engine (7 Greeks per option)
+    Benchmark_Run("Delta+Gamma_DividedDiff (per option)", 10*scale, batch, [&](std::size_t iterations)
+    {
+        double sum = 0.0;
+        for(std::size_t k = 0; k < iterations; k++)
+        {
+            for(std::size_t i = 0; i < batch; i++)
+            {
+                Param_Data p = options[i];
+                p.m_h = 1e-2;
+                sum += DividedDifferences::Delta_Call_DividedDiff(p) + DividedDifferences::Gamma_DividedDiff(p);
+            }
+        }
+        Sink = Sink + sum;
+    });
+    FiniteDifferenceEngine stencils;
+    std::vector<FD_Greeks> greeks;
+    Benchmark_Run("FiniteDifferenceEngine::Greeks (per option)", scale, batch, [&](std::size_t iterations)
+    {
+        for(std::size_t k = 0; k < iterations; k++){stencils.Greeks(options, greeks);}
+        Sink = Sink + greeks[0].m_vanna;
+    });
+
+    // Chebyshev proxy against direct pricing, on the domain of the batch
+    ChebyshevProxy proxy([](const double& S, const double& Sig, const double& T){return BSExactPricingEngine::Call_Price_BS(S, 100.0, T, 0.05, Sig, 0.05);},
+        Chebyshev_Axis{80.0, 120.0, 3, 16}, Chebyshev_Axis{0.1, 0.5, 3, 16}, Chebyshev_Axis{0.1, 2.0, 3, 16});
+    Benchmark_Run("ChebyshevProxy::Price_Batch", 10*scale, batch, [&](std::size_t iterations)
+    {
+        for(std::size_t k = 0; k < iterations; k++){proxy.Price_Batch(columns.S.data(), columns.Sig.data(), columns.T.data(), results.data(), batch);}
+        Sink = Sink + results[0];
+    });
+
+    // Price cache: every request after the first pass is a hit
+    Price_Cache_Ticks ticks = {0.01, 0.0, 0.001, 0.0, 0.0001, 0.0};
+    PriceCache cache(ticks);
+    Benchmark_Run("PriceCache::Price (hits)", 10*scale, batch, [&](std::size_t iterations)
+    {
+        double sum = 0.0;
+        for(std::size_t k = 0; k < iterations; k++)
+        {
+            for(std::size_t i = 0; i < batch; i++)
+            {
+                const Param_Data& p = options[i];
+                sum += cache.Price(Model_Type::European, Option_Type::Call, p.m_S, p.m_K, p.m_T, p.m_R, p.m_Sig, p.m_B);
+            }
+        }
+        Sink = Sink + sum;
+    });
+
+    // Monte Carlo: arithmetic Asian call with 64 monitoring dates, reported in paths per second
+    Path_Option asian = {options[0], Option_Type::Call, Path_Payoff::Asian_Arithmetic, 0.0, 64};
+    const MonteCarloEngine sobol_paths(16384*scale, Path_Generator::Sobol, true, true, 42, 0);
+    const MonteCarloEngine random_paths(16384*scale, Path_Generator::Pseudo_Random, false, false, 42, 0);
+    double ns_sobol = Benchmark_Run("MonteCarloEngine Asian, Sobol+bridge+CV (path)", 1, sobol_paths.getPaths(), [&](std::size_t iterations)
+    {
+        for(std::size_t k = 0; k < iterations; k++){Sink = Sink + sobol_paths.Price(asian).m_price;}
+    });
+    std::printf("%-48s %12.0f paths/s\n", "", 1e9 / ns_sobol);
+    double ns_random = Benchmark_Run("MonteCarloEngine Asian, pseudo-random (path)", 1, random_paths.getPaths(), [&](std::size_t iterations)
+    {
+        for(std::size_t k = 0; k < iterations; k++){Sink = Sink + random_paths.Price(asian).m_price;}
+    });
+    std::printf("%-48s %12.0f paths/s\n", "", 1e9 / ns_random);
+    const MonteCarloEngine scrambled_paths(16384*scale, Path_Generator::Sobol_Scrambled, true, true, 42, 0);
+    double ns_scrambled = Benchmark_Run("MonteCarloEngine Asian, scrambled Sobol (path)", 1, scrambled_paths.getPaths(), [&](std::size_t iterations)
+    {
+        for(std::size_t k = 0; k < iterations; k++){Sink = Sink + scrambled_paths.Price(asian).m_price;}
+    });
+    std::printf("%-48s %12.0f paths/s\n", "", 1e9 / ns_scrambled);
+
+    // Heston by the COS method: a ladder of 128 strikes of one expiry, against the same strikes priced one at a time, reported per strike
+    const HestonEngine heston;
+    std::vector<double> ladder(128), ladder_prices;
+    for(std::size_t i = 0; i < ladder.size(); i++){ladder[i] = 60.0 + 80.0*double(i)/double(ladder.size() - 1);}
+    Benchmark_Run("HestonEngine::Price_Strikes (128 strikes, strike)", 10*scale, ladder.size(), [&](std::size_t iterations)
+    {
+        for(std::size_t k = 0; k < iterations; k++)
+        {
+            heston.Price_Strikes(Option_Type::Call, 100.0, 1.0, 0.05, 0.05, ladder, ladder_prices);
+        }
+        Sink = Sink + ladder_prices[0];
+    });
+    Benchmark_Run("HestonEngine::Call_Price (one strike at a time)", scale, ladder.size(), [&](std::size_t iterations)
+    {
+        double sum = 0.0;
+        for(std::size_t k = 0; k < iterations; k++)
+        {
+            for(std::size_t i = 0; i < ladder.size(); i++){sum += heston.Call_Price(Param_Data{100.0, ladder[i], 1.0, 0.05, 0.0, 0.05, 0.0});}
+        }
+        Sink = Sink + sum;
+    });
+
+    // Local volatility PDE: 60 European and American options (20 strikes, 3 expiries) from one backward sweep, one sweep per option, and one Dupire forward sweep
+    LocalVolEngine local_vol;
+    std::vector<LocalVol_Option> strip, strip_european;
+    for(std::size_t e = 0; e < 3; e++)
+    {
+        for(std::size_t j = 0; j < 20; j++)
+        {
+            const LocalVol_Option option = {80.0 + 2.0*double(j), 0.5*double(e + 1), Option_Type::Put, (j % 2) == 1};
+            strip.push_back(option);
+            strip_european.push_back(LocalVol_Option{option.m_K, option.m_T, option.m_optiontype, false});
+        }
+    }
+    std::vector<double> strip_prices;
+    Benchmark_Run("LocalVolEngine::Price_Backward (60 options)", scale, strip.size(), [&](std::size_t iterations)
+    {
+        for(std::size_t k = 0; k < iterations; k++){local_vol.Price_Backward(strip, 100.0, strip_prices);}
+        Sink = Sink + strip_prices[0];
+    });
+    Benchmark_Run("LocalVolEngine::Price_Backward (one per sweep)", scale, strip.size(), [&](std::size_t iterations)
+    {
+        for(std::size_t k = 0; k < iterations; k++)
+        {
+            for(std::size_t i = 0; i < strip.size(); i++)
+            {
+                local_vol.Price_Backward(std::vector<LocalVol_Option>(1, strip[i]), 100.0, strip_prices);
+                Sink = Sink + strip_prices[0];
+            }
+        }
+    });
+    Benchmark_Run("LocalVolEngine::Price_Forward (60 Europeans)", scale, strip_european.size(), [&](std::size_t iterations)
+    {
+        for(std::size_t k = 0; k < iterations; k++){local_vol.Price_Forward(strip_european, 100.0, strip_prices);}
+        Sink = Sink + strip_prices[0];
+    });
+
+    // Calibration to the implied vols of a Heston surface (15 strikes, 4 expiries): from default parameters, then warm-started after a 0.2 vol point shift,
+    // reported per Levenberg-Marquardt iteration
+    const TermStructure rate_curve(0.05), carry_curve(0.03);
+    const HestonEngine surface(Heston_Params{0.05, 2.0, 0.06, 0.6, -0.6});
+    std::vector<Vol_Quote> quotes;
+    for(std::size_t e = 0; e < 4; e++)
+    {
+        const double T = 0.25*double(1 << e);
+        std::vector<double> strikes, prices;
+        for(std::size_t j = 0; j < 15; j++){strikes.push_back(70.0 + 5.0*double(j));}
+        surface.Price_Strikes(Option_Type::Call, 100.0, T, 0.05, 0.03, strikes, prices);
+        for(std::size_t j = 0; j < strikes.size(); j++)
+        {
+            quotes.push_back(Vol_Quote{strikes[j], T, BSExactPricingEngine::Implied_Vol_BS(Option_Type::Call, prices[j], 100.0, strikes[j], T, 0.05, 0.03), 1.0});
+        }
+    }
+    std::vector<Vol_Quote> shifted = quotes;
+    for(std::size_t i = 0; i < shifted.size(); i++){shifted[i].m_vol += 0.002;}
+    auto Calibration_Print = [](const char* name, const Calibration_Report& report)
+    {
+        std::printf("%-48s %12.1f ns/op %14zu its\n", name, 1e9*report.m_seconds/double(std::max(report.m_iterations, std::size_t(1))), report.m_iterations);
+    };
+    for(std::size_t k = 0; k < scale; k++)
+    {
+        CalibrationEngine calibration;
+        const Calibration_Report svi_cold = calibration.Calibrate_SVI(quotes, 100.0, carry_curve);
+        const Calibration_Report svi_warm = calibration.Calibrate_SVI(shifted, 100.0, carry_curve);
+        const Calibration_Report heston_cold = calibration.Calibrate_Heston(quotes, 100.0, rate_curve, carry_curve);
+        const Calibration_Report heston_warm = calibration.Calibrate_Heston(shifted, 100.0, rate_curve, carry_curve);
+        if(k + 1 == scale)
+        {
+            Calibration_Print("CalibrationEngine::Calibrate_SVI (iteration)", svi_cold);
+            Calibration_Print("CalibrationEngine::Calibrate_SVI warm (iteration)", svi_warm);
+            Calibration_Print("CalibrationEngine::Calibrate_Heston (iteration)", heston_cold);
+            Calibration_Print("CalibrationEngine::Calibrate_Heston warm (iteration)", heston_warm);
+        }
+        Sink = Sink + heston_warm.m_rms_vol + svi_warm.m_rms_vol;
+    }
+
+    // Risk aggregation: full reduction, then incremental updates of 1% of the positions
+    const std::size_t positions = 100000;
+    std::vector<Risk_Bucket_Key> keys(positions);
+    std::vector<double> quantities(positions);
+    std::vector<Position_Greeks> position_greeks(positions);
+    const std::vector<double> expiry_edges = {0.25, 0.5, 1.0, 2.0};
+    for(std::size_t i = 0; i < positions; i++)
+    {
+        const Param_Data& p = options[i % batch];
+        Risk_Bucket_Key key = {std::uint32_t(i % 50), RiskAggregator::Bucket(p.m_T, expiry_edges), RiskAggregator::Bucket(p.m_K / p.m_S, expiry_edges)};
+        keys[i] = key;
+        quantities[i] = 1.0 + double(i % 7);
+        position_greeks[i] = RiskAggregator::From_BS(BSExactPricingEngine::Greeks_BS(p), Option_Type::Call);
+    }
+    RiskAggregator aggregator;
+    Benchmark_Run("RiskAggregator::Set_Positions (per position)", scale, positions, [&](std::size_t iterations)
+    {
+        for(std::size_t k = 0; k < iterations; k++){aggregator.Set_Positions(keys, quantities, position_greeks);}
+        Sink = Sink + aggregator.Total().m_delta;
+    });
+    std::vector<std::size_t> updated(positions / 100);
+    std::vector<Position_Greeks> updated_greeks(updated.size());
+    for(std::size_t i = 0; i < updated.size(); i++){updated[i] = i*100; updated_greeks[i] = position_greeks[i*100];}
+    Benchmark_Run("RiskAggregator::Update (per position)", 10*scale, updated.size(), [&](std::size_t iterations)
+    {
+        for(std::size_t k = 0; k < iterations; k++){aggregator.Update(updated, updated_greeks);}
+        Sink = Sink + aggregator.Total().m_delta;
+    });
+
+    return 0;
+}
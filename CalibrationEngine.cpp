@@ -0,0 +1,458 @@
+//CalibrationEngine.cpp
+//
+//Purpose: Calibration of volatility models to implied volatility quotes by the Levenberg-Marquardt method: raw SVI slices, one per expiry, with analytic
+//         Jacobians, and the Heston model, with finite-difference Jacobians. Residual evaluation is batched and multithreaded: SVI slices are calibrated in
+//         parallel, and each Heston iteration prices every expiry of the base and bumped parameter sets as one strike ladder of HestonEngine, those ladders
+//         being spread over the threads. Heston residuals are price differences scaled by the Black-Scholes vega of the quote, which approximates vol
+//         differences without inverting the model prices at every iteration; the market prices and vegas are computed once by the batch Black-Scholes path,
+//         and the final fit is reported in implied vols. Each calibration starts from the parameters of the previous one (warm start), which after a small
+//         move of the market converges in a few iterations, and reports its wall time per iteration.
+//
+//Modification date: 10/18/2026
+
+
+#include "CalibrationEngine.hpp"
+#include "BSExactPricingEngine.hpp"     // Market prices and vegas of the quotes, and implied vols of the calibrated prices
+#include "Parallel.hpp"
+#include <chrono>
+#include <cmath>        // For sqrt(), log(), fabs()
+#include <algorithm>    // For std::sort(), std::min(), std::max()
+#include <stdexcept>
+
+static const std::size_t SVI_Size = 5;
+static const std::size_t Heston_Size = 5;
+
+
+// Quotes grouped by distinct expiry: positions of the quotes of expiry e are order[start[e]] to order[start[e+1]-1]
+struct Expiry_Groups
+{
+    std::vector<double> m_expiries;
+    std::vector<std::size_t> m_start, m_order;
+};
+
+static Expiry_Groups Group_By_Expiry(const std::vector<Vol_Quote>& quotes)
+{
+    Expiry_Groups groups;
+    groups.m_order.resize(quotes.size());
+    for(std::size_t i = 0; i < quotes.size(); i++)
+    {
+        if(!(quotes[i].m_T > 0.0) || !(quotes[i].m_K > 0.0) || !(quotes[i].m_vol > 0.0)){throw std::invalid_argument("Error: calibration quotes need positive K, T and vol.");}
+        groups.m_order[i] = i;
+    }
+    std::stable_sort(groups.m_order.begin(), groups.m_order.end(), [&](const std::size_t& i, const std::size_t& j){return quotes[i].m_T < quotes[j].m_T;});
+    for(std::size_t j = 0; j < quotes.size(); j++)
+    {
+        const double T = quotes[groups.m_order[j]].m_T;
+        if(groups.m_expiries.empty() || T != groups.m_expiries.back())
+        {
+            groups.m_expiries.push_back(T);
+            groups.m_start.push_back(j);
+        }
+    }
+    groups.m_start.push_back(quotes.size());
+    return groups;
+}
+
+// Solution of the symmetric positive definite system M x = y by Cholesky factorization, false if M is not positive definite
+static bool Cholesky_Solve(std::vector<double> M, std::vector<double>& x, const std::vector<double>& y)
+{
+    const std::size_t n = y.size();
+    for(std::size_t j = 0; j < n; j++)
+    {
+        double diagonal = M[j*n + j];
+        for(std::size_t k = 0; k < j; k++){diagonal -= M[j*n + k]*M[j*n + k];}
+        if(!(diagonal > 0.0)){return false;}
+        M[j*n + j] = sqrt(diagonal);
+        for(std::size_t i = j + 1; i < n; i++)
+        {
+            double value = M[i*n + j];
+            for(std::size_t k = 0; k < j; k++){value -= M[i*n + k]*M[j*n + k];}
+            M[i*n + j] = value / M[j*n + j];
+        }
+    }
+    x = y;
+    for(std::size_t i = 0; i < n; i++)
+    {
+        for(std::size_t k = 0; k < i; k++){x[i] -= M[i*n + k]*x[k];}
+        x[i] /= M[i*n + i];
+    }
+    for(std::size_t i = n; i-- > 0;)
+    {
+        for(std::size_t k = i + 1; k < n; k++){x[i] -= M[k*n + i]*x[k];}
+        x[i] /= M[i*n + i];
+    }
+    return true;
+}
+
+static double Sum_Of_Squares(const std::vector<double>& residuals)
+{
+    double sum = 0.0;
+    for(std::size_t i = 0; i < residuals.size(); i++){sum += residuals[i]*residuals[i];}
+    return sum;
+}
+
+
+//Default constructor
+CalibrationEngine::CalibrationEngine(): CalibrationEngine(50, 1e-10, 0)
+{
+    //std::cout << "Default constructor in CalibrationEngine used." << std::endl;
+}
+
+//Overloaded constructor
+CalibrationEngine::CalibrationEngine(const std::size_t& max_iterations, const double& tolerance, const unsigned& threads): m_max_iterations(max_iterations),
+    m_tolerance(tolerance), m_threads(threads), m_svi(), m_heston(HestonEngine().getHeston())
+{
+    if(max_iterations == 0){throw std::invalid_argument("Error: calibration requires at least one iteration.");}
+    //std::cout << "Overloaded constructor in CalibrationEngine used." << std::endl;
+}
+
+//Copy constructor
+CalibrationEngine::CalibrationEngine(const CalibrationEngine& source): m_max_iterations(source.m_max_iterations), m_tolerance(source.m_tolerance),
+    m_threads(source.m_threads), m_svi(source.m_svi), m_heston(source.m_heston)
+{
+    //std::cout << "Copy constructor in CalibrationEngine used." << std::endl;
+}
+
+//Destructor
+CalibrationEngine::~CalibrationEngine()
+{
+    //std::cout << "Destructor in CalibrationEngine used." << std::endl;
+}
+
+//Assignment operator
+CalibrationEngine& CalibrationEngine::operator = (const CalibrationEngine& source)
+{
+    if (this == &source)    // Checking for self-assignment
+    {
+        return *this;
+    }
+    else
+    {
+        m_max_iterations = source.m_max_iterations;
+        m_tolerance = source.m_tolerance;
+        m_threads = source.m_threads;
+        m_svi = source.m_svi;
+        m_heston = source.m_heston;
+        return *this;
+    }
+}
+
+
+//LEVENBERG-MARQUARDT
+
+Calibration_Report CalibrationEngine::Levenberg_Marquardt(const Residual_Function& residuals, const std::vector<double>& initial, const std::vector<double>& lower,
+    const std::vector<double>& upper, const std::size_t& max_iterations, const double& tolerance)
+{
+    const std::size_t n = initial.size();
+    if(lower.size() != n || upper.size() != n){throw std::invalid_argument("Error: calibration bounds are not of the size of the parameters.");}
+    auto project = [&](std::vector<double>& params){for(std::size_t j = 0; j < n; j++){params[j] = std::min(std::max(params[j], lower[j]), upper[j]);}};
+    const auto start = std::chrono::steady_clock::now();
+
+    Calibration_Report report = {initial, 0.0, 0, 0, 0.0, std::vector<double>(), false};
+    project(report.m_params);
+    std::vector<double> r, J, trial_r, JtJ(n*n), gradient(n), step(n), trial(n), scaled(n*n);
+    residuals(report.m_params, r, &J);
+    report.m_residual_evaluations++;
+    double cost = Sum_Of_Squares(r);
+    const std::size_t m = r.size();
+    double lambda = 1e-3;
+
+    while(report.m_iterations < max_iterations)
+    {
+        const auto iteration_start = std::chrono::steady_clock::now();
+
+        // Normal equations J'J and the gradient J'r
+        for(std::size_t a = 0; a < n; a++)
+        {
+            double g = 0.0;
+            for(std::size_t i = 0; i < m; i++){g += J[i*n + a]*r[i];}
+            gradient[a] = -g;
+            for(std::size_t b = 0; b <= a; b++)
+            {
+                double sum = 0.0;
+                for(std::size_t i = 0; i < m; i++){sum += J[i*n + a]*J[i*n + b];}
+                JtJ[a*n + b] = JtJ[b*n + a] = sum;
+            }
+        }
+
+        // Damped steps (J'J + lambda*diag(J'J)) step = -J'r, the damping growing until the sum of squares decreases
+        bool accepted = false;
+        double trial_cost = cost;
+        for(int attempt = 0; attempt < 20 && !accepted; attempt++)
+        {
+            scaled = JtJ;
+            for(std::size_t a = 0; a < n; a++){scaled[a*n + a] += lambda*std::max(JtJ[a*n + a], 1e-12);}
+            if(Cholesky_Solve(scaled, step, gradient))
+            {
+                for(std::size_t a = 0; a < n; a++){trial[a] = report.m_params[a] + step[a];}
+                project(trial);
+                residuals(trial, trial_r, nullptr);
+                report.m_residual_evaluations++;
+                trial_cost = Sum_Of_Squares(trial_r);
+                accepted = (trial_cost < cost);
+            }
+            lambda = accepted ? std::max(lambda/3.0, 1e-12) : lambda*4.0;
+        }
+        report.m_iterations++;
+
+        if(accepted)
+        {
+            const double decrease = (cost - trial_cost)/std::max(cost, 1e-300);
+            double largest_step = 0.0;      // Relative to the parameters, as for the step criterion of MINPACK
+            for(std::size_t a = 0; a < n; a++){largest_step = std::max(largest_step, std::fabs(trial[a] - report.m_params[a])/(std::fabs(trial[a]) + tolerance));}
+            report.m_params = trial;
+            cost = trial_cost;
+            residuals(report.m_params, r, &J);      // Jacobian at the new point, for the next iteration
+            report.m_residual_evaluations++;
+            report.m_iteration_seconds.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - iteration_start).count());
+            if(decrease < tolerance || largest_step < sqrt(tolerance)){report.m_converged = true; break;}
+        }
+        else    // No step decreases the sum of squares: a (possibly constrained) minimum only if the gradient vanishes, but for its components against a bound
+        {
+            // Gradient scaled to the relative change of the sum of squares per relative change of each parameter, so that the test does not depend on the
+            // units or the number of the residuals, against the same sqrt(tolerance) as the step criterion
+            report.m_iteration_seconds.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - iteration_start).count());
+            double largest_gradient = 0.0;
+            for(std::size_t a = 0; a < n; a++)
+            {
+                const bool blocked = (report.m_params[a] <= lower[a] && gradient[a] < 0.0) || (report.m_params[a] >= upper[a] && gradient[a] > 0.0);
+                const double scaled_gradient = std::fabs(gradient[a])*std::max(std::fabs(report.m_params[a]), 1.0)/std::max(cost, 1e-300);
+                if(!blocked){largest_gradient = std::max(largest_gradient, scaled_gradient);}
+            }
+            report.m_converged = (largest_gradient < sqrt(tolerance));
+            break;
+        }
+    }
+
+    report.m_rms_vol = (m > 0) ? sqrt(cost/double(m)) : 0.0;
+    report.m_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return report;
+}
+
+
+//SVI
+
+double CalibrationEngine::SVI_Vol(const SVI_Params& slice, const double& k)
+{
+    const double x = k - slice.m_m;
+    const double w = slice.m_a + slice.m_b*(slice.m_rho*x + sqrt(x*x + slice.m_sigma*slice.m_sigma));
+    return sqrt(std::max(w, 1e-12)/slice.m_T);
+}
+
+Calibration_Report CalibrationEngine::Calibrate_SVI(const std::vector<Vol_Quote>& quotes, const double& S, const TermStructure& carry_curve)
+{
+    const auto start = std::chrono::steady_clock::now();
+    const Expiry_Groups groups = Group_By_Expiry(quotes);
+    const std::size_t slices = groups.m_expiries.size();
+    std::vector<SVI_Params> result(slices);
+    std::vector<Calibration_Report> reports(slices);
+    const std::vector<double> lower = {-1.0, 1e-6, -0.999, -2.0, 1e-4}, upper = {4.0, 5.0, 0.999, 2.0, 5.0};
+
+    // Slices are independent: one Levenberg-Marquardt per slice, the slices spread over the threads
+    Parallel_For(slices, [&](std::size_t begin, std::size_t end, std::size_t)
+    {
+        for(std::size_t e = begin; e < end; e++)
+        {
+            const double T = groups.m_expiries[e];
+            const double F = S/carry_curve.DF(T);     // Forward S*exp(B*T)
+            const std::size_t first = groups.m_start[e], count = groups.m_start[e + 1] - first;
+            std::vector<double> k(count), vol(count), weight(count);
+            double atm_vol = quotes[groups.m_order[first]].m_vol, atm_distance = 1e300;
+            for(std::size_t j = 0; j < count; j++)
+            {
+                const Vol_Quote& quote = quotes[groups.m_order[first + j]];
+                k[j] = log(quote.m_K/F); vol[j] = quote.m_vol; weight[j] = quote.m_weight;
+                if(std::fabs(k[j]) < atm_distance){atm_distance = std::fabs(k[j]); atm_vol = quote.m_vol;}
+            }
+
+            // Warm start from the previous slice of this expiry, otherwise a flat smile at the ATM variance
+            std::vector<double> initial = {atm_vol*atm_vol*T - 0.1*0.1, 0.1, -0.3, 0.0, 0.1};
+            for(std::size_t p = 0; p < m_svi.size(); p++)
+            {
+                if(m_svi[p].m_T == T){initial = {m_svi[p].m_a, m_svi[p].m_b, m_svi[p].m_rho, m_svi[p].m_m, m_svi[p].m_sigma};}
+            }
+
+            // Residuals weight*(Sig(k) - vol), with the analytic derivatives of w(k) through dSig/dw = 1/(2*Sig*T)
+            auto residuals = [&](const std::vector<double>& params, std::vector<double>& r, std::vector<double>* jacobian)
+            {
+                const double a = params[0], b = params[1], rho = params[2], m = params[3], sigma = params[4];
+                r.resize(count);
+                if(jacobian != nullptr){jacobian->resize(count*SVI_Size);}
+                for(std::size_t j = 0; j < count; j++)
+                {
+                    const double x = k[j] - m, root = sqrt(x*x + sigma*sigma);
+                    const double w = std::max(a + b*(rho*x + root), 1e-12), model = sqrt(w/T);
+                    r[j] = weight[j]*(model - vol[j]);
+                    if(jacobian != nullptr)
+                    {
+                        const double scale = weight[j]/(2.0*model*T);
+                        double* row = &(*jacobian)[j*SVI_Size];
+                        row[0] = scale;
+                        row[1] = scale*(rho*x + root);
+                        row[2] = scale*b*x;
+                        row[3] = -scale*b*(rho + x/root);
+                        row[4] = scale*b*sigma/root;
+                    }
+                }
+            };
+            reports[e] = Levenberg_Marquardt(residuals, initial, lower, upper, m_max_iterations, m_tolerance);
+            const std::vector<double>& p = reports[e].m_params;
+            result[e] = SVI_Params{T, p[0], p[1], p[2], p[3], p[4]};
+        }
+    }, m_threads, 1);
+
+    // Report over all the slices
+    Calibration_Report report = {std::vector<double>(), 0.0, 0, 0, 0.0, std::vector<double>(), true};
+    double sum = 0.0;
+    for(std::size_t e = 0; e < slices; e++)
+    {
+        report.m_params.insert(report.m_params.end(), reports[e].m_params.begin(), reports[e].m_params.end());
+        const double count = double(groups.m_start[e + 1] - groups.m_start[e]);
+        sum += reports[e].m_rms_vol*reports[e].m_rms_vol*count;
+        report.m_iterations += reports[e].m_iterations;
+        report.m_residual_evaluations += reports[e].m_residual_evaluations;
+        report.m_iteration_seconds.push_back(reports[e].m_seconds/double(std::max(reports[e].m_iterations, std::size_t(1))));
+        report.m_converged = report.m_converged && reports[e].m_converged;
+    }
+    report.m_rms_vol = quotes.empty() ? 0.0 : sqrt(sum/double(quotes.size()));
+    report.m_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    m_svi = result;
+    return report;
+}
+
+
+//HESTON
+
+Calibration_Report CalibrationEngine::Calibrate_Heston(const std::vector<Vol_Quote>& quotes, const double& S, const TermStructure& rate_curve,
+    const TermStructure& carry_curve)
+{
+    const auto start = std::chrono::steady_clock::now();
+    const Expiry_Groups groups = Group_By_Expiry(quotes);
+    const std::size_t slices = groups.m_expiries.size(), size = quotes.size();
+
+    // Quotes in expiry order, with their market call prices and vegas from the batch Black-Scholes path
+    std::vector<double> T(size), K(size), Sig(size), S_batch(size, S), weight(size), market, vega(size);
+    for(std::size_t j = 0; j < size; j++)
+    {
+        const Vol_Quote& quote = quotes[groups.m_order[j]];
+        T[j] = quote.m_T; K[j] = quote.m_K; Sig[j] = quote.m_vol; weight[j] = quote.m_weight;
+    }
+    const DiscountCache cache(T, rate_curve, carry_curve);
+    BSExactPricingEngine::Price_BS_Batch(Option_Type::Call, S_batch, K, Sig, cache, market);
+    std::vector<double> R(slices), B(slices);
+    for(std::size_t e = 0; e < slices; e++)
+    {
+        R[e] = rate_curve.Rate(groups.m_expiries[e]);
+        B[e] = carry_curve.Rate(groups.m_expiries[e]);
+        for(std::size_t j = groups.m_start[e]; j < groups.m_start[e + 1]; j++)
+        {
+            // Vega floored, so that far wings with no vega do not dominate the fit
+            vega[j] = std::max(BSExactPricingEngine::Vega_BS(S, K[j], T[j], R[e], Sig[j], B[e]), 1e-3*S*sqrt(T[j]));
+        }
+    }
+
+    // Model prices of several parameter sets: every (set, expiry) pair is one strike ladder, and the ladders are spread over the threads
+    auto model_prices = [&](const std::vector<std::vector<double>>& sets, std::vector<std::vector<double>>& prices)
+    {
+        prices.assign(sets.size(), std::vector<double>(size, 0.0));
+        Parallel_For(sets.size()*slices, [&](std::size_t begin, std::size_t end, std::size_t)
+        {
+            std::vector<double> strikes, ladder;
+            for(std::size_t task = begin; task < end; task++)
+            {
+                const std::size_t s = task / slices, e = task % slices;
+                const std::vector<double>& p = sets[s];
+                const HestonEngine engine(Heston_Params{p[0], p[1], p[2], p[3], p[4]});
+                strikes.assign(K.begin() + groups.m_start[e], K.begin() + groups.m_start[e + 1]);
+                engine.Price_Strikes(Option_Type::Call, S, groups.m_expiries[e], R[e], B[e], strikes, ladder);
+                std::copy(ladder.begin(), ladder.end(), prices[s].begin() + groups.m_start[e]);
+            }
+        }, m_threads, 1);
+    };
+
+    // Residuals weight*(model - market)/vega, the Jacobian by forward differences priced in the same parallel batch as the residuals
+    const std::vector<double> lower = {1e-4, 1e-2, 1e-4, 1e-2, -0.999}, upper = {2.0, 20.0, 2.0, 5.0, 0.999};
+    std::vector<std::vector<double>> sets, prices;
+    auto residuals = [&](const std::vector<double>& params, std::vector<double>& r, std::vector<double>* jacobian)
+    {
+        sets.assign(1, params);
+        std::vector<double> steps;
+        if(jacobian != nullptr)
+        {
+            for(std::size_t a = 0; a < Heston_Size; a++)
+            {
+                double h = 1e-5*std::max(std::fabs(params[a]), 1e-2);
+                if(params[a] + h > upper[a]){h = -h;}
+                steps.push_back(h);
+                sets.push_back(params);
+                sets.back()[a] += h;
+            }
+        }
+        model_prices(sets, prices);
+        r.resize(size);
+        for(std::size_t j = 0; j < size; j++){r[j] = weight[j]*(prices[0][j] - market[j])/vega[j];}
+        if(jacobian != nullptr)
+        {
+            jacobian->resize(size*Heston_Size);
+            for(std::size_t j = 0; j < size; j++)
+            {
+                for(std::size_t a = 0; a < Heston_Size; a++)
+                {
+                    (*jacobian)[j*Heston_Size + a] = weight[j]*(prices[a + 1][j] - prices[0][j])/(vega[j]*steps[a]);
+                }
+            }
+        }
+    };
+
+    const std::vector<double> initial = {m_heston.m_v0, m_heston.m_kappa, m_heston.m_theta, m_heston.m_xi, m_heston.m_rho};
+    Calibration_Report report = Levenberg_Marquardt(residuals, initial, lower, upper, m_max_iterations, m_tolerance);
+    const std::vector<double>& p = report.m_params;
+    m_heston = Heston_Params{p[0], p[1], p[2], p[3], p[4]};
+
+    // Fit reported in implied vols of the calibrated prices (vega-scaled differences where the price has no implied vol)
+    sets.assign(1, p);
+    model_prices(sets, prices);
+    double sum = 0.0;
+    for(std::size_t e = 0; e < slices; e++)
+    {
+        for(std::size_t j = groups.m_start[e]; j < groups.m_start[e + 1]; j++)
+        {
+            double error;
+            try
+            {
+                error = BSExactPricingEngine::Implied_Vol_BS(Option_Type::Call, prices[0][j], S, K[j], T[j], R[e], B[e]) - Sig[j];
+            }
+            catch(const std::invalid_argument&)
+            {
+                error = (prices[0][j] - market[j])/vega[j];
+            }
+            sum += weight[j]*weight[j]*error*error;
+        }
+    }
+    report.m_rms_vol = (size > 0) ? sqrt(sum/double(size)) : 0.0;
+    report.m_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return report;
+}
+
+
+//GETTERS AND SETTERS
+
+std::vector<SVI_Params> const& CalibrationEngine::getSVI() const
+{
+    return m_svi;
+}
+
+Heston_Params const& CalibrationEngine::getHeston() const
+{
+    return m_heston;
+}
+
+void CalibrationEngine::setHeston(const Heston_Params& heston)
+{
+    m_heston = HestonEngine(heston).getHeston();    // Checked by the engine
+}
+
+void CalibrationEngine::Reset_SVI()
+{
+    m_svi.clear();
+}
@@ -0,0 +1,95 @@
+//CalibrationEngine.hpp
+//
+//Purpose: Calibration of volatility models to implied volatility quotes by the Levenberg-Marquardt method: raw SVI slices, one per expiry, with analytic
+//         Jacobians, and the Heston model, with finite-difference Jacobians. Residual evaluation is batched and multithreaded: SVI slices are calibrated in
+//         parallel, and each Heston iteration prices every expiry of the base and bumped parameter sets as one strike ladder of HestonEngine, those ladders
+//         being spread over the threads. Heston residuals are price differences scaled by the Black-Scholes vega of the quote, which approximates vol
+//         differences without inverting the model prices at every iteration; the market prices and vegas are computed once by the batch Black-Scholes path,
+//         and the final fit is reported in implied vols. Each calibration starts from the parameters of the previous one (warm start), which after a small
+//         move of the market converges in a few iterations, and reports its wall time per iteration.
+//
+//Modification date: 10/18/2026
+
+#ifndef CalibrationEngine_hpp
+#define CalibrationEngine_hpp
+
+#include "HestonEngine.hpp"     //Heston_Params, and the engine of the Heston residuals
+#include "TermStructure.hpp"    //Rate and carry curves of the quotes
+#include <vector>
+#include <functional>
+#include <cstddef>
+
+struct Vol_Quote
+{
+    double m_K;
+    double m_T;
+    double m_vol;           // Black-Scholes implied volatility
+    double m_weight;        // Weight of the residual, 1 by default
+};
+
+// Raw SVI total implied variance of one expiry: w(k) = a + b*(rho*(k - m) + sqrt((k - m)^2 + sigma^2)), with k = ln(K/F)
+struct SVI_Params
+{
+    double m_T;
+    double m_a, m_b, m_rho, m_m, m_sigma;
+};
+
+struct Calibration_Report
+{
+    std::vector<double> m_params;               // Calibrated parameters: Heston in the order of Heston_Params, SVI as a, b, rho, m, sigma of each slice by expiry
+    double m_rms_vol;                           // Root mean square of the weighted implied vol errors
+    std::size_t m_iterations;                   // Levenberg-Marquardt iterations (summed over the slices for SVI)
+    std::size_t m_residual_evaluations;         // Residual (and Jacobian) evaluations
+    double m_seconds;                           // Wall time of the calibration
+    std::vector<double> m_iteration_seconds;    // Wall time of each iteration (Heston), or mean wall time per iteration of each slice (SVI, slices running concurrently)
+    bool m_converged;
+};
+
+class CalibrationEngine
+{
+    public:
+        // Residuals of the parameters given (resized by the function), with the Jacobian, row-major (residuals x parameters), if jacobian is not null
+        typedef std::function<void(const std::vector<double>& params, std::vector<double>& residuals, std::vector<double>* jacobian)> Residual_Function;
+
+    private:
+        std::size_t m_max_iterations;
+        double m_tolerance;                 // Relative decrease of the sum of squares (or relative step, below its square root) at which the iterations stop
+        unsigned m_threads;                 // Number of threads, 0 for the number of hardware threads
+        std::vector<SVI_Params> m_svi;      // Previous SVI calibration, one slice per expiry, warm start of the next one
+        Heston_Params m_heston;             // Previous Heston calibration, warm start of the next one
+
+    public:
+    //CONSTRUCTORS AND DESTRUCTOR
+
+        CalibrationEngine();                                            // Default constructor: 50 iterations, tolerance 1e-10, all hardware threads
+        CalibrationEngine(const std::size_t& max_iterations, const double& tolerance, const unsigned& threads);    // Overloaded constructor
+        CalibrationEngine(const CalibrationEngine& source);             // Copy constructor
+        ~CalibrationEngine();                                           // Destructor
+        CalibrationEngine& operator = (const CalibrationEngine& source);    // Assignment operator
+
+    //CALIBRATION
+
+        // Levenberg-Marquardt minimization of the sum of squared residuals, with parameters kept within [lower, upper]. m_params of the report holds the minimum;
+        // m_converged is false when the iterations run out, or when no damped step decreases the sum of squares while the gradient, scaled by the parameters
+        // and the sum of squares, is not below sqrt(tolerance).
+        static Calibration_Report Levenberg_Marquardt(const Residual_Function& residuals, const std::vector<double>& initial, const std::vector<double>& lower,
+            const std::vector<double>& upper, const std::size_t& max_iterations, const double& tolerance);
+
+        // One SVI slice per distinct expiry of the quotes, warm-started from the previous slice of the same expiry if any. The slices are in log-moneyness to the
+        // forward S*exp(B*T), which only depends on the carry curve.
+        Calibration_Report Calibrate_SVI(const std::vector<Vol_Quote>& quotes, const double& S, const TermStructure& carry_curve);
+
+        // Heston parameters fitted to all the quotes, warm-started from the previous calibration
+        Calibration_Report Calibrate_Heston(const std::vector<Vol_Quote>& quotes, const double& S, const TermStructure& rate_curve, const TermStructure& carry_curve);
+
+        static double SVI_Vol(const SVI_Params& slice, const double& k);     // Implied vol of the slice at log-moneyness k = ln(K/F)
+
+    //GETTERS AND SETTERS
+        std::vector<SVI_Params> const& getSVI() const;
+        Heston_Params const& getHeston() const;
+
+        void setHeston(const Heston_Params& heston);        // Starting point of the next Heston calibration
+        void Reset_SVI();                                   // The next SVI calibration starts from default slices
+};
+
+#endif //CalibrationEngine_hpp
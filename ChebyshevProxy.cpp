@@ -0,0 +1,373 @@
+//ChebyshevProxy.cpp
+//
+//Purpose: Proxy pricer for expensive engines (finite-maturity American, Monte Carlo, PDE). The exact engine is sampled once on a tensor grid of Chebyshev points
+//         over (S, Sig, T), generated with Mesh_Generate_Chebyshev(), and queries are then answered by barycentric interpolation on that grid: no call to the engine
+//         and no allocation. Each axis may be split into uniform pieces with their own Chebyshev points, so that a query only locates its piece in O(1) and
+//         interpolates over (degree+1)^3 values: low degrees on several pieces keep queries in the tens of nanoseconds, while a single piece of high degree
+//         converges fastest on smooth prices. The strike, rate and cost of carry are fixed by the pricer.
+//         At build time, the engine is also called at the midpoints between Chebyshev points (in angle), where the interpolation error is largest, which gives
+//         an estimate of the maximum error over the domain. A fitted proxy can be saved to disk and loaded at startup without calling the engine again.
+//
+//Modification date: 10/18/2026
+
+
+#include "ChebyshevProxy.hpp"
+#include "Mesher.hpp"
+#include "Parallel.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstring>      // For std::memcmp
+#include <fstream>
+
+
+namespace
+{
+    const char Proxy_Magic[8] = {'C','H','E','B','P','R','X','\0'};    // First bytes of a saved proxy
+    const std::uint32_t Proxy_Version = 1;
+
+    template<typename Type>
+    void Write_Binary(std::ofstream& file, const Type* data, const std::size_t& count)
+    {
+        file.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(count * sizeof(Type)));
+    }
+
+    template<typename Type>
+    void Read_Binary(std::ifstream& file, Type* data, const std::size_t& count)
+    {
+        file.read(reinterpret_cast<char*>(data), static_cast<std::streamsize>(count * sizeof(Type)));
+        if(!file){throw std::invalid_argument("Error: Chebyshev proxy file truncated.");}
+    }
+}
+
+
+//Default constructor
+ChebyshevProxy::ChebyshevProxy(): m_S_axis{0.0, 0.0, 0, 0}, m_Sig_axis{0.0, 0.0, 0, 0}, m_T_axis{0.0, 0.0, 0, 0}, m_S_nodes(), m_Sig_nodes(), m_T_nodes(), m_values(),
+m_max_error(0.0), m_max_rel_error(0.0)
+{
+    //std::cout << "Default constructor in ChebyshevProxy used." << std::endl;
+}
+
+//Overloaded constructor
+ChebyshevProxy::ChebyshevProxy(const Pricer& pricer, const Chebyshev_Axis& S, const Chebyshev_Axis& Sig, const Chebyshev_Axis& T, const unsigned& threads)
+: m_S_axis(S), m_Sig_axis(Sig), m_T_axis(T), m_max_error(0.0), m_max_rel_error(0.0)
+{
+    Check_Axis(S);
+    Check_Axis(Sig);
+    Check_Axis(T);
+
+    m_S_nodes = Nodes(S);
+    m_Sig_nodes = Nodes(Sig);
+    m_T_nodes = Nodes(T);
+
+    // Sampling the exact engine on the grid, patch after patch (see m_values). One call per point, so chunks of a single point are allowed for expensive engines.
+    const std::size_t nS = S.m_degree + 1, nSig = Sig.m_degree + 1, nT = T.m_degree + 1, patch_size = nS * nSig * nT;
+    m_values.resize(m_S_nodes.size() * m_Sig_nodes.size() * m_T_nodes.size());
+    Parallel_For(m_values.size(), [&](std::size_t begin, std::size_t end, std::size_t)
+    {
+        for(std::size_t p = begin; p < end; p++)
+        {
+            std::size_t patch = p / patch_size, local = p % patch_size;
+            std::size_t pS = patch / (Sig.m_pieces * T.m_pieces), pSig = (patch / T.m_pieces) % Sig.m_pieces, pT = patch % T.m_pieces;
+            std::size_t i = local / (nSig * nT), j = (local / nT) % nSig, k = local % nT;
+            m_values[p] = pricer(m_S_nodes[pS * nS + i], m_Sig_nodes[pSig * nSig + j], m_T_nodes[pT * nT + k]);
+        }
+    }, threads, 1);
+
+    // Error estimate at the midpoints, reduced per chunk then over chunks
+    const std::vector<double> S_mid = Midpoints(S), Sig_mid = Midpoints(Sig), T_mid = Midpoints(T);
+    const std::size_t mSig = Sig_mid.size(), mT = T_mid.size(), checks = S_mid.size() * mSig * mT;
+    std::vector<double> chunk_error(Chunk_Count(checks, threads, 1), 0.0), chunk_rel_error(chunk_error.size(), 0.0);
+    Parallel_For(checks, [&](std::size_t begin, std::size_t end, std::size_t chunk)
+    {
+        for(std::size_t p = begin; p < end; p++)
+        {
+            double s = S_mid[p / (mSig * mT)], sig = Sig_mid[(p / mT) % mSig], t = T_mid[p % mT];
+            double exact = pricer(s, sig, t);
+            double error = std::fabs(Interpolate(s, sig, t) - exact);
+            if(!(error <= chunk_error[chunk])){chunk_error[chunk] = error;}     // NaN errors propagate into the estimate
+            if(std::fabs(exact) > 1e-4 && !(error / std::fabs(exact) <= chunk_rel_error[chunk])){chunk_rel_error[chunk] = error / std::fabs(exact);}
+        }
+    }, threads, 1);
+
+    for(std::size_t c = 0; c < chunk_error.size(); c++)
+    {
+        if(!(chunk_error[c] <= m_max_error)){m_max_error = chunk_error[c];}
+        if(!(chunk_rel_error[c] <= m_max_rel_error)){m_max_rel_error = chunk_rel_error[c];}
+    }
+}
+
+//Copy constructor
+ChebyshevProxy::ChebyshevProxy(const ChebyshevProxy& source): m_S_axis(source.m_S_axis), m_Sig_axis(source.m_Sig_axis), m_T_axis(source.m_T_axis),
+m_S_nodes(source.m_S_nodes), m_Sig_nodes(source.m_Sig_nodes), m_T_nodes(source.m_T_nodes),
+m_values(source.m_values), m_max_error(source.m_max_error), m_max_rel_error(source.m_max_rel_error)
+{
+    //std::cout << "Copy constructor in ChebyshevProxy used." << std::endl;
+}
+
+//Destructor
+ChebyshevProxy::~ChebyshevProxy()
+{
+    //std::cout << "Destructor in ChebyshevProxy used." << std::endl;
+}
+
+//Assignment operator
+ChebyshevProxy& ChebyshevProxy::operator = (const ChebyshevProxy& source)
+{
+    if (this == &source)    // Checking for self-assignment
+    {
+        return *this;
+    }
+    else
+    {
+        m_S_axis = source.m_S_axis;
+        m_Sig_axis = source.m_Sig_axis;
+        m_T_axis = source.m_T_axis;
+        m_S_nodes = source.m_S_nodes;
+        m_Sig_nodes = source.m_Sig_nodes;
+        m_T_nodes = source.m_T_nodes;
+        m_values = source.m_values;
+        m_max_error = source.m_max_error;
+        m_max_rel_error = source.m_max_rel_error;
+        return *this;
+    }
+}
+
+
+void ChebyshevProxy::Check_Axis(const Chebyshev_Axis& axis)
+{
+    if(!(axis.m_low < axis.m_high)){throw std::invalid_argument("Error: Chebyshev axis must have a lower bound below its upper bound.");}
+    if(axis.m_degree > Max_Degree){throw std::invalid_argument("Error: Chebyshev axis degree is above the maximum degree.");}
+    if(axis.m_pieces == 0){throw std::invalid_argument("Error: Chebyshev axis must have at least one piece.");}
+}
+
+std::vector<double> ChebyshevProxy::Nodes(const Chebyshev_Axis& axis)
+{
+    std::vector<double> nodes;
+    nodes.reserve(axis.m_pieces * (axis.m_degree + 1));
+    const double width = (axis.m_high - axis.m_low) / static_cast<double>(axis.m_pieces);
+    for(std::size_t p = 0; p < axis.m_pieces; p++)
+    {
+        double low = axis.m_low + width * static_cast<double>(p);
+        double high = (p + 1 == axis.m_pieces) ? axis.m_high : low + width;    // The last piece ends exactly on the upper bound
+        std::vector<double> piece = Mesh_Generate_Chebyshev(low, high, axis.m_degree);
+        nodes.insert(nodes.end(), piece.begin(), piece.end());
+    }
+    return nodes;
+}
+
+std::vector<double> ChebyshevProxy::Midpoints(const Chebyshev_Axis& axis)
+{
+    const double pi = 3.14159265358979323846;
+    const double width = (axis.m_high - axis.m_low) / static_cast<double>(axis.m_pieces);
+    std::vector<double> points;
+    for(std::size_t p = 0; p < axis.m_pieces; p++)
+    {
+        double center = axis.m_low + width * (static_cast<double>(p) + 0.5);
+        if(axis.m_degree == 0)
+        {
+            points.push_back(center);
+            continue;
+        }
+        for(std::size_t j = 0; j < axis.m_degree; j++)
+        {
+            points.push_back(center - 0.5 * width * std::cos(pi * (static_cast<double>(j) + 0.5) / static_cast<double>(axis.m_degree)));
+        }
+    }
+    return points;
+}
+
+double ChebyshevProxy::Barycentric_Terms(const double& x, const Chebyshev_Axis& axis, const std::vector<double>& nodes, double* terms, std::size_t& first)
+{
+    const std::size_t n = axis.m_degree + 1;
+    std::size_t piece = static_cast<std::size_t>((x - axis.m_low) * static_cast<double>(axis.m_pieces) / (axis.m_high - axis.m_low));    // O(1) on uniform pieces
+    if(piece >= axis.m_pieces){piece = axis.m_pieces - 1;}     // x on the upper bound
+    first = piece * n;
+    const double* piece_nodes = nodes.data() + first;
+
+    double sum = 0.0, sign = 1.0;
+    for(std::size_t i = 0; i < n; i++, sign = -sign)
+    {
+        double difference = x - piece_nodes[i];
+        if(difference == 0.0)   // On a node, the interpolant is the value at that node
+        {
+            for(std::size_t j = 0; j < n; j++){terms[j] = 0.0;}
+            terms[i] = 1.0;
+            return 1.0;
+        }
+        terms[i] = ((i == 0 || i == n - 1) ? 0.5 * sign : sign) / difference;
+        sum += terms[i];
+    }
+    return sum;
+}
+
+double ChebyshevProxy::Interpolate(const double& S, const double& Sig, const double& T) const
+{
+    double S_terms[Max_Degree + 1], Sig_terms[Max_Degree + 1], T_terms[Max_Degree + 1];
+    std::size_t S_first, Sig_first, T_first;
+    const double denominator = Barycentric_Terms(S, m_S_axis, m_S_nodes, S_terms, S_first) * Barycentric_Terms(Sig, m_Sig_axis, m_Sig_nodes, Sig_terms, Sig_first)
+                             * Barycentric_Terms(T, m_T_axis, m_T_nodes, T_terms, T_first);
+
+    const std::size_t nS = m_S_axis.m_degree + 1, nSig = m_Sig_axis.m_degree + 1, nT = m_T_axis.m_degree + 1;
+    const std::size_t patch = ((S_first / nS) * m_Sig_axis.m_pieces + Sig_first / nSig) * m_T_axis.m_pieces + T_first / nT;
+    const double* values = m_values.data() + patch * nS * nSig * nT;   // Values of the patch, contiguous
+    // Contracting S and Sig first into one accumulator per T node: the accumulators are independent, so the loop is bound by throughput rather than by the
+    // latency of a single running sum, and vectorizes without reordering any sum
+    double accumulators[Max_Degree + 1];
+    for(std::size_t k = 0; k < nT; k++){accumulators[k] = 0.0;}
+    for(std::size_t i = 0; i < nS; i++)
+    {
+        for(std::size_t j = 0; j < nSig; j++)
+        {
+            const double weight = S_terms[i] * Sig_terms[j];
+            const double* row = values + (i * nSig + j) * nT;
+            for(std::size_t k = 0; k < nT; k++)
+            {
+                accumulators[k] += weight * row[k];
+            }
+        }
+    }
+    double sum = 0.0;
+    for(std::size_t k = 0; k < nT; k++)
+    {
+        sum += T_terms[k] * accumulators[k];
+    }
+    return sum / denominator;
+}
+
+
+bool ChebyshevProxy::Contains(const double& S, const double& Sig, const double& T) const
+{
+    return !m_values.empty() && S >= m_S_nodes.front() && S <= m_S_nodes.back() && Sig >= m_Sig_nodes.front() && Sig <= m_Sig_nodes.back()
+        && T >= m_T_nodes.front() && T <= m_T_nodes.back();
+}
+
+double ChebyshevProxy::Price(const double& S, const double& Sig, const double& T) const
+{
+    if(!Contains(S, Sig, T)){throw std::invalid_argument("Error: Point outside of the domain of the Chebyshev proxy.");}
+    return Interpolate(S, Sig, T);
+}
+
+void ChebyshevProxy::Price_Batch(const double* S, const double* Sig, const double* T, double* results, const std::size_t& size) const
+{
+    for(std::size_t i = 0; i < size; i++)
+    {
+        results[i] = Price(S[i], Sig[i], T[i]);
+    }
+}
+
+std::vector<double> ChebyshevProxy::Price(const std::vector<double>& S, const std::vector<double>& Sig, const std::vector<double>& T) const
+{
+    if(S.size() != Sig.size() || S.size() != T.size()){throw std::invalid_argument("Error: Vectors of S, Sig and T must be of the same size.");}
+    std::vector<double> results(S.size());
+    Price_Batch(S.data(), Sig.data(), T.data(), results.data(), S.size());
+    return results;
+}
+
+
+// Layout: magic, version, bounds of each axis (double), degree and pieces of each axis (uint32), error estimates, values. Nodes are regenerated on loading.
+// Native byte order, the file is a local startup cache.
+void ChebyshevProxy::Save(const std::string& path) const
+{
+    if(m_values.empty()){throw std::invalid_argument("Error: Cannot save an empty Chebyshev proxy.");}
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if(!file){throw std::invalid_argument("Error: Cannot open " + path + " for writing.");}
+
+    const Chebyshev_Axis* axes[3] = {&m_S_axis, &m_Sig_axis, &m_T_axis};
+    std::uint32_t version = Proxy_Version;
+    file.write(Proxy_Magic, sizeof(Proxy_Magic));
+    Write_Binary(file, &version, 1);
+    for(int a = 0; a < 3; a++)
+    {
+        double bounds[2] = {axes[a]->m_low, axes[a]->m_high};
+        std::uint32_t sizes[2] = {static_cast<std::uint32_t>(axes[a]->m_degree), static_cast<std::uint32_t>(axes[a]->m_pieces)};
+        Write_Binary(file, bounds, 2);
+        Write_Binary(file, sizes, 2);
+    }
+    double errors[2] = {m_max_error, m_max_rel_error};
+    Write_Binary(file, errors, 2);
+    Write_Binary(file, m_values.data(), m_values.size());
+    if(!file){throw std::invalid_argument("Error: Failed writing " + path + ".");}
+}
+
+ChebyshevProxy ChebyshevProxy::Load(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if(!file){throw std::invalid_argument("Error: Cannot open " + path + " for reading.");}
+
+    char magic[sizeof(Proxy_Magic)];
+    Read_Binary(file, magic, sizeof(magic));
+    if(std::memcmp(magic, Proxy_Magic, sizeof(Proxy_Magic)) != 0){throw std::invalid_argument("Error: " + path + " is not a Chebyshev proxy file.");}
+    std::uint32_t version;
+    Read_Binary(file, &version, 1);
+    if(version != Proxy_Version){throw std::invalid_argument("Error: Unsupported Chebyshev proxy file version.");}
+
+    ChebyshevProxy proxy;
+    Chebyshev_Axis* axes[3] = {&proxy.m_S_axis, &proxy.m_Sig_axis, &proxy.m_T_axis};
+    for(int a = 0; a < 3; a++)
+    {
+        double bounds[2];
+        std::uint32_t sizes[2];
+        Read_Binary(file, bounds, 2);
+        Read_Binary(file, sizes, 2);
+        *axes[a] = Chebyshev_Axis{bounds[0], bounds[1], sizes[0], sizes[1]};
+        Check_Axis(*axes[a]);
+    }
+    proxy.m_S_nodes = Nodes(proxy.m_S_axis);
+    proxy.m_Sig_nodes = Nodes(proxy.m_Sig_axis);
+    proxy.m_T_nodes = Nodes(proxy.m_T_axis);
+
+    double errors[2];
+    Read_Binary(file, errors, 2);
+    proxy.m_max_error = errors[0];
+    proxy.m_max_rel_error = errors[1];
+    proxy.m_values.resize(proxy.m_S_nodes.size() * proxy.m_Sig_nodes.size() * proxy.m_T_nodes.size());
+    Read_Binary(file, proxy.m_values.data(), proxy.m_values.size());
+    return proxy;
+}
+
+
+//GETTERS
+double ChebyshevProxy::getMaxError() const
+{
+    return m_max_error;
+}
+
+double ChebyshevProxy::getMaxRelError() const
+{
+    return m_max_rel_error;
+}
+
+std::vector<double> const& ChebyshevProxy::getNodes_S() const
+{
+    return m_S_nodes;
+}
+
+std::vector<double> const& ChebyshevProxy::getNodes_Sig() const
+{
+    return m_Sig_nodes;
+}
+
+std::vector<double> const& ChebyshevProxy::getNodes_T() const
+{
+    return m_T_nodes;
+}
+
+Chebyshev_Axis const& ChebyshevProxy::getAxis_S() const
+{
+    return m_S_axis;
+}
+
+Chebyshev_Axis const& ChebyshevProxy::getAxis_Sig() const
+{
+    return m_Sig_axis;
+}
+
+Chebyshev_Axis const& ChebyshevProxy::getAxis_T() const
+{
+    return m_T_axis;
+}
+
+std::size_t ChebyshevProxy::size() const
+{
+    return m_values.size();
+}
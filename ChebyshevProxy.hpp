@@ -0,0 +1,92 @@
+//ChebyshevProxy.hpp
+//
+//Purpose: Proxy pricer for expensive engines (finite-maturity American, Monte Carlo, PDE). The exact engine is sampled once on a tensor grid of Chebyshev points
+//         over (S, Sig, T), generated with Mesh_Generate_Chebyshev(), and queries are then answered by barycentric interpolation on that grid: no call to the engine
+//         and no allocation. Each axis may be split into uniform pieces with their own Chebyshev points, so that a query only locates its piece in O(1) and
+//         interpolates over (degree+1)^3 values: low degrees on several pieces keep queries in the tens of nanoseconds, while a single piece of high degree
+//         converges fastest on smooth prices. The strike, rate and cost of carry are fixed by the pricer.
+//         At build time, the engine is also called at the midpoints between Chebyshev points (in angle), where the interpolation error is largest, which gives
+//         an estimate of the maximum error over the domain. A fitted proxy can be saved to disk and loaded at startup without calling the engine again.
+//
+//Modification date: 10/18/2026
+
+#ifndef ChebyshevProxy_hpp
+#define ChebyshevProxy_hpp
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+
+// One axis of the proxy: interval [m_low, m_high], split into m_pieces uniform pieces, each with m_degree + 1 Chebyshev points
+struct Chebyshev_Axis
+{
+    double m_low;
+    double m_high;
+    std::size_t m_degree;
+    std::size_t m_pieces;
+};
+
+class ChebyshevProxy
+{
+    public:
+        typedef std::function<double(const double& S, const double& Sig, const double& T)> Pricer;    // Exact engine, with K, R and B captured by the caller
+
+        static const std::size_t Max_Degree = 64;   // Upper bound on the degree of a piece, so that barycentric terms fit on the stack
+
+    private:
+        Chebyshev_Axis m_S_axis;            // Domain, degree and pieces in S
+        Chebyshev_Axis m_Sig_axis;          // Domain, degree and pieces in Sig
+        Chebyshev_Axis m_T_axis;            // Domain, degree and pieces in T
+        std::vector<double> m_S_nodes;      // Chebyshev points in S, piece after piece: piece p holds m_S_nodes[p * (degree+1) ... (p+1) * (degree+1) - 1]
+        std::vector<double> m_Sig_nodes;    // Chebyshev points in Sig, same layout
+        std::vector<double> m_T_nodes;      // Chebyshev points in T, same layout
+        std::vector<double> m_values;       // Prices of the exact engine on the grid, patch after patch (a patch is one piece of each axis, patches row-major in S, Sig, T),
+                                            // and row-major within a patch, so that a query reads (degree+1)^3 contiguous values
+        double m_max_error;                 // Largest absolute error found at the midpoints when the proxy was built
+        double m_max_rel_error;             // Largest relative error found at the midpoints, over prices above 1e-4
+
+        // Barycentric terms w_i/(x - x_i) over the piece containing x, with w_i = (-1)^i halved at both ends. Returns their sum and stores the index of the first
+        // node of the piece; on a node, terms are 1 at that node and 0 elsewhere.
+        static double Barycentric_Terms(const double& x, const Chebyshev_Axis& axis, const std::vector<double>& nodes, double* terms, std::size_t& first);
+        static void Check_Axis(const Chebyshev_Axis& axis);
+        static std::vector<double> Nodes(const Chebyshev_Axis& axis);      // Chebyshev points of every piece of an axis
+        static std::vector<double> Midpoints(const Chebyshev_Axis& axis);  // Midpoints in angle between the Chebyshev points of every piece, where the error peaks
+        double Interpolate(const double& S, const double& Sig, const double& T) const;     // Interpolation without domain check
+
+    public:
+    //CONSTRUCTORS AND DESTRUCTOR
+
+        ChebyshevProxy();                                   // Default constructor: empty proxy, Price() throws until a proxy is built or loaded
+        // Overloaded constructor: samples the pricer on the Chebyshev grid and at the midpoints. With threads > 1, the pricer is called concurrently and must be thread-safe.
+        ChebyshevProxy(const Pricer& pricer, const Chebyshev_Axis& S, const Chebyshev_Axis& Sig, const Chebyshev_Axis& T, const unsigned& threads = 1);
+        ChebyshevProxy(const ChebyshevProxy& source);       // Copy constructor
+        ~ChebyshevProxy();                                  // Destructor
+        ChebyshevProxy& operator = (const ChebyshevProxy& source);  // Assignment operator
+
+    //PRICING
+
+        bool Contains(const double& S, const double& Sig, const double& T) const;  // True if the point is within the domain of the proxy
+        double Price(const double& S, const double& Sig, const double& T) const;     // Interpolated price, throws outside of the domain
+        void Price_Batch(const double* S, const double* Sig, const double* T, double* results, const std::size_t& size) const;   // Batch prices into a caller-provided buffer
+        std::vector<double> Price(const std::vector<double>& S, const std::vector<double>& Sig, const std::vector<double>& T) const;    // Batch prices for vectors of the same size
+
+    //SERIALIZATION
+
+        void Save(const std::string& path) const;           // Binary file: header, axes, error estimates and values
+        static ChebyshevProxy Load(const std::string& path);    // Throws if the file is missing, truncated or of another format
+
+    //GETTERS
+        double getMaxError() const;                         // Estimated maximum absolute error over the domain
+        double getMaxRelError() const;                      // Estimated maximum relative error over the domain
+        std::vector<double> const& getNodes_S() const;
+        std::vector<double> const& getNodes_Sig() const;
+        std::vector<double> const& getNodes_T() const;
+        Chebyshev_Axis const& getAxis_S() const;
+        Chebyshev_Axis const& getAxis_Sig() const;
+        Chebyshev_Axis const& getAxis_T() const;
+        std::size_t size() const;                           // Number of grid points, i.e. of calls to the exact engine on the grid
+};
+
+#endif //ChebyshevProxy_hpp
@@ -0,0 +1,380 @@
+//ColumnarFile.cpp
+//
+//Purpose: Binary columnar export of grids and results (mesh, parameter columns, result columns), so that large Matrix runs leave the process without text
+//         formatting and downstream tools load them without parsing. The layout follows Arrow: one contiguous buffer per column, each starting on a 64-byte
+//         boundary of the file, little-endian, with a fixed-size directory of the columns (name, encoding, offset, size) written after the data and pointed at
+//         by the header, so that the file is written in one pass. Plain columns are raw float64 (or float32) arrays, which a reader maps and uses in place.
+//         Two optional encodings compress the columns:
+//           - Delta: lossless. The 64-bit patterns of successive values are differenced twice, zigzag-encoded and written as LEB128 varints. Constant columns
+//             (the parameters a grid does not vary) and uniform meshes then take about one byte per value.
+//           - Float32: lossy, values rounded to float (about 7 significant digits), half the size of float64.
+//         The writer accumulates the file in a buffer and writes it by large blocks, under a temporary name renamed onto the final one once complete; the
+//         reader maps the file.
+//
+//         Layout: header (64 bytes) | column buffers, each 64-byte aligned | directory (64 bytes per column)
+//           header:    magic "OPTCOLS1", uint32 version, uint32 byte-order mark 0x01020304, uint64 rows, uint64 columns, uint64 directory offset, padding
+//           directory: name (40 bytes, NUL-padded), uint32 encoding, uint32 reserved, uint64 offset, uint64 size in bytes
+//
+//Modification date: 10/18/2026
+
+
+#include "ColumnarFile.hpp"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>    // For std::min
+#include <cerrno>
+#include <cstring>      // For std::memcpy, std::memcmp
+#include <stdexcept>
+
+static const char Columnar_Magic[8] = {'O', 'P', 'T', 'C', 'O', 'L', 'S', '1'};
+static const std::uint32_t Columnar_Version = 1;
+static const std::uint32_t Byte_Order_Mark = 0x01020304;    // Read back as 0x04030201 on a machine of the other endianness
+static const std::size_t Columnar_Alignment = 64;
+
+struct Columnar_Header
+{
+    char m_magic[8];
+    std::uint32_t m_version;
+    std::uint32_t m_byte_order;
+    std::uint64_t m_rows;
+    std::uint64_t m_columns;
+    std::uint64_t m_directory_offset;
+    unsigned char m_padding[24];
+};
+
+struct Column_Entry
+{
+    char m_name[40];
+    std::uint32_t m_encoding;
+    std::uint32_t m_reserved;
+    std::uint64_t m_offset;
+    std::uint64_t m_bytes;
+};
+
+static_assert(sizeof(Columnar_Header) == 64 && sizeof(Column_Entry) == 64, "The header and the directory entries of columnar files are 64 bytes each");
+
+
+// Delta encoding: second difference of the bit patterns (wrapping), zigzag so that small negative differences stay small, then LEB128 (7 bits per byte)
+static void Delta_Encode(const double* values, const std::size_t& size, std::vector<unsigned char>& bytes)
+{
+    bytes.clear();
+    bytes.reserve(size + 16);
+    std::uint64_t previous = 0, previous_difference = 0;
+    for(std::size_t i = 0; i < size; i++)
+    {
+        std::uint64_t bits;
+        std::memcpy(&bits, &values[i], sizeof(bits));
+        const std::uint64_t difference = bits - previous;
+        const std::uint64_t second = difference - previous_difference;
+        previous = bits;
+        previous_difference = difference;
+
+        std::uint64_t zigzag = (second << 1) ^ static_cast<std::uint64_t>(static_cast<std::int64_t>(second) >> 63);
+        while(zigzag >= 0x80)
+        {
+            bytes.push_back(static_cast<unsigned char>(zigzag | 0x80));
+            zigzag >>= 7;
+        }
+        bytes.push_back(static_cast<unsigned char>(zigzag));
+    }
+}
+
+static void Delta_Decode(const unsigned char* bytes, const std::size_t& size, const std::size_t& rows, double* values)
+{
+    std::size_t position = 0;
+    std::uint64_t previous = 0, previous_difference = 0;
+    for(std::size_t i = 0; i < rows; i++)
+    {
+        std::uint64_t zigzag = 0;
+        for(unsigned shift = 0; ; shift += 7)
+        {
+            if(position >= size || shift > 63){throw std::invalid_argument("Error: Delta-encoded column is corrupted.");}
+            const unsigned char byte = bytes[position++];
+            zigzag |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if((byte & 0x80) == 0){break;}
+        }
+        const std::uint64_t second = (zigzag >> 1) ^ (~(zigzag & 1) + 1);
+        previous_difference += second;
+        previous += previous_difference;
+        std::memcpy(&values[i], &previous, sizeof(previous));
+    }
+}
+
+
+//Overloaded constructor
+ColumnarWriter::ColumnarWriter(const std::string& path, const std::size_t& rows, const std::size_t& buffer_bytes): m_path(path), m_fd(-1), m_rows(rows),
+    m_offset(0), m_buffer(), m_buffer_bytes((buffer_bytes < Columnar_Alignment) ? Columnar_Alignment : buffer_bytes), m_directory()
+{
+    // Written under a temporary name, renamed onto path by Close(): until then a previous file at path is left as it was
+    m_fd = ::open(Temporary_Path().c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if(m_fd < 0){throw std::invalid_argument("Error: Cannot create columnar file " + Temporary_Path() + ".");}
+    m_buffer.reserve(m_buffer_bytes);
+
+    const Columnar_Header header = {};     // Placeholder, completed by Close()
+    Append(&header, sizeof(header));
+    //std::cout << "Overloaded constructor in ColumnarWriter used." << std::endl;
+}
+
+//Destructor
+ColumnarWriter::~ColumnarWriter()
+{
+    // Only Close() completes the file: a writer destroyed without it (an export interrupted by an exception, during stack unwinding) removes its temporary
+    // file, and the file at the final path, if any, is untouched
+    if(m_fd >= 0)
+    {
+        ::close(m_fd);
+        ::unlink(Temporary_Path().c_str());
+    }
+    //std::cout << "Destructor in ColumnarWriter used." << std::endl;
+}
+
+
+void ColumnarWriter::Append(const void* data, const std::size_t& size)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    std::size_t written = 0;
+    while(written < size)
+    {
+        const std::size_t chunk = std::min(size - written, m_buffer_bytes - m_buffer.size());
+        m_buffer.insert(m_buffer.end(), bytes + written, bytes + written + chunk);
+        written += chunk;
+        if(m_buffer.size() >= m_buffer_bytes){Flush();}
+    }
+}
+
+void ColumnarWriter::Align()
+{
+    static const unsigned char zeros[Columnar_Alignment] = {};
+    const std::size_t end = static_cast<std::size_t>(m_offset) + m_buffer.size();
+    Append(zeros, (Columnar_Alignment - end % Columnar_Alignment) % Columnar_Alignment);
+}
+
+void ColumnarWriter::Flush()
+{
+    std::size_t written = 0;
+    while(written < m_buffer.size())
+    {
+        const ssize_t result = ::write(m_fd, m_buffer.data() + written, m_buffer.size() - written);
+        if(result < 0 && errno == EINTR){continue;}
+        if(result <= 0){throw std::runtime_error("Error: Cannot write columnar file " + m_path + ".");}
+        written += static_cast<std::size_t>(result);
+    }
+    m_offset += m_buffer.size();
+    m_buffer.clear();
+}
+
+
+//COLUMNS
+
+void ColumnarWriter::Start_Column(const std::string& name, const Column_Encoding& encoding)
+{
+    if(m_fd < 0){throw std::invalid_argument("Error: Columnar file " + m_path + " is closed.");}
+    Column_Entry entry = {};
+    if(name.empty() || name.size() >= sizeof(entry.m_name)){throw std::invalid_argument("Error: Column names have 1 to 39 characters.");}
+    for(std::size_t c = 0; c < m_directory.size(); c++)
+    {
+        if(name == m_directory[c].m_name){throw std::invalid_argument("Error: Column " + name + " is already in the file.");}
+    }
+
+    Align();
+    std::memcpy(entry.m_name, name.data(), name.size());
+    entry.m_encoding = static_cast<std::uint32_t>(encoding);
+    entry.m_offset = m_offset + m_buffer.size();
+    m_directory.push_back(entry);
+}
+
+void ColumnarWriter::Add_Column(const std::string& name, const double* values, const Column_Encoding& encoding)
+{
+    if(encoding != Column_Encoding::Plain && encoding != Column_Encoding::Float32 && encoding != Column_Encoding::Delta)
+    {
+        throw std::invalid_argument("Error: Unknown column encoding.");
+    }
+    Start_Column(name, encoding);
+    const std::size_t size = static_cast<std::size_t>(m_rows);
+    if(encoding == Column_Encoding::Plain)
+    {
+        Append(values, size * sizeof(double));
+    }
+    else if(encoding == Column_Encoding::Float32)
+    {
+        float block[1024];      // Converted by blocks, so that no copy of the column is allocated
+        for(std::size_t i = 0; i < size; i += 1024)
+        {
+            const std::size_t count = std::min<std::size_t>(1024, size - i);
+            for(std::size_t j = 0; j < count; j++){block[j] = static_cast<float>(values[i + j]);}
+            Append(block, count * sizeof(float));
+        }
+    }
+    else
+    {
+        std::vector<unsigned char> bytes;
+        Delta_Encode(values, size, bytes);
+        Append(bytes.data(), bytes.size());
+    }
+    m_directory.back().m_bytes = m_offset + m_buffer.size() - m_directory.back().m_offset;
+}
+
+void ColumnarWriter::Add_Column(const std::string& name, const std::vector<double>& values, const Column_Encoding& encoding)
+{
+    if(values.size() != m_rows){throw std::invalid_argument("Error: Column " + name + " does not have the number of rows of the file.");}
+    Add_Column(name, values.data(), encoding);
+}
+
+void ColumnarWriter::Add_Column(const std::string& name, const std::vector<float>& values)
+{
+    if(values.size() != m_rows){throw std::invalid_argument("Error: Column " + name + " does not have the number of rows of the file.");}
+    Start_Column(name, Column_Encoding::Float32);
+    Append(values.data(), values.size() * sizeof(float));
+    m_directory.back().m_bytes = m_offset + m_buffer.size() - m_directory.back().m_offset;
+}
+
+void ColumnarWriter::Close()
+{
+    if(m_fd < 0){return;}
+    Align();
+    Columnar_Header header = {};
+    std::memcpy(header.m_magic, Columnar_Magic, sizeof(Columnar_Magic));
+    header.m_version = Columnar_Version;
+    header.m_byte_order = Byte_Order_Mark;
+    header.m_rows = m_rows;
+    header.m_columns = m_directory.size();
+    header.m_directory_offset = m_offset + m_buffer.size();
+    if(!m_directory.empty()){Append(m_directory.data(), m_directory.size() * sizeof(Column_Entry));}
+    Flush();
+
+    // The header is written last, so that a file interrupted before Close() has no valid magic (even under its temporary name)
+    if(::pwrite(m_fd, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header)))
+    {
+        throw std::runtime_error("Error: Cannot write the header of columnar file " + m_path + ".");
+    }
+    if(::fsync(m_fd) != 0){throw std::runtime_error("Error: Cannot write columnar file " + m_path + ".");}
+
+    // Closed and renamed onto the final path: readers see either the previous file or the complete new one
+    const int fd = m_fd;
+    m_fd = -1;
+    if(::close(fd) != 0 || ::rename(Temporary_Path().c_str(), m_path.c_str()) != 0)
+    {
+        ::unlink(Temporary_Path().c_str());
+        throw std::runtime_error("Error: Cannot close columnar file " + m_path + ".");
+    }
+}
+
+std::string ColumnarWriter::Temporary_Path() const
+{
+    return m_path + ".tmp";
+}
+
+
+//Overloaded constructor
+ColumnarReader::ColumnarReader(const std::string& path): m_path(path), m_map(nullptr), m_map_size(0), m_rows(0), m_directory()
+{
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if(fd < 0){throw std::invalid_argument("Error: Cannot open columnar file " + path + ".");}
+    struct stat status;
+    if(::fstat(fd, &status) != 0 || static_cast<std::size_t>(status.st_size) < sizeof(Columnar_Header))
+    {
+        ::close(fd);
+        throw std::invalid_argument("Error: " + path + " is not a columnar file.");
+    }
+    m_map_size = static_cast<std::size_t>(status.st_size);
+    void* map = ::mmap(nullptr, m_map_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);    // The mapping stays valid
+    if(map == MAP_FAILED){throw std::runtime_error("Error: Cannot map columnar file " + path + ".");}
+    m_map = static_cast<const unsigned char*>(map);
+
+    Columnar_Header header;
+    std::memcpy(&header, m_map, sizeof(header));
+    const bool valid = std::memcmp(header.m_magic, Columnar_Magic, sizeof(Columnar_Magic)) == 0 && header.m_version == Columnar_Version
+        && header.m_byte_order == Byte_Order_Mark && header.m_directory_offset <= m_map_size
+        && header.m_columns <= (m_map_size - header.m_directory_offset) / sizeof(Column_Entry);
+    if(!valid)
+    {
+        ::munmap(const_cast<unsigned char*>(m_map), m_map_size);
+        throw std::invalid_argument("Error: " + path + " is not a complete columnar file of this version and byte order.");
+    }
+    m_rows = header.m_rows;
+    m_directory.resize(static_cast<std::size_t>(header.m_columns));
+    if(!m_directory.empty()){std::memcpy(m_directory.data(), m_map + header.m_directory_offset, m_directory.size() * sizeof(Column_Entry));}
+    for(std::size_t c = 0; c < m_directory.size(); c++)
+    {
+        m_directory[c].m_name[sizeof(m_directory[c].m_name) - 1] = '\0';
+        if(m_directory[c].m_offset > m_map_size || m_directory[c].m_bytes > m_map_size - m_directory[c].m_offset)
+        {
+            ::munmap(const_cast<unsigned char*>(m_map), m_map_size);
+            throw std::invalid_argument("Error: Column " + std::string(m_directory[c].m_name) + " of " + path + " is truncated.");
+        }
+    }
+    //std::cout << "Overloaded constructor in ColumnarReader used." << std::endl;
+}
+
+//Destructor
+ColumnarReader::~ColumnarReader()
+{
+    if(m_map != nullptr){::munmap(const_cast<unsigned char*>(m_map), m_map_size);}
+    //std::cout << "Destructor in ColumnarReader used." << std::endl;
+}
+
+
+const Column_Entry& ColumnarReader::Find(const std::string& name) const
+{
+    for(std::size_t c = 0; c < m_directory.size(); c++)
+    {
+        if(name == m_directory[c].m_name){return m_directory[c];}
+    }
+    throw std::invalid_argument("Error: No column " + name + " in " + m_path + ".");
+}
+
+std::size_t ColumnarReader::getRows() const
+{
+    return static_cast<std::size_t>(m_rows);
+}
+
+std::vector<std::string> ColumnarReader::Column_Names() const
+{
+    std::vector<std::string> names;
+    for(std::size_t c = 0; c < m_directory.size(); c++){names.push_back(m_directory[c].m_name);}
+    return names;
+}
+
+Column_Encoding ColumnarReader::Encoding(const std::string& name) const
+{
+    return static_cast<Column_Encoding>(Find(name).m_encoding);
+}
+
+void ColumnarReader::Read_Column(const std::string& name, std::vector<double>& values) const
+{
+    const Column_Entry& entry = Find(name);
+    const unsigned char* data = m_map + entry.m_offset;
+    const std::size_t rows = static_cast<std::size_t>(m_rows);
+    values.resize(rows);
+    switch(static_cast<Column_Encoding>(entry.m_encoding))
+    {
+        case Column_Encoding::Plain:
+            if(entry.m_bytes != rows * sizeof(double)){throw std::invalid_argument("Error: Column " + name + " does not have the number of rows of the file.");}
+            std::memcpy(values.data(), data, rows * sizeof(double));
+            break;
+        case Column_Encoding::Float32:
+            if(entry.m_bytes != rows * sizeof(float)){throw std::invalid_argument("Error: Column " + name + " does not have the number of rows of the file.");}
+            for(std::size_t i = 0; i < rows; i++)
+            {
+                float value;
+                std::memcpy(&value, data + i * sizeof(float), sizeof(float));
+                values[i] = value;
+            }
+            break;
+        case Column_Encoding::Delta:
+            Delta_Decode(data, static_cast<std::size_t>(entry.m_bytes), rows, values.data());
+            break;
+        default:
+            throw std::invalid_argument("Error: Column " + name + " has an unknown encoding.");
+    }
+}
+
+const double* ColumnarReader::Plain_Data(const std::string& name) const
+{
+    const Column_Entry& entry = Find(name);
+    if(static_cast<Column_Encoding>(entry.m_encoding) != Column_Encoding::Plain || entry.m_bytes != m_rows * sizeof(double)){return nullptr;}
+    return reinterpret_cast<const double*>(m_map + entry.m_offset);     // 64-byte aligned in the file, and the mapping is page aligned
+}
@@ -0,0 +1,103 @@
+//ColumnarFile.hpp
+//
+//Purpose: Binary columnar export of grids and results (mesh, parameter columns, result columns), so that large Matrix runs leave the process without text
+//         formatting and downstream tools load them without parsing. The layout follows Arrow: one contiguous buffer per column, each starting on a 64-byte
+//         boundary of the file, little-endian, with a fixed-size directory of the columns (name, encoding, offset, size) written after the data and pointed at
+//         by the header, so that the file is written in one pass. Plain columns are raw float64 (or float32) arrays, which a reader maps and uses in place.
+//         Two optional encodings compress the columns:
+//           - Delta: lossless. The 64-bit patterns of successive values are differenced twice, zigzag-encoded and written as LEB128 varints. Constant columns
+//             (the parameters a grid does not vary) and uniform meshes then take about one byte per value.
+//           - Float32: lossy, values rounded to float (about 7 significant digits), half the size of float64.
+//         The writer accumulates the file in a buffer and writes it by large blocks, under a temporary name renamed onto the final one once complete; the
+//         reader maps the file.
+//
+//         Layout: header (64 bytes) | column buffers, each 64-byte aligned | directory (64 bytes per column)
+//           header:    magic "OPTCOLS1", uint32 version, uint32 byte-order mark 0x01020304, uint64 rows, uint64 columns, uint64 directory offset, padding
+//           directory: name (40 bytes, NUL-padded), uint32 encoding, uint32 reserved, uint64 offset, uint64 size in bytes
+//
+//Modification date: 10/18/2026
+
+#ifndef ColumnarFile_hpp
+#define ColumnarFile_hpp
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+enum class Column_Encoding: std::uint32_t
+{
+    Plain = 0,          // float64 values
+    Delta = 1,          // float64 values, second differences of the bit patterns as zigzag LEB128 varints (lossless)
+    Float32 = 2,        // float32 values (lossy for double inputs, exact for float results)
+};
+
+struct Column_Entry;         // Directory entry of a column, as laid out in the file, defined in ColumnarFile.cpp
+
+class ColumnarWriter
+{
+    private:
+        std::string m_path;
+        int m_fd;
+        std::uint64_t m_rows;
+        std::uint64_t m_offset;                 // Offset in the file of the end of the buffer
+        std::vector<unsigned char> m_buffer;    // Bytes not yet written
+        std::size_t m_buffer_bytes;             // Size at which the buffer is written out
+        std::vector<Column_Entry> m_directory;
+
+        void Append(const void* data, const std::size_t& size);
+        void Align();                           // Pads the file to the next 64-byte boundary
+        void Flush();
+        void Start_Column(const std::string& name, const Column_Encoding& encoding);    // Checks the name, aligns, and adds the directory entry
+        std::string Temporary_Path() const;     // File written until Close(): path + ".tmp"
+
+    public:
+    //CONSTRUCTORS AND DESTRUCTOR
+
+        // Creates the file under the temporary name path + ".tmp", for columns of rows values each, written out by blocks of buffer_bytes
+        ColumnarWriter(const std::string& path, const std::size_t& rows, const std::size_t& buffer_bytes = 4 * 1024 * 1024);
+        ColumnarWriter(const ColumnarWriter& source) = delete;              // Not copyable, as it owns a file descriptor
+        ColumnarWriter& operator = (const ColumnarWriter& source) = delete;
+        ~ColumnarWriter();                                                  // Destructor: without Close(), the temporary file is closed and removed
+
+    //COLUMNS
+
+        // Appends a column of rows values. Names are at most 39 characters, and unique within a file.
+        void Add_Column(const std::string& name, const double* values, const Column_Encoding& encoding = Column_Encoding::Plain);
+        void Add_Column(const std::string& name, const std::vector<double>& values, const Column_Encoding& encoding = Column_Encoding::Plain);
+        void Add_Column(const std::string& name, const std::vector<float>& values);        // Stored as Float32, exactly
+
+        void Close();               // Writes the directory and the header, syncs and closes the file, and renames it onto path: the only way to complete it.
+                                    // Further columns are refused.
+};
+
+class ColumnarReader
+{
+    private:
+        std::string m_path;
+        const unsigned char* m_map;             // Read-only mapping of the whole file
+        std::size_t m_map_size;
+        std::uint64_t m_rows;
+        std::vector<Column_Entry> m_directory;
+
+        const Column_Entry& Find(const std::string& name) const;
+
+    public:
+    //CONSTRUCTORS AND DESTRUCTOR
+
+        ColumnarReader(const std::string& path);                            // Maps the file and checks its header and directory
+        ColumnarReader(const ColumnarReader& source) = delete;              // Not copyable, as it owns a mapping
+        ColumnarReader& operator = (const ColumnarReader& source) = delete;
+        ~ColumnarReader();                                                  // Destructor, unmaps the file
+
+    //COLUMNS
+
+        std::size_t getRows() const;
+        std::vector<std::string> Column_Names() const;                      // In the order the columns were written
+        Column_Encoding Encoding(const std::string& name) const;
+
+        void Read_Column(const std::string& name, std::vector<double>& values) const;      // Decoded column, whatever its encoding
+        const double* Plain_Data(const std::string& name) const;            // Values of a Plain column in place in the mapping, nullptr for other encodings
+};
+
+#endif //ColumnarFile_hpp
@@ -0,0 +1,399 @@
+//FiniteDifferenceEngine.cpp
+//
+//Purpose: Finite-difference Greeks of any pricer given as a batch function, for engines where bumping is the only option. Unlike DividedDifferences (2-point
+//         delta, 3-point gamma), the stencils are central of order 2, 4 or 6, with weights computed by Fornberg's algorithm, and switch to one-sided (forward)
+//         stencils of the same order when a central bump would take S, Sig or T to 0 or below. Delta, gamma, vega, theta, rho, vanna and volga are computed
+//         from one set of stencil points per option, and the points of a whole batch of options are priced in a single call to the pricer.
+//         With FD_Method::Complex_Step, the first-order Greeks (delta, vega, theta, rho) are instead taken as Im(V(x + i*y))/y, which has no cancellation error
+//         and needs one evaluation per Greek, for pricers whose kernel accepts complex arguments (Black-Scholes and perpetual American kernels).
+//         Theta is -dV/dT, as in BSExactPricingEngine. Rho bumps R, together with B when B = R (stock options), so that the cost of carry follows the rate.
+//
+//Modification date: 10/18/2026
+
+
+#include "FiniteDifferenceEngine.hpp"
+#include "PricingKernels.hpp"
+#include <stdexcept>
+
+
+//Default constructor
+FiniteDifferenceEngine::FiniteDifferenceEngine(): m_pricer(BS_Pricer(Option_Type::Call)), m_complex_pricer(BS_Complex_Pricer(Option_Type::Call)), m_order(4),
+    m_steps({1e-3, 1e-3, 1e-3, 1e-4}), m_method(FD_Method::Central)
+{
+    Build_Stencils();
+    //std::cout << "Default constructor in FiniteDifferenceEngine used." << std::endl;
+}
+
+//Overloaded constructor
+FiniteDifferenceEngine::FiniteDifferenceEngine(const Batch_Pricer& pricer, const std::size_t& order, const FD_Steps& steps, const FD_Method& method,
+    const Complex_Pricer& complex_pricer): m_pricer(pricer), m_complex_pricer(complex_pricer), m_order(order), m_steps(steps), m_method(method)
+{
+    if(!m_pricer){throw std::invalid_argument("Error: finite-difference engine requires a pricer.");}
+    if(order != 2 && order != 4 && order != 6){throw std::invalid_argument("Error: stencil order must be 2, 4 or 6.");}
+    if(!(steps.m_S > 0.0 && steps.m_Sig > 0.0 && steps.m_T > 0.0 && steps.m_R > 0.0)){throw std::invalid_argument("Error: finite-difference steps must be positive.");}
+    if(method == FD_Method::Complex_Step && !m_complex_pricer){throw std::invalid_argument("Error: complex-step method requires a complex pricer.");}
+    Build_Stencils();
+    //std::cout << "Overloaded constructor in FiniteDifferenceEngine used." << std::endl;
+}
+
+//Copy constructor
+FiniteDifferenceEngine::FiniteDifferenceEngine(const FiniteDifferenceEngine& source): m_pricer(source.m_pricer), m_complex_pricer(source.m_complex_pricer),
+    m_order(source.m_order), m_steps(source.m_steps), m_method(source.m_method), m_central(source.m_central), m_forward(source.m_forward)
+{
+    //std::cout << "Copy constructor in FiniteDifferenceEngine used." << std::endl;
+}
+
+//Destructor
+FiniteDifferenceEngine::~FiniteDifferenceEngine()
+{
+    //std::cout << "Destructor in FiniteDifferenceEngine used." << std::endl;
+}
+
+//Assignment operator
+FiniteDifferenceEngine& FiniteDifferenceEngine::operator = (const FiniteDifferenceEngine& source)
+{
+    if (this == &source)    // Checking for self-assignment
+    {
+        return *this;
+    }
+    else
+    {
+        m_pricer = source.m_pricer;
+        m_complex_pricer = source.m_complex_pricer;
+        m_order = source.m_order;
+        m_steps = source.m_steps;
+        m_method = source.m_method;
+        m_central = source.m_central;
+        m_forward = source.m_forward;
+        return *this;
+    }
+}
+
+
+//STENCILS
+
+// Fornberg's algorithm (Math. Comp. 51, 1988): weights of the first and second derivatives at 0 from values at the given offsets, built up one node at a time
+void FiniteDifferenceEngine::Fornberg_Weights(const std::vector<int>& offsets, std::vector<double>& first, std::vector<double>& second)
+{
+    const std::size_t n = offsets.size();
+    std::vector<double> c[3] = {std::vector<double>(n, 0.0), std::vector<double>(n, 0.0), std::vector<double>(n, 0.0)};   // Weights of derivatives 0, 1, 2
+    double c1 = 1.0, c4 = offsets[0];
+    c[0][0] = 1.0;
+
+    for(std::size_t i = 1; i < n; i++)
+    {
+        std::size_t mn = (i < 2) ? i : 2;
+        double c2 = 1.0, c5 = c4;
+        c4 = offsets[i];
+        for(std::size_t j = 0; j < i; j++)
+        {
+            double c3 = double(offsets[i] - offsets[j]);
+            c2 *= c3;
+            if(j == i - 1)
+            {
+                for(std::size_t k = mn; k >= 1; k--)
+                {
+                    c[k][i] = c1*(double(k)*c[k-1][i-1] - c5*c[k][i-1]) / c2;
+                }
+                c[0][i] = -c1*c5*c[0][i-1] / c2;
+            }
+            for(std::size_t k = mn; k >= 1; k--)
+            {
+                c[k][j] = (c4*c[k][j] - double(k)*c[k-1][j]) / c3;
+            }
+            c[0][j] = c4*c[0][j] / c3;
+        }
+        c1 = c2;
+    }
+    first = c[1];
+    second = c[2];
+}
+
+void FiniteDifferenceEngine::Build_Stencils()
+{
+    const int half = int(m_order / 2);
+    m_central.m_offsets.clear();
+    m_forward.m_offsets.clear();
+    for(int k = -half; k <= half; k++)          // 2*half + 1 points: first and second derivatives of order m_order
+    {
+        m_central.m_offsets.push_back(k);
+    }
+    for(int k = 0; k <= int(m_order) + 1; k++)  // m_order + 2 points: second derivative of order m_order, first derivative of order m_order + 1
+    {
+        m_forward.m_offsets.push_back(k);
+    }
+    Fornberg_Weights(m_central.m_offsets, m_central.m_first, m_central.m_second);
+    Fornberg_Weights(m_forward.m_offsets, m_forward.m_first, m_forward.m_second);
+}
+
+
+//PRICERS
+
+FiniteDifferenceEngine::Batch_Pricer FiniteDifferenceEngine::BS_Pricer(const Option_Type& optiontype)
+{
+    return [optiontype](const std::vector<Param_Data>& points, std::vector<double>& prices)
+    {
+        prices.resize(points.size());
+        for(std::size_t i = 0; i < points.size(); i++)
+        {
+            const Param_Data& p = points[i];
+            prices[i] = (optiontype == Option_Type::Call) ? BS_Kernel<double>::Call_Price(p.m_S, p.m_K, p.m_T, p.m_R, p.m_Sig, p.m_B)
+                                                          : BS_Kernel<double>::Put_Price(p.m_S, p.m_K, p.m_T, p.m_R, p.m_Sig, p.m_B);
+        }
+    };
+}
+
+FiniteDifferenceEngine::Complex_Pricer FiniteDifferenceEngine::BS_Complex_Pricer(const Option_Type& optiontype)
+{
+    return [optiontype](const std::vector<Complex_Param_Data>& points, std::vector<std::complex<double>>& prices)
+    {
+        typedef BS_Kernel<std::complex<double>> Kernel;
+        prices.resize(points.size());
+        for(std::size_t i = 0; i < points.size(); i++)
+        {
+            const Complex_Param_Data& p = points[i];
+            prices[i] = (optiontype == Option_Type::Call) ? Kernel::Call_Price(p.m_S, p.m_K, p.m_T, p.m_R, p.m_Sig, p.m_B)
+                                                          : Kernel::Put_Price(p.m_S, p.m_K, p.m_T, p.m_R, p.m_Sig, p.m_B);
+        }
+    };
+}
+
+FiniteDifferenceEngine::Batch_Pricer FiniteDifferenceEngine::American_Perp_Pricer(const Option_Type& optiontype)
+{
+    return [optiontype](const std::vector<Param_Data>& points, std::vector<double>& prices)
+    {
+        prices.resize(points.size());
+        for(std::size_t i = 0; i < points.size(); i++)
+        {
+            const Param_Data& p = points[i];
+            prices[i] = (optiontype == Option_Type::Call) ? AmericanPerp_Kernel<double>::Call_Price(p.m_S, p.m_K, p.m_R, p.m_Sig, p.m_B)
+                                                          : AmericanPerp_Kernel<double>::Put_Price(p.m_S, p.m_K, p.m_R, p.m_Sig, p.m_B);
+        }
+    };
+}
+
+FiniteDifferenceEngine::Complex_Pricer FiniteDifferenceEngine::American_Perp_Complex_Pricer(const Option_Type& optiontype)
+{
+    return [optiontype](const std::vector<Complex_Param_Data>& points, std::vector<std::complex<double>>& prices)
+    {
+        typedef AmericanPerp_Kernel<std::complex<double>> Kernel;
+        prices.resize(points.size());
+        for(std::size_t i = 0; i < points.size(); i++)
+        {
+            const Complex_Param_Data& p = points[i];
+            prices[i] = (optiontype == Option_Type::Call) ? Kernel::Call_Price(p.m_S, p.m_K, p.m_R, p.m_Sig, p.m_B)
+                                                          : Kernel::Put_Price(p.m_S, p.m_K, p.m_R, p.m_Sig, p.m_B);
+        }
+    };
+}
+
+
+//GREEKS
+
+// Parameters shifted along one axis. Shifting R also shifts B when B = R, so that rho is that of a stock option rather than at a fixed cost of carry.
+static Param_Data Bumped(const Param_Data& p, double Param_Data::* axis, const double& shift)
+{
+    Param_Data q = p;
+    q.*axis += shift;
+    if(axis == &Param_Data::m_R && p.m_B == p.m_R)
+    {
+        q.m_B += shift;
+    }
+    return q;
+}
+
+// Points of one axis, except offset 0 which is the unbumped point
+static void Add_Axis(std::vector<Param_Data>& points, const Param_Data& p, double Param_Data::* axis, const double& h, const std::vector<int>& offsets)
+{
+    for(std::size_t k = 0; k < offsets.size(); k++)
+    {
+        if(offsets[k] != 0){points.push_back(Bumped(p, axis, double(offsets[k])*h));}
+    }
+}
+
+// Prices of one axis read back in the order of Add_Axis(), with the unbumped price at offset 0
+static void Read_Axis(const std::vector<double>& prices, std::size_t& next, const double& base, const std::vector<int>& offsets, double* values)
+{
+    for(std::size_t k = 0; k < offsets.size(); k++)
+    {
+        values[k] = (offsets[k] != 0) ? prices[next++] : base;
+    }
+}
+
+static double Apply(const std::vector<double>& weights, const double* values)
+{
+    double sum = 0.0;
+    for(std::size_t k = 0; k < weights.size(); k++)
+    {
+        sum += weights[k]*values[k];
+    }
+    return sum;
+}
+
+FD_Greeks FiniteDifferenceEngine::Greeks(const Param_Data& option) const
+{
+    std::vector<FD_Greeks> results;
+    Greeks(std::vector<Param_Data>(1, option), results);
+    return results[0];
+}
+
+std::vector<FD_Greeks> FiniteDifferenceEngine::Greeks(const std::vector<Param_Data>& options) const
+{
+    std::vector<FD_Greeks> results;
+    Greeks(options, results);
+    return results;
+}
+
+void FiniteDifferenceEngine::Greeks(const std::vector<Param_Data>& options, std::vector<FD_Greeks>& results) const
+{
+    const bool complex_step = (m_method == FD_Method::Complex_Step);
+    const double half = double(m_order / 2);
+    const std::size_t n = options.size();
+    results.resize(n);
+
+    // Stencil of each axis of each option: forward when a central bump would cross 0
+    std::vector<unsigned char> forward_S(n), forward_Sig(n), forward_T(n);
+    std::vector<Param_Data> points;
+    points.reserve(n*Evaluations_Per_Option());
+
+    for(std::size_t i = 0; i < n; i++)
+    {
+        const Param_Data& p = options[i];
+        const double h_S = m_steps.m_S*p.m_S;
+        forward_S[i] = (p.m_S - half*h_S <= 0.0);
+        forward_Sig[i] = (p.m_Sig - half*m_steps.m_Sig <= 0.0);
+        forward_T[i] = (p.m_T - half*m_steps.m_T <= 0.0);
+        const Stencil& S_stencil = forward_S[i] ? m_forward : m_central;
+        const Stencil& Sig_stencil = forward_Sig[i] ? m_forward : m_central;
+
+        points.push_back(p);
+        Add_Axis(points, p, &Param_Data::m_S, h_S, S_stencil.m_offsets);
+        Add_Axis(points, p, &Param_Data::m_Sig, m_steps.m_Sig, Sig_stencil.m_offsets);
+        if(!complex_step)
+        {
+            Add_Axis(points, p, &Param_Data::m_T, m_steps.m_T, (forward_T[i] ? m_forward : m_central).m_offsets);
+            Add_Axis(points, p, &Param_Data::m_R, m_steps.m_R, m_central.m_offsets);
+        }
+        for(std::size_t a = 0; a < S_stencil.m_offsets.size(); a++)     // Cross points for vanna, off both axes
+        {
+            for(std::size_t b = 0; b < Sig_stencil.m_offsets.size(); b++)
+            {
+                if(S_stencil.m_offsets[a] == 0 || Sig_stencil.m_offsets[b] == 0){continue;}
+                Param_Data q = p;
+                q.m_S += double(S_stencil.m_offsets[a])*h_S;
+                q.m_Sig += double(Sig_stencil.m_offsets[b])*m_steps.m_Sig;
+                points.push_back(q);
+            }
+        }
+    }
+
+    std::vector<double> prices;
+    m_pricer(points, prices);   // One call for every point of every option
+    if(prices.size() != points.size()){throw std::invalid_argument("Error: pricer returned a number of prices different from the number of points.");}
+
+    std::size_t next = 0;
+    double values_S[16], values_Sig[16], values_T[16], values_R[16];    // At most order + 2 = 8 points per axis
+    for(std::size_t i = 0; i < n; i++)
+    {
+        const Param_Data& p = options[i];
+        const double h_S = m_steps.m_S*p.m_S, h_Sig = m_steps.m_Sig;
+        const Stencil& S_stencil = forward_S[i] ? m_forward : m_central;
+        const Stencil& Sig_stencil = forward_Sig[i] ? m_forward : m_central;
+        const Stencil& T_stencil = forward_T[i] ? m_forward : m_central;
+        FD_Greeks& g = results[i];
+
+        const double base = prices[next++];
+        Read_Axis(prices, next, base, S_stencil.m_offsets, values_S);
+        Read_Axis(prices, next, base, Sig_stencil.m_offsets, values_Sig);
+        g.m_price = base;
+        g.m_delta = Apply(S_stencil.m_first, values_S) / h_S;
+        g.m_gamma = Apply(S_stencil.m_second, values_S) / (h_S*h_S);
+        g.m_vega = Apply(Sig_stencil.m_first, values_Sig) / h_Sig;
+        g.m_volga = Apply(Sig_stencil.m_second, values_Sig) / (h_Sig*h_Sig);
+        if(!complex_step)
+        {
+            Read_Axis(prices, next, base, T_stencil.m_offsets, values_T);
+            Read_Axis(prices, next, base, m_central.m_offsets, values_R);
+            g.m_theta = -Apply(T_stencil.m_first, values_T) / m_steps.m_T;
+            g.m_rho = Apply(m_central.m_first, values_R) / m_steps.m_R;
+        }
+
+        // Vanna: tensor product of the first-derivative stencils in S and Sig, with the points on either axis read from the axes
+        double vanna = 0.0;
+        for(std::size_t a = 0; a < S_stencil.m_offsets.size(); a++)
+        {
+            for(std::size_t b = 0; b < Sig_stencil.m_offsets.size(); b++)
+            {
+                double value;
+                if(S_stencil.m_offsets[a] == 0){value = values_Sig[b];}
+                else if(Sig_stencil.m_offsets[b] == 0){value = values_S[a];}
+                else{value = prices[next++];}
+                vanna += S_stencil.m_first[a]*Sig_stencil.m_first[b]*value;
+            }
+        }
+        g.m_vanna = vanna / (h_S*h_Sig);
+    }
+
+    if(complex_step)
+    {
+        // One complex evaluation per first-order Greek: dV/dx = Im(V(x + i*y))/y, exact to O(y^2), with no subtraction of close values
+        const double y = 1e-20;
+        std::vector<Complex_Param_Data> complex_points;
+        complex_points.reserve(4*n);
+        for(std::size_t i = 0; i < n; i++)
+        {
+            const Param_Data& p = options[i];
+            const Complex_Param_Data c = {p.m_S, p.m_K, p.m_T, p.m_R, p.m_Sig, p.m_B};
+            Complex_Param_Data bump = c;
+            bump.m_S += std::complex<double>(0.0, y);
+            complex_points.push_back(bump);
+            bump = c;
+            bump.m_Sig += std::complex<double>(0.0, y);
+            complex_points.push_back(bump);
+            bump = c;
+            bump.m_T += std::complex<double>(0.0, y);
+            complex_points.push_back(bump);
+            bump = c;
+            bump.m_R += std::complex<double>(0.0, y);
+            if(p.m_B == p.m_R){bump.m_B += std::complex<double>(0.0, y);}   // As Bumped(): the cost of carry follows the rate for stock options
+            complex_points.push_back(bump);
+        }
+
+        std::vector<std::complex<double>> complex_prices;
+        m_complex_pricer(complex_points, complex_prices);
+        if(complex_prices.size() != complex_points.size()){throw std::invalid_argument("Error: pricer returned a number of prices different from the number of points.");}
+
+        for(std::size_t i = 0; i < n; i++)
+        {
+            results[i].m_delta = complex_prices[4*i].imag() / y;
+            results[i].m_vega = complex_prices[4*i + 1].imag() / y;
+            results[i].m_theta = -complex_prices[4*i + 2].imag() / y;
+            results[i].m_rho = complex_prices[4*i + 3].imag() / y;
+        }
+    }
+}
+
+std::size_t FiniteDifferenceEngine::Evaluations_Per_Option() const
+{
+    // Unbumped point, m_order points on each bumped axis, m_order^2 cross points (plus 4 complex evaluations with the complex step, which bumps neither T nor R)
+    std::size_t axes = (m_method == FD_Method::Complex_Step) ? 2 : 4;
+    return 1 + axes*m_order + m_order*m_order;
+}
+
+
+//GETTERS
+
+std::size_t const& FiniteDifferenceEngine::getOrder() const
+{
+    return m_order;
+}
+
+FD_Steps const& FiniteDifferenceEngine::getSteps() const
+{
+    return m_steps;
+}
+
+FD_Method const& FiniteDifferenceEngine::getMethod() const
+{
+    return m_method;
+}
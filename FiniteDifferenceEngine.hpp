@@ -0,0 +1,107 @@
+//FiniteDifferenceEngine.hpp
+//
+//Purpose: Finite-difference Greeks of any pricer given as a batch function, for engines where bumping is the only option. Unlike DividedDifferences (2-point
+//         delta, 3-point gamma), the stencils are central of order 2, 4 or 6, with weights computed by Fornberg's algorithm, and switch to one-sided (forward)
+//         stencils of the same order when a central bump would take S, Sig or T to 0 or below. Delta, gamma, vega, theta, rho, vanna and volga are computed
+//         from one set of stencil points per option, and the points of a whole batch of options are priced in a single call to the pricer.
+//         With FD_Method::Complex_Step, the first-order Greeks (delta, vega, theta, rho) are instead taken as Im(V(x + i*y))/y, which has no cancellation error
+//         and needs one evaluation per Greek, for pricers whose kernel accepts complex arguments (Black-Scholes and perpetual American kernels).
+//         Theta is -dV/dT, as in BSExactPricingEngine. Rho bumps R, together with B when B = R (stock options), so that the cost of carry follows the rate.
+//
+//Modification date: 10/18/2026
+
+#ifndef FiniteDifferenceEngine_hpp
+#define FiniteDifferenceEngine_hpp
+
+#include "OptionData.hpp"
+#include <vector>
+#include <complex>
+#include <functional>
+#include <cstddef>
+
+// How first-order Greeks are computed: stencils, or complex step (second-order Greeks always use stencils)
+enum class FD_Method
+{
+    Central, Complex_Step
+};
+
+// Greeks of one option, with the price at the unbumped point
+struct FD_Greeks
+{
+    double m_price;
+    double m_delta, m_gamma, m_vega, m_theta, m_rho, m_vanna, m_volga;
+};
+
+// Bump sizes: m_S is relative to S, the others are absolute
+struct FD_Steps
+{
+    double m_S;
+    double m_Sig;
+    double m_T;
+    double m_R;
+};
+
+// Parameters with complex values, for complex-step pricers
+struct Complex_Param_Data
+{
+    std::complex<double> m_S, m_K, m_T, m_R, m_Sig, m_B;
+};
+
+class FiniteDifferenceEngine
+{
+    public:
+        // Prices of all the points provided, in the same order (prices is resized by the pricer)
+        typedef std::function<void(const std::vector<Param_Data>& points, std::vector<double>& prices)> Batch_Pricer;
+        typedef std::function<void(const std::vector<Complex_Param_Data>& points, std::vector<std::complex<double>>& prices)> Complex_Pricer;
+
+    private:
+        // Offsets of the stencil points in units of the step, with the weights of the first and second derivatives (divided by h and h^2 when applied)
+        struct Stencil
+        {
+            std::vector<int> m_offsets;
+            std::vector<double> m_first;
+            std::vector<double> m_second;
+        };
+
+        Batch_Pricer m_pricer;
+        Complex_Pricer m_complex_pricer;    // Only required with FD_Method::Complex_Step
+        std::size_t m_order;                // Order of accuracy of the stencils: 2, 4 or 6
+        FD_Steps m_steps;
+        FD_Method m_method;
+        Stencil m_central;                  // Offsets -order/2 .. order/2
+        Stencil m_forward;                  // Offsets 0 .. order+1, used near the boundary S, Sig or T = 0
+
+        void Build_Stencils();
+        static void Fornberg_Weights(const std::vector<int>& offsets, std::vector<double>& first, std::vector<double>& second);   // Weights of the derivatives at offset 0
+
+    public:
+    //CONSTRUCTORS AND DESTRUCTOR
+
+        FiniteDifferenceEngine();                                       // Default constructor: Black-Scholes call, 4th order central stencils, steps (1e-3 S, 1e-3, 1e-3, 1e-4)
+        FiniteDifferenceEngine(const Batch_Pricer& pricer, const std::size_t& order, const FD_Steps& steps, const FD_Method& method = FD_Method::Central,
+            const Complex_Pricer& complex_pricer = Complex_Pricer());  // Overloaded constructor
+        FiniteDifferenceEngine(const FiniteDifferenceEngine& source);   // Copy constructor
+        ~FiniteDifferenceEngine();                                      // Destructor
+        FiniteDifferenceEngine& operator = (const FiniteDifferenceEngine& source);    // Assignment operator
+
+    //PRICERS
+
+        static Batch_Pricer BS_Pricer(const Option_Type& optiontype);               // Black-Scholes, from the kernels of PricingKernels.hpp
+        static Complex_Pricer BS_Complex_Pricer(const Option_Type& optiontype);
+        static Batch_Pricer American_Perp_Pricer(const Option_Type& optiontype);    // Perpetual American (T is not used, so theta is 0)
+        static Complex_Pricer American_Perp_Complex_Pricer(const Option_Type& optiontype);
+
+    //GREEKS
+
+        FD_Greeks Greeks(const Param_Data& option) const;                                              // Greeks of one option (m_h is ignored)
+        std::vector<FD_Greeks> Greeks(const std::vector<Param_Data>& options) const;                   // Greeks of a batch, with one call to the pricer
+        void Greeks(const std::vector<Param_Data>& options, std::vector<FD_Greeks>& results) const;    // Same, reusing the buffer provided
+        std::size_t Evaluations_Per_Option() const;     // Real prices per option with central stencils on every axis
+
+    //GETTERS
+        std::size_t const& getOrder() const;
+        FD_Steps const& getSteps() const;
+        FD_Method const& getMethod() const;
+};
+
+#endif //FiniteDifferenceEngine_hpp
@@ -0,0 +1,295 @@
+//HestonEngine.cpp
+//
+//Purpose: Heston stochastic volatility pricing of European options by the COS method of Fang and Oosterlee: the density of the log-price at expiry is expanded
+//         in a cosine series on a truncation interval, whose coefficients come from the characteristic function. The characteristic function is that of
+//         ln(S(T)/F), which does not depend on the strike, and the put payoff is expressed in y = ln(S(T)/K): with one truncation interval covering the whole
+//         strike ladder of an expiry, the characteristic function, the payoff coefficients and their products are computed once per expiry, and each strike only
+//         costs one pass of complex multiply-adds over the cached coefficients (the phases exp(i u_k x) follow by recurrence, without trigonometric functions).
+//         Puts are priced by the series, which is stable for deep strikes, and calls by put-call parity. The characteristic function uses the formulation of
+//         Albrecher et al. ("little Heston trap"), continuous in the complex logarithm.
+//
+//Modification date: 10/18/2026
+
+
+#include "HestonEngine.hpp"
+#include <cmath>        // For exp(), log(), sqrt(), cos(), sin()
+#include <algorithm>    // For std::min(), std::max(), std::minmax_element()
+#include <stdexcept>
+
+static const double Pi = 3.14159265358979323846;
+static const std::size_t Ladder_Block = 64;     // Strikes priced together: their phases and sums stay in L1, and the loop over them vectorizes
+
+
+//Default constructor
+HestonEngine::HestonEngine(): HestonEngine(Heston_Params{0.09, 1.5, 0.09, 0.5, -0.7}, 256, 16.0)
+{
+    //std::cout << "Default constructor in HestonEngine used." << std::endl;
+}
+
+//Overloaded constructor
+HestonEngine::HestonEngine(const Heston_Params& heston, const std::size_t& terms, const double& truncation): PricingEngine(), m_heston(heston), m_terms(terms),
+    m_truncation(truncation)
+{
+    Check_Params();
+    if(terms < 2){throw std::invalid_argument("Error: the COS method requires at least 2 terms.");}
+    if(!(truncation > 0.0)){throw std::invalid_argument("Error: the truncation interval of the COS method must have a positive width.");}
+    //std::cout << "Overloaded constructor in HestonEngine used." << std::endl;
+}
+
+//Copy constructor
+HestonEngine::HestonEngine(const HestonEngine& source): PricingEngine(source), m_heston(source.m_heston), m_terms(source.m_terms), m_truncation(source.m_truncation)
+{
+    //std::cout << "Copy constructor in HestonEngine used." << std::endl;
+}
+
+//Destructor
+HestonEngine::~HestonEngine()
+{
+    //std::cout << "Destructor in HestonEngine used." << std::endl;
+}
+
+//Assignment operator
+HestonEngine& HestonEngine::operator = (const HestonEngine& source)
+{
+    if (this == &source)    // Checking for self-assignment
+    {
+        return *this;
+    }
+    else
+    {
+        PricingEngine::operator = (source);
+        m_heston = source.m_heston;
+        m_terms = source.m_terms;
+        m_truncation = source.m_truncation;
+        return *this;
+    }
+}
+
+void HestonEngine::Check_Params() const
+{
+    if(!(m_heston.m_v0 >= 0.0) || !(m_heston.m_theta >= 0.0)){throw std::invalid_argument("Error: Heston variances must be non-negative.");}
+    if(!(m_heston.m_v0 + m_heston.m_theta > 0.0)){throw std::invalid_argument("Error: Heston initial and long-run variances cannot both be zero.");}     // The variance would stay at zero, and the truncation interval be empty
+    if(!(m_heston.m_kappa > 0.0)){throw std::invalid_argument("Error: Heston mean reversion speed must be positive.");}
+    if(!(m_heston.m_xi > 0.0)){throw std::invalid_argument("Error: Heston volatility of variance must be positive.");}
+    if(!(std::fabs(m_heston.m_rho) <= 1.0)){throw std::invalid_argument("Error: Heston correlation must be in [-1, 1].");}
+}
+
+
+//PRICING
+
+std::complex<double> HestonEngine::Characteristic(const double& u, const double& T) const
+{
+    const double kappa = m_heston.m_kappa, theta = m_heston.m_theta, xi = m_heston.m_xi, rho = m_heston.m_rho;
+    const std::complex<double> iu(0.0, u);
+    const std::complex<double> beta = kappa - rho*xi*iu;
+    const std::complex<double> d = std::sqrt(beta*beta + xi*xi*(u*u + iu));
+    const std::complex<double> g = (beta - d) / (beta + d);
+    const std::complex<double> e = std::exp(-d*T);
+
+    // With the root d of positive real part, |g exp(-dT)| < 1 and the logarithm below stays on its principal branch
+    const std::complex<double> D = (beta - d)*(1.0 - e) / (xi*xi*(1.0 - g*e));
+    const std::complex<double> C = (kappa*theta/(xi*xi))*((beta - d)*T - 2.0*std::log((1.0 - g*e) / (1.0 - g)));
+    return std::exp(C + D*m_heston.m_v0);
+}
+
+void HestonEngine::Put_Ladder(const double& T, const double& DF_R, const double* x, const double* K, const std::size_t& size, double* results,
+    std::vector<std::complex<double>>& coefficients) const
+{
+    if(size == 0){return;}
+    const double kappa = m_heston.m_kappa, theta = m_heston.m_theta, xi = m_heston.m_xi, rho = m_heston.m_rho, v0 = m_heston.m_v0;
+
+    // Cumulants of ln(S(T)/F): with log(phi) = C + D*v0 expanded in powers of iu, the coefficients of D and C follow from the Riccati equations of the model.
+    // (The closed form of c2 printed by Fang and Oosterlee has a typo, which underestimates it at short expiries when xi is large.)
+    const double E = exp(-kappa*T);
+    const double A_t = T - (1.0 - E)/kappa, B_t = (1.0 - E*(1.0 + kappa*T))/(kappa*kappa), C_t = (1.0 - E)/kappa - (1.0 - E*E)/(2.0*kappa);
+    const double d2 = 0.5*(1.0 - E)/kappa - 0.5*rho*xi/kappa*((1.0 - E)/kappa - E*T) + xi*xi/(8.0*kappa*kappa)*((1.0 - E)/kappa - 2.0*E*T + E*(1.0 - E)/kappa);
+    const double d2_integral = 0.5*A_t/kappa - 0.5*rho*xi/kappa*(A_t/kappa - B_t) + xi*xi/(8.0*kappa*kappa)*(A_t/kappa - 2.0*B_t + C_t/kappa);
+    const double c1 = -0.5*theta*A_t - 0.5*v0*(1.0 - E)/kappa;
+    const double c2 = 2.0*(kappa*theta*d2_integral + v0*d2);
+    const double half_width = m_truncation*sqrt(c2);
+
+    // One interval in y = x + ln(S(T)/F) for the whole ladder, x = ln(F/K)
+    const auto range = std::minmax_element(x, x + size);
+    const double a = *range.first + c1 - half_width, b = *range.second + c1 + half_width;
+    if(a >= 0.0)        // S(T) > K for every strike within the truncation: every put is worthless
+    {
+        std::fill(results, results + size, 0.0);
+        return;
+    }
+    const double c = a, d = std::min(b, 0.0);       // Put payoff K*(1 - exp(y)) on [a, 0]
+
+    // Coefficients of the ladder: characteristic function times the payoff coefficients V_k, the first term halved. The terms keep the resolution of m_terms
+    // over the interval of a single strike, so a ladder spreading the interval beyond it uses proportionally more; the series stops early once the
+    // characteristic function has decayed below double precision, as it does quickly at long expiries.
+    std::size_t terms = std::max(m_terms, std::size_t(std::ceil(double(m_terms)*(b - a)/(2.0*half_width))));
+    coefficients.resize(terms);
+    const double delta = Pi / (b - a);
+    const double exp_c = exp(c), exp_d = exp(d);
+    for(std::size_t k = 0; k < terms; k++)
+    {
+        const double u = double(k)*delta;
+        const std::complex<double> phi = Characteristic(u, T);
+        if(std::norm(phi) < 1e-32)
+        {
+            terms = k;
+            break;
+        }
+        double chi, psi;
+        if(k == 0)
+        {
+            chi = exp_d - exp_c;
+            psi = d - c;
+        }
+        else
+        {
+            const double cos_d = cos(u*(d - a)), sin_d = sin(u*(d - a));     // At c = a, cos = 1 and sin = 0
+            chi = (cos_d*exp_d - exp_c + u*sin_d*exp_d) / (1.0 + u*u);
+            psi = sin_d / u;
+        }
+        const double V = 2.0/(b - a)*(psi - chi);
+        coefficients[k] = phi*((k == 0) ? 0.5*V : V);
+    }
+
+    // Put = K*DF_R*sum of Re(A_k exp(i u_k (x - a))), strikes in blocks: the phases advance by one complex product per term, and the inner loop over strikes vectorizes
+    double phase_re[Ladder_Block], phase_im[Ladder_Block], step_re[Ladder_Block], step_im[Ladder_Block], sum[Ladder_Block];
+    const std::complex<double>* A = coefficients.data();
+    for(std::size_t begin = 0; begin < size; begin += Ladder_Block)
+    {
+        const std::size_t count = std::min(Ladder_Block, size - begin);
+        for(std::size_t j = 0; j < count; j++)
+        {
+            const double angle = delta*(x[begin + j] - a);
+            phase_re[j] = 1.0; phase_im[j] = 0.0;
+            step_re[j] = cos(angle); step_im[j] = sin(angle);
+            sum[j] = 0.0;
+        }
+        for(std::size_t k = 0; k < terms; k++)
+        {
+            const double A_re = A[k].real(), A_im = A[k].imag();
+            for(std::size_t j = 0; j < count; j++)
+            {
+                sum[j] += A_re*phase_re[j] - A_im*phase_im[j];
+                const double re = phase_re[j]*step_re[j] - phase_im[j]*step_im[j];
+                phase_im[j] = phase_re[j]*step_im[j] + phase_im[j]*step_re[j];
+                phase_re[j] = re;
+            }
+        }
+        for(std::size_t j = 0; j < count; j++)
+        {
+            results[begin + j] = std::max(K[begin + j]*DF_R*sum[j], 0.0);     // The truncated series can be slightly negative far out of the money
+        }
+    }
+}
+
+double HestonEngine::Call_Price(const Param_Data& source_params) const
+{
+    std::vector<double> results;
+    Price_Strikes(Option_Type::Call, source_params.m_S, source_params.m_T, source_params.m_R, source_params.m_B, std::vector<double>(1, source_params.m_K), results);
+    return results[0];
+}
+
+double HestonEngine::Put_Price(const Param_Data& source_params) const
+{
+    std::vector<double> results;
+    Price_Strikes(Option_Type::Put, source_params.m_S, source_params.m_T, source_params.m_R, source_params.m_B, std::vector<double>(1, source_params.m_K), results);
+    return results[0];
+}
+
+void HestonEngine::Price_Strikes(const Option_Type& optiontype, const double& S, const double& T, const double& R, const double& B, const std::vector<double>& K,
+    std::vector<double>& results) const
+{
+    if(!(T > 0.0)){throw std::invalid_argument("Error: Heston pricing requires a positive time to expiry.");}
+    const double DF_R = exp(-R*T), F = S*exp(B*T);
+
+    std::vector<double> x(K.size());
+    for(std::size_t i = 0; i < K.size(); i++)
+    {
+        x[i] = log(F/K[i]);
+    }
+    results.resize(K.size());
+    std::vector<std::complex<double>> coefficients;
+    Put_Ladder(T, DF_R, x.data(), K.data(), K.size(), results.data(), coefficients);
+
+    if(optiontype == Option_Type::Call)     // Put-call parity: C = P + DF_R*(F - K)
+    {
+        for(std::size_t i = 0; i < K.size(); i++)
+        {
+            results[i] += DF_R*(F - K[i]);
+        }
+    }
+}
+
+void HestonEngine::Price_Batch(const Option_Type& optiontype, const std::vector<double>& S, const std::vector<double>& K, const DiscountCache& cache,
+    std::vector<double>& results) const
+{
+    const std::vector<std::size_t>& index = cache.getIndex();   // Position of the expiry of each option among the distinct expiries
+    if(S.size() != index.size() || K.size() != index.size())
+    {
+        throw std::invalid_argument("Error: Batch vectors are not of the same size as the discount factor cache.");
+    }
+    const std::vector<double>& expiries = cache.getExpiries();
+    const std::vector<double>& DF_R = cache.getDF_R();
+    const std::vector<double>& DF_B = cache.getDF_B();
+
+    // Options grouped by expiry (counting sort on the expiry index), so that each expiry is one ladder
+    std::vector<std::size_t> start(expiries.size() + 1, 0), order(index.size());
+    for(std::size_t i = 0; i < index.size(); i++){start[index[i] + 1]++;}
+    for(std::size_t e = 0; e < expiries.size(); e++){start[e + 1] += start[e];}
+    std::vector<std::size_t> next(start.begin(), start.end() - 1);
+    for(std::size_t i = 0; i < index.size(); i++){order[next[index[i]]++] = i;}
+
+    results.resize(index.size());
+    std::vector<double> x(index.size()), strikes(index.size()), prices(index.size());
+    std::vector<std::complex<double>> coefficients;
+    for(std::size_t e = 0; e < expiries.size(); e++)
+    {
+        const std::size_t begin = start[e], count = start[e + 1] - begin;
+        if(count == 0){continue;}
+        if(!(expiries[e] > 0.0)){throw std::invalid_argument("Error: Heston pricing requires a positive time to expiry.");}
+        for(std::size_t j = begin; j < begin + count; j++)
+        {
+            const std::size_t i = order[j];
+            x[j] = log(S[i] / (DF_B[e]*K[i]));
+            strikes[j] = K[i];
+        }
+        Put_Ladder(expiries[e], DF_R[e], &x[begin], &strikes[begin], count, &prices[begin], coefficients);
+        for(std::size_t j = begin; j < begin + count; j++)
+        {
+            const std::size_t i = order[j];
+            results[i] = (optiontype == Option_Type::Call) ? prices[j] + DF_R[e]*(S[i]/DF_B[e] - K[i]) : prices[j];
+        }
+    }
+}
+
+
+//GETTERS AND SETTERS
+
+Heston_Params const& HestonEngine::getHeston() const
+{
+    return m_heston;
+}
+
+std::size_t const& HestonEngine::getTerms() const
+{
+    return m_terms;
+}
+
+double const& HestonEngine::getTruncation() const
+{
+    return m_truncation;
+}
+
+void HestonEngine::setHeston(const Heston_Params& heston)
+{
+    const Heston_Params previous = m_heston;
+    m_heston = heston;
+    try
+    {
+        Check_Params();
+    }
+    catch(const std::invalid_argument&)
+    {
+        m_heston = previous;
+        throw;
+    }
+}
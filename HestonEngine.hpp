@@ -0,0 +1,82 @@
+//HestonEngine.hpp
+//
+//Purpose: Heston stochastic volatility pricing of European options by the COS method of Fang and Oosterlee: the density of the log-price at expiry is expanded
+//         in a cosine series on a truncation interval, whose coefficients come from the characteristic function. The characteristic function is that of
+//         ln(S(T)/F), which does not depend on the strike, and the put payoff is expressed in y = ln(S(T)/K): with one truncation interval covering the whole
+//         strike ladder of an expiry, the characteristic function, the payoff coefficients and their products are computed once per expiry, and each strike only
+//         costs one pass of complex multiply-adds over the cached coefficients (the phases exp(i u_k x) follow by recurrence, without trigonometric functions).
+//         Puts are priced by the series, which is stable for deep strikes, and calls by put-call parity. The characteristic function uses the formulation of
+//         Albrecher et al. ("little Heston trap"), continuous in the complex logarithm.
+//
+//Modification date: 10/18/2026
+
+#ifndef HestonEngine_hpp
+#define HestonEngine_hpp
+
+#include "PricingEngine.hpp"    //PricingEngine base class
+#include "OptionData.hpp"       //Option_Type enum class, Param_Data
+#include "TermStructure.hpp"    //DiscountCache, for the batch interface
+#include <vector>
+#include <complex>
+#include <cstddef>
+
+// Heston dynamics: dv = kappa*(theta - v)dt + xi*sqrt(v)dW_v, dS/S = B dt + sqrt(v)dW_S, with d<W_S,W_v> = rho dt
+struct Heston_Params
+{
+    double m_v0;        // Initial variance
+    double m_kappa;     // Speed of mean reversion of the variance
+    double m_theta;     // Long-run variance
+    double m_xi;        // Volatility of the variance
+    double m_rho;       // Correlation of the underlying and its variance
+};
+
+class HestonEngine: public PricingEngine
+{
+    private:
+        Heston_Params m_heston;
+        std::size_t m_terms;        // Number of terms of the cosine series for a single strike, more for ladders spreading wider than the truncation interval
+        double m_truncation;        // Half-width of the truncation interval, in standard deviations of ln(S(T)/F)
+
+        void Check_Params() const;
+
+        // Put prices of a strike ladder of one expiry, from the log-moneyness x = ln(F/K) of each option and the discount factor DF_R: the coefficients are built
+        // once for all the strikes, into the workspace provided
+        void Put_Ladder(const double& T, const double& DF_R, const double* x, const double* K, const std::size_t& size, double* results,
+            std::vector<std::complex<double>>& coefficients) const;
+
+    public:
+    //CONSTRUCTORS AND DESTRUCTOR
+
+        HestonEngine();                                             // Default constructor: v0 = theta = 0.09 (30% vol), kappa 1.5, xi 0.5, rho -0.7, 256 terms, 16 deviations
+        HestonEngine(const Heston_Params& heston, const std::size_t& terms = 256, const double& truncation = 16.0);    // Overloaded constructor
+        HestonEngine(const HestonEngine& source);                   // Copy constructor
+        virtual ~HestonEngine();                                    // Destructor
+        HestonEngine& operator = (const HestonEngine& source);      // Assignment operator
+
+    //PRICING
+
+        // Characteristic function E[exp(i u ln(S(T)/F))] of the log-price relative to the forward
+        std::complex<double> Characteristic(const double& u, const double& T) const;
+
+        // Single options, from S, K, T, R and B (m_Sig and m_h are not used): a ladder of one strike
+        double Call_Price(const Param_Data& source_params) const;
+        double Put_Price(const Param_Data& source_params) const;
+
+        // Strike ladder of one expiry, for one set of S, T, R and B. Results are written into the vector provided.
+        void Price_Strikes(const Option_Type& optiontype, const double& S, const double& T, const double& R, const double& B, const std::vector<double>& K,
+            std::vector<double>& results) const;
+
+        // Batch pricing with the interface of BSExactPricingEngine::Price_BS_Batch(), the volatility coming from the model: the options are grouped by distinct
+        // expiry of the cache, and each group priced as one ladder, with the discount factors of the cache. Results are written into the vector provided.
+        void Price_Batch(const Option_Type& optiontype, const std::vector<double>& S, const std::vector<double>& K, const DiscountCache& cache,
+            std::vector<double>& results) const;
+
+    //GETTERS AND SETTERS
+        Heston_Params const& getHeston() const;
+        std::size_t const& getTerms() const;
+        double const& getTruncation() const;
+
+        void setHeston(const Heston_Params& heston);
+};
+
+#endif //HestonEngine_hpp
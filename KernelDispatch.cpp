@@ -0,0 +1,145 @@
+//KernelDispatch.cpp
+//
+//Purpose: Runtime dispatch of the batch Black-Scholes and inverse normal kernels of PricingKernels.hpp to the widest instruction set supported by the CPU. The CMake build compiles
+//         KernelVariants.cpp once per instruction set (SSE4.2, AVX2 with FMA, AVX-512), each copy in its own namespace so that no instruction set leaks into
+//         another through shared inline functions, and the variant is chosen once at startup with __builtin_cpu_supports(). Builds without these variants
+//         (hand-compiled, or non-x86) only have the generic variant, compiled with the default flags.
+//
+//Modification date: 10/18/2026
+
+
+#include "KernelDispatch.hpp"
+#include <atomic>
+#include <stdexcept>
+
+
+// Variants defined in KernelVariants.cpp. PRICING_KERNEL_<ISA> is defined by the build for each variant it compiles.
+#define KERNEL_DECLARE(ISA) \
+    void Price_BS_Batch_##ISA(const Option_Type& optiontype, const std::size_t& size, const double* S, const double* K, const double* T, const double* R, \
+        const double* Sig, const double* B, double* results); \
+    void Price_BS_Batch_##ISA(const Option_Type& optiontype, const std::size_t& size, const float* S, const float* K, const float* T, const float* R, \
+        const float* Sig, const float* B, float* results); \
+    void Inverse_N_Batch_##ISA(const std::size_t& size, const double* p, double* x); \
+    void Inverse_N_Batch_##ISA(const std::size_t& size, const float* p, float* x);
+
+KERNEL_DECLARE(Generic)
+#ifdef PRICING_KERNEL_SSE4
+KERNEL_DECLARE(SSE4)
+#endif
+#ifdef PRICING_KERNEL_AVX2
+KERNEL_DECLARE(AVX2)
+#endif
+#ifdef PRICING_KERNEL_AVX512
+KERNEL_DECLARE(AVX512)
+#endif
+
+typedef void (*Batch_Double)(const Option_Type&, const std::size_t&, const double*, const double*, const double*, const double*, const double*, const double*, double*);
+typedef void (*Batch_Float)(const Option_Type&, const std::size_t&, const float*, const float*, const float*, const float*, const float*, const float*, float*);
+typedef void (*Inverse_Double)(const std::size_t&, const double*, double*);
+typedef void (*Inverse_Float)(const std::size_t&, const float*, float*);
+
+// Entry points of each variant, indexed by Kernel_ISA, null when not built
+struct Kernel_Variant
+{
+    Batch_Double m_double;
+    Batch_Float m_float;
+    Inverse_Double m_inverse_double;
+    Inverse_Float m_inverse_float;
+};
+
+static const Kernel_Variant Variants[4] =
+{
+    {&Price_BS_Batch_Generic, &Price_BS_Batch_Generic, &Inverse_N_Batch_Generic, &Inverse_N_Batch_Generic},
+#ifdef PRICING_KERNEL_SSE4
+    {&Price_BS_Batch_SSE4, &Price_BS_Batch_SSE4, &Inverse_N_Batch_SSE4, &Inverse_N_Batch_SSE4},
+#else
+    {nullptr, nullptr, nullptr, nullptr},
+#endif
+#ifdef PRICING_KERNEL_AVX2
+    {&Price_BS_Batch_AVX2, &Price_BS_Batch_AVX2, &Inverse_N_Batch_AVX2, &Inverse_N_Batch_AVX2},
+#else
+    {nullptr, nullptr, nullptr, nullptr},
+#endif
+#ifdef PRICING_KERNEL_AVX512
+    {&Price_BS_Batch_AVX512, &Price_BS_Batch_AVX512, &Inverse_N_Batch_AVX512, &Inverse_N_Batch_AVX512},
+#else
+    {nullptr, nullptr, nullptr, nullptr},
+#endif
+};
+
+bool Kernel_ISA_Available(const Kernel_ISA& isa)
+{
+    if(Variants[static_cast<int>(isa)].m_double == nullptr){return false;}
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    switch(isa)
+    {
+        case (Kernel_ISA::SSE4):    return __builtin_cpu_supports("sse4.2");
+        case (Kernel_ISA::AVX2):    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+        case (Kernel_ISA::AVX512):  return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq");
+        default:                    return true;
+    }
+#else
+    return isa == Kernel_ISA::Generic;
+#endif
+}
+
+Kernel_ISA Kernel_ISA_Detected()
+{
+    const Kernel_ISA order[3] = {Kernel_ISA::AVX512, Kernel_ISA::AVX2, Kernel_ISA::SSE4};
+    for(int i = 0; i < 3; i++)
+    {
+        if(Kernel_ISA_Available(order[i])){return order[i];}
+    }
+    return Kernel_ISA::Generic;
+}
+
+// Active variant, detected on first use
+static std::atomic<int>& Active()
+{
+    static std::atomic<int> active(static_cast<int>(Kernel_ISA_Detected()));
+    return active;
+}
+
+Kernel_ISA Kernel_ISA_Active()
+{
+    return static_cast<Kernel_ISA>(Active().load(std::memory_order_relaxed));
+}
+
+void Kernel_ISA_Select(const Kernel_ISA& isa)
+{
+    if(!Kernel_ISA_Available(isa)){throw std::invalid_argument("Error: kernel variant " + Kernel_ISA_Name(isa) + " is not available in this build or on this CPU.");}
+    Active().store(static_cast<int>(isa), std::memory_order_relaxed);
+}
+
+std::string Kernel_ISA_Name(const Kernel_ISA& isa)
+{
+    switch(isa)
+    {
+        case (Kernel_ISA::SSE4):    return "SSE4.2";
+        case (Kernel_ISA::AVX2):    return "AVX2";
+        case (Kernel_ISA::AVX512):  return "AVX-512";
+        default:                    return "Generic";
+    }
+}
+
+void Price_BS_Batch_Dispatch(const Option_Type& optiontype, const std::size_t& size, const double* S, const double* K, const double* T, const double* R,
+    const double* Sig, const double* B, double* results)
+{
+    Variants[Active().load(std::memory_order_relaxed)].m_double(optiontype, size, S, K, T, R, Sig, B, results);
+}
+
+void Price_BS_Batch_Dispatch(const Option_Type& optiontype, const std::size_t& size, const float* S, const float* K, const float* T, const float* R,
+    const float* Sig, const float* B, float* results)
+{
+    Variants[Active().load(std::memory_order_relaxed)].m_float(optiontype, size, S, K, T, R, Sig, B, results);
+}
+
+void Inverse_N_Batch_Dispatch(const std::size_t& size, const double* p, double* x)
+{
+    Variants[Active().load(std::memory_order_relaxed)].m_inverse_double(size, p, x);
+}
+
+void Inverse_N_Batch_Dispatch(const std::size_t& size, const float* p, float* x)
+{
+    Variants[Active().load(std::memory_order_relaxed)].m_inverse_float(size, p, x);
+}
@@ -0,0 +1,40 @@
+//KernelDispatch.hpp
+//
+//Purpose: Runtime dispatch of the batch Black-Scholes and inverse normal kernels of PricingKernels.hpp to the widest instruction set supported by the CPU. The CMake build compiles
+//         KernelVariants.cpp once per instruction set (SSE4.2, AVX2 with FMA, AVX-512), each copy in its own namespace so that no instruction set leaks into
+//         another through shared inline functions, and the variant is chosen once at startup with __builtin_cpu_supports(). Builds without these variants
+//         (hand-compiled, or non-x86) only have the generic variant, compiled with the default flags.
+//         With PRICING_VECTOR_MATH (off by default), the variants are compiled with -ffast-math: glibc then provides SIMD versions of exp(), log() and erfc()
+//         (libmvec), so the kernels process 4 to 16 options per instruction, but the variants assume finite inputs and their results depend on the CPU.
+//
+//Modification date: 10/18/2026
+
+#ifndef KernelDispatch_hpp
+#define KernelDispatch_hpp
+
+#include "OptionData.hpp"
+#include <string>
+#include <cstddef>
+
+enum class Kernel_ISA
+{
+    Generic, SSE4, AVX2, AVX512
+};
+
+bool Kernel_ISA_Available(const Kernel_ISA& isa);   // True if the variant was built and the CPU supports it
+Kernel_ISA Kernel_ISA_Detected();                   // Widest available variant, selected by default
+Kernel_ISA Kernel_ISA_Active();                     // Variant currently used by the dispatching functions
+void Kernel_ISA_Select(const Kernel_ISA& isa);      // Overrides the selection (e.g. to compare variants), throws if the variant is not available
+std::string Kernel_ISA_Name(const Kernel_ISA& isa);
+
+// Batch prices over parameter columns with the active variant, as BS_Kernel<Real>::Price_Batch()
+void Price_BS_Batch_Dispatch(const Option_Type& optiontype, const std::size_t& size, const double* S, const double* K, const double* T, const double* R,
+    const double* Sig, const double* B, double* results);
+void Price_BS_Batch_Dispatch(const Option_Type& optiontype, const std::size_t& size, const float* S, const float* K, const float* T, const float* R,
+    const float* Sig, const float* B, float* results);
+
+// Batch inverse normal CDF with the active variant, as BS_Kernel<Real>::Inverse_N_Batch(): p in (0,1)
+void Inverse_N_Batch_Dispatch(const std::size_t& size, const double* p, double* x);
+void Inverse_N_Batch_Dispatch(const std::size_t& size, const float* p, float* x);
+
+#endif //KernelDispatch_hpp
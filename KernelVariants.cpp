@@ -0,0 +1,49 @@
+//KernelVariants.cpp
+//
+//Purpose: One instruction-set variant of the batch Black-Scholes and inverse normal kernels, selected at runtime by KernelDispatch.cpp. This file is compiled once per variant with
+//         KERNEL_ISA set to its name (Generic, SSE4, AVX2 or AVX512) and the matching compiler flags. PricingKernels.hpp is included inside a namespace named after
+//         the variant: otherwise its inline functions would be emitted with the same names by every variant, and the linker could keep an AVX-512 copy for
+//         callers on CPUs without AVX-512.
+//
+//Modification date: 10/18/2026
+
+
+#include "OptionData.hpp"   // Included at global scope first, so that the include guards skip them inside the namespace below
+#include <vector>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+
+#ifndef KERNEL_ISA
+#define KERNEL_ISA Generic
+#endif
+
+#define KERNEL_PASTE(a, b) a##_##b
+#define KERNEL_NAME(a, b) KERNEL_PASTE(a, b)
+
+namespace KERNEL_NAME(Kernels, KERNEL_ISA)
+{
+#include "PricingKernels.hpp"
+}
+
+void KERNEL_NAME(Price_BS_Batch, KERNEL_ISA)(const Option_Type& optiontype, const std::size_t& size, const double* S, const double* K, const double* T,
+    const double* R, const double* Sig, const double* B, double* results)
+{
+    KERNEL_NAME(Kernels, KERNEL_ISA)::BS_Kernel<double>::Price_Batch(optiontype, size, S, K, T, R, Sig, B, results);
+}
+
+void KERNEL_NAME(Price_BS_Batch, KERNEL_ISA)(const Option_Type& optiontype, const std::size_t& size, const float* S, const float* K, const float* T,
+    const float* R, const float* Sig, const float* B, float* results)
+{
+    KERNEL_NAME(Kernels, KERNEL_ISA)::BS_Kernel<float>::Price_Batch(optiontype, size, S, K, T, R, Sig, B, results);
+}
+
+void KERNEL_NAME(Inverse_N_Batch, KERNEL_ISA)(const std::size_t& size, const double* p, double* x)
+{
+    KERNEL_NAME(Kernels, KERNEL_ISA)::BS_Kernel<double>::Inverse_N_Batch(size, p, x);
+}
+
+void KERNEL_NAME(Inverse_N_Batch, KERNEL_ISA)(const std::size_t& size, const float* p, float* x)
+{
+    KERNEL_NAME(Kernels, KERNEL_ISA)::BS_Kernel<float>::Inverse_N_Batch(size, p, x);
+}
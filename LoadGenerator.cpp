@@ -0,0 +1,149 @@
+//LoadGenerator.cpp
+//
+//Purpose: Local load generator for the pricing server. For each number of requests in flight per connection, it sends a fixed number of pricing requests over
+//         several connections, and reports the throughput against the client-side latency percentiles, so that the batching window of the server can be tuned.
+//
+//         Usage: load_generator [address] [requests per connection] [connections] [in-flight 1] [in-flight 2] ...
+//         Defaults: unix:/tmp/option_pricing.sock, 100000 requests, 4 connections, in-flight 1 8 64 512
+//
+//Modification date: 10/18/2026
+
+
+#include "PricingServer.hpp"
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+// Sends the requests of one connection, keeping at most in_flight of them unanswered, and stores the latency of each reply in microseconds
+static bool Run_Connection(const std::string& address, const std::size_t& requests, const std::size_t& in_flight, std::vector<double>& latencies)
+{
+    int fd = PricingServer::Connect(address);
+    if(fd < 0){return false;}
+
+    std::vector<std::chrono::steady_clock::time_point> sent_at(requests);
+    latencies.assign(requests, 0.0);
+
+    std::size_t sent = 0, received = 0;
+    std::string pending;
+    char buffer[65536];
+    char line[160];
+
+    while(received < requests)
+    {
+        // Filling the window of requests in flight, in one write
+        std::string out;
+        while(sent < requests && sent - received < in_flight)
+        {
+            // Spot, strike and volatility vary with the request, so that a server-side cache cannot answer every request
+            double S = 80.0 + static_cast<double>(sent % 41), Sig = 0.15 + 0.005 * static_cast<double>(sent % 31);
+            int length = std::snprintf(line, sizeof(line), "%zu %c %c %.4f 100 0.5 0.05 %.4f 0.05\n", sent, (sent % 10 == 0) ? 'A' : 'E', (sent % 2 == 0) ? 'C' : 'P', S, Sig);
+            sent_at[sent] = std::chrono::steady_clock::now();
+            out.append(line, static_cast<std::size_t>(length));
+            sent++;
+        }
+        std::size_t written = 0;
+        while(written < out.size())
+        {
+            ssize_t n = ::send(fd, out.data() + written, out.size() - written, MSG_NOSIGNAL);
+            if(n <= 0){::close(fd); return false;}
+            written += static_cast<std::size_t>(n);
+        }
+
+        ssize_t n = ::recv(fd, buffer, sizeof(buffer), 0);
+        if(n <= 0){::close(fd); return false;}
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        pending.append(buffer, static_cast<std::size_t>(n));
+
+        std::size_t start = 0, end;
+        while((end = pending.find('\n', start)) != std::string::npos)
+        {
+            std::size_t id = static_cast<std::size_t>(std::strtoull(pending.c_str() + start, nullptr, 10));
+            if(id < requests)
+            {
+                latencies[id] = std::chrono::duration<double, std::micro>(now - sent_at[id]).count();
+            }
+            received++;
+            start = end + 1;
+        }
+        pending.erase(0, start);
+    }
+
+    ::close(fd);
+    return true;
+}
+
+static double Percentile(const std::vector<double>& sorted, const double& q)
+{
+    if(sorted.empty()){return 0.0;}
+    return sorted[static_cast<std::size_t>(q * static_cast<double>(sorted.size() - 1))];
+}
+
+
+int main(int argc, char* argv[])
+{
+    std::string address = (argc > 1) ? argv[1] : "unix:/tmp/option_pricing.sock";
+    std::size_t requests = (argc > 2) ? static_cast<std::size_t>(std::atol(argv[2])) : 100000;
+    std::size_t connections = (argc > 3) ? static_cast<std::size_t>(std::atol(argv[3])) : 4;
+
+    std::vector<std::size_t> windows;
+    for(int i = 4; i < argc; i++){windows.push_back(static_cast<std::size_t>(std::atol(argv[i])));}
+    if(windows.empty()){windows = {1, 8, 64, 512};}
+
+    std::cout << "in-flight, requests/s, p50 (us), p99 (us), p99.9 (us), max (us)" << std::endl;
+
+    for(std::size_t w = 0; w < windows.size(); w++)
+    {
+        std::vector<std::vector<double>> latencies(connections);
+        std::vector<char> success(connections, 0);
+        std::vector<std::thread> clients;
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for(std::size_t c = 0; c < connections; c++)
+        {
+            clients.emplace_back([&, c]{success[c] = Run_Connection(address, requests, windows[w], latencies[c]) ? 1 : 0;});
+        }
+        for(std::size_t c = 0; c < connections; c++){clients[c].join();}
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::vector<double> all;
+        for(std::size_t c = 0; c < connections; c++)
+        {
+            if(!success[c])
+            {
+                std::cerr << "Error: Connection to " << address << " failed." << std::endl;
+                return 1;
+            }
+            all.insert(all.end(), latencies[c].begin(), latencies[c].end());
+        }
+        std::sort(all.begin(), all.end());
+
+        std::cout << windows[w] << ", " << static_cast<double>(all.size()) / seconds << ", " << Percentile(all, 0.5) << ", " << Percentile(all, 0.99) << ", "
+                  << Percentile(all, 0.999) << ", " << (all.empty() ? 0.0 : all.back()) << std::endl;
+    }
+
+    // Server-side statistics, for comparison with the client-side latencies
+    int fd = PricingServer::Connect(address);
+    if(fd >= 0)
+    {
+        const char stats[] = "STATS\n";
+        ::send(fd, stats, sizeof(stats) - 1, MSG_NOSIGNAL);
+        char buffer[512];
+        ssize_t n = ::recv(fd, buffer, sizeof(buffer) - 1, 0);
+        if(n > 0)
+        {
+            buffer[n] = '\0';
+            std::cout << buffer;
+        }
+        ::close(fd);
+    }
+    return 0;
+}
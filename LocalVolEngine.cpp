@@ -0,0 +1,332 @@
+//LocalVolEngine.cpp
+//
+//Purpose: Finite-difference pricing of European and American options under local volatility Sig(S,t), on a one-dimensional non-uniform mesh in S (typically
+//         from Mesh_Generate_Clustered(), concentrated around the strikes and the spot). The local volatility is read from a VolSurface, whose strike axis is
+//         taken as S and its expiry axis as calendar time, and the rate and cost of carry from term structures. Time stepping is Crank-Nicolson, with two fully
+//         implicit steps after each payoff starts (Rannacher smoothing of the kinks); the boundary conditions are linearity (zero second derivative) at both
+//         ends of the mesh, which do not depend on the payoff.
+//         Since neither the operator nor the boundary conditions depend on the payoff, a single backward sweep prices any number of options: the tridiagonal
+//         system of each time step is factorized once and solved for every option alive at that time, each option starting from its payoff at its own expiry
+//         (American options are projected on their exercise value after each step). The Dupire forward equation instead gives call prices over the whole
+//         strike mesh and every expiry in a single forward sweep from the spot, which prices any European strip at once. The coefficient, factorization and
+//         value arrays are members, allocated with the mesh and reused by every sweep: an engine is therefore not shared between threads.
+//
+//Modification date: 10/18/2026
+
+
+#include "LocalVolEngine.hpp"
+#include "Mesher.hpp"       // Mesh_Generate_Clustered(), for the default mesh
+#include <cmath>            // For exp(), fabs()
+#include <algorithm>        // For std::sort(), std::unique(), std::upper_bound(), std::max()
+#include <stdexcept>
+
+static const std::size_t Rannacher_Steps = 2;      // Fully implicit steps after a payoff starts
+
+
+static double Payoff(const LocalVol_Option& option, const double& x)
+{
+    return (option.m_optiontype == Option_Type::Call) ? std::max(x - option.m_K, 0.0) : std::max(option.m_K - x, 0.0);
+}
+
+
+//Default constructor
+LocalVolEngine::LocalVolEngine(): LocalVolEngine(VolSurface(), TermStructure(), TermStructure(), Mesh_Generate_Clustered(0.0, 400.0, 400, std::vector<double>(1, 100.0),
+    10.0, 10.0), 200)
+{
+    //std::cout << "Default constructor in LocalVolEngine used." << std::endl;
+}
+
+//Overloaded constructor
+LocalVolEngine::LocalVolEngine(const VolSurface& local_vol, const TermStructure& rate_curve, const TermStructure& carry_curve, const std::vector<double>& mesh,
+    const std::size_t& time_steps): PricingEngine(), m_local_vol(local_vol), m_rate_curve(rate_curve), m_carry_curve(carry_curve), m_mesh(mesh), m_time_steps(time_steps)
+{
+    Check_Mesh();
+    if(time_steps == 0){throw std::invalid_argument("Error: local volatility engine requires at least one time step.");}
+    Allocate();
+    //std::cout << "Overloaded constructor in LocalVolEngine used." << std::endl;
+}
+
+//Copy constructor
+LocalVolEngine::LocalVolEngine(const LocalVolEngine& source): PricingEngine(source), m_local_vol(source.m_local_vol), m_rate_curve(source.m_rate_curve),
+    m_carry_curve(source.m_carry_curve), m_mesh(source.m_mesh), m_time_steps(source.m_time_steps)
+{
+    Allocate();     // The workspace is not copied
+    //std::cout << "Copy constructor in LocalVolEngine used." << std::endl;
+}
+
+//Destructor
+LocalVolEngine::~LocalVolEngine()
+{
+    //std::cout << "Destructor in LocalVolEngine used." << std::endl;
+}
+
+//Assignment operator
+LocalVolEngine& LocalVolEngine::operator = (const LocalVolEngine& source)
+{
+    if (this == &source)    // Checking for self-assignment
+    {
+        return *this;
+    }
+    else
+    {
+        PricingEngine::operator = (source);
+        m_local_vol = source.m_local_vol;
+        m_rate_curve = source.m_rate_curve;
+        m_carry_curve = source.m_carry_curve;
+        m_mesh = source.m_mesh;
+        m_time_steps = source.m_time_steps;
+        Allocate();
+        return *this;
+    }
+}
+
+void LocalVolEngine::Check_Mesh() const
+{
+    if(m_mesh.size() < 3){throw std::invalid_argument("Error: local volatility mesh requires at least 3 points.");}
+    if(m_mesh[0] < 0.0){throw std::invalid_argument("Error: local volatility mesh must be non-negative.");}
+    for(std::size_t i = 1; i < m_mesh.size(); i++)
+    {
+        if(!(m_mesh[i] > m_mesh[i-1])){throw std::invalid_argument("Error: local volatility mesh must be strictly increasing.");}
+    }
+}
+
+void LocalVolEngine::Allocate()
+{
+    const std::size_t n = m_mesh.size();
+    m_lower.assign(n, 0.0); m_diag.assign(n, 0.0); m_upper.assign(n, 0.0);
+    m_factor.assign(n, 0.0); m_pivot.assign(n, 0.0); m_rhs.assign(n, 0.0);
+    m_vols.assign(n, 0.0); m_times.assign(n, 0.0);
+    m_values.clear();
+}
+
+
+//TIME STEPPING
+
+std::vector<double> LocalVolEngine::Time_Nodes(const std::vector<LocalVol_Option>& options) const
+{
+    double T_max = 0.0;
+    for(std::size_t i = 0; i < options.size(); i++)
+    {
+        if(!(options[i].m_T > 0.0)){throw std::invalid_argument("Error: local volatility pricing requires positive expiries.");}
+        T_max = std::max(T_max, options[i].m_T);
+    }
+
+    std::vector<double> nodes;
+    nodes.reserve(m_time_steps + options.size() + 1);
+    for(std::size_t k = 0; k <= m_time_steps; k++){nodes.push_back(T_max*double(k)/double(m_time_steps));}
+    for(std::size_t i = 0; i < options.size(); i++){nodes.push_back(options[i].m_T);}
+    std::sort(nodes.begin(), nodes.end());
+
+    // Expiries closer to a uniform node than a thousandth of a step are merged with it
+    const double tolerance = 1e-3*T_max/double(m_time_steps);
+    std::vector<double> merged(1, nodes[0]);
+    for(std::size_t k = 1; k < nodes.size(); k++)
+    {
+        if(nodes[k] - merged.back() > tolerance){merged.push_back(nodes[k]);}
+    }
+    merged.back() = T_max;
+    return merged;
+}
+
+void LocalVolEngine::Build_Operator(const double& t, const double& drift, const double& discount)
+{
+    // L V = 0.5*Sig(x,t)^2*x^2*V_xx + drift*x*V_x - discount*V, with three-point differences on the non-uniform mesh
+    const std::size_t n = m_mesh.size();
+    const double* x = m_mesh.data();
+    std::fill(m_times.begin(), m_times.end(), t);
+    m_local_vol.Vol_Batch(x, m_times.data(), m_vols.data(), n);
+
+    for(std::size_t i = 1; i + 1 < n; i++)
+    {
+        const double h_minus = x[i] - x[i-1], h_plus = x[i+1] - x[i], h_sum = h_minus + h_plus;
+        const double a = 0.5*m_vols[i]*m_vols[i]*x[i]*x[i], b = drift*x[i];
+        m_lower[i] = (2.0*a - b*h_plus)/(h_minus*h_sum);
+        m_upper[i] = (2.0*a + b*h_minus)/(h_plus*h_sum);
+        m_diag[i] = -2.0*a/(h_minus*h_plus) + b*(h_plus - h_minus)/(h_minus*h_plus) - discount;
+    }
+
+    // Linearity at both ends: no second derivative, and the drift term by a one-sided difference into the mesh
+    const double b_low = drift*x[0] / (x[1] - x[0]), b_high = drift*x[n-1] / (x[n-1] - x[n-2]);
+    m_lower[0] = 0.0; m_diag[0] = -b_low - discount; m_upper[0] = b_low;
+    m_lower[n-1] = -b_high; m_diag[n-1] = b_high - discount; m_upper[n-1] = 0.0;
+}
+
+void LocalVolEngine::Factorize(const double& theta_dt)
+{
+    // Thomas algorithm on the rows of I - theta_dt*L: the pivots and the eliminated upper diagonal are kept for every right-hand side of the step
+    const std::size_t n = m_mesh.size();
+    double pivot = 1.0 - theta_dt*m_diag[0];
+    m_pivot[0] = 1.0/pivot;
+    m_factor[0] = -theta_dt*m_upper[0]*m_pivot[0];
+    for(std::size_t i = 1; i < n; i++)
+    {
+        pivot = (1.0 - theta_dt*m_diag[i]) + theta_dt*m_lower[i]*m_factor[i-1];
+        m_pivot[i] = 1.0/pivot;
+        m_factor[i] = -theta_dt*m_upper[i]*m_pivot[i];
+    }
+}
+
+void LocalVolEngine::Step(double* values, const double& theta_dt, const double& explicit_dt)
+{
+    const std::size_t n = m_mesh.size();
+
+    // Explicit part
+    m_rhs[0] = values[0] + explicit_dt*(m_diag[0]*values[0] + m_upper[0]*values[1]);
+    for(std::size_t i = 1; i + 1 < n; i++)
+    {
+        m_rhs[i] = values[i] + explicit_dt*(m_lower[i]*values[i-1] + m_diag[i]*values[i] + m_upper[i]*values[i+1]);
+    }
+    m_rhs[n-1] = values[n-1] + explicit_dt*(m_lower[n-1]*values[n-2] + m_diag[n-1]*values[n-1]);
+
+    // Implicit part, with the factorization of the step
+    values[0] = m_rhs[0]*m_pivot[0];
+    for(std::size_t i = 1; i < n; i++)
+    {
+        values[i] = (m_rhs[i] + theta_dt*m_lower[i]*values[i-1])*m_pivot[i];
+    }
+    for(std::size_t i = n - 1; i-- > 0;)
+    {
+        values[i] -= m_factor[i]*values[i+1];
+    }
+}
+
+double LocalVolEngine::Interpolate(const double* values, const double& x) const
+{
+    // Quadratic through the three mesh points nearest to x
+    const std::size_t n = m_mesh.size();
+    std::size_t j = std::upper_bound(m_mesh.begin(), m_mesh.end(), x) - m_mesh.begin();     // First mesh point above x
+    if(j == n || (j > 0 && x - m_mesh[j-1] < m_mesh[j] - x)){j--;}                          // Nearest mesh point
+    j = std::min(std::max(j, std::size_t(1)), n - 2);
+    const double x0 = m_mesh[j-1], x1 = m_mesh[j], x2 = m_mesh[j+1];
+    return values[j-1]*(x - x1)*(x - x2)/((x0 - x1)*(x0 - x2)) + values[j]*(x - x0)*(x - x2)/((x1 - x0)*(x1 - x2))
+        + values[j+1]*(x - x0)*(x - x1)/((x2 - x0)*(x2 - x1));
+}
+
+
+//PRICING
+
+void LocalVolEngine::Price_Backward(const std::vector<LocalVol_Option>& options, const double& S, std::vector<double>& results)
+{
+    results.assign(options.size(), 0.0);
+    if(options.empty()){return;}
+    const std::vector<double> nodes = Time_Nodes(options);
+    const std::size_t n = m_mesh.size(), m = options.size();
+    const double tolerance = 1e-3*nodes.back()/double(m_time_steps);
+
+    // Options by decreasing expiry, so that the options alive at any time are the first ones of the order
+    std::vector<std::size_t> order(m);
+    for(std::size_t i = 0; i < m; i++){order[i] = i;}
+    std::sort(order.begin(), order.end(), [&](const std::size_t& i, const std::size_t& j){return options[i].m_T > options[j].m_T;});
+    m_values.resize(n*m);
+
+    std::size_t alive = 0, implicit_steps = 0;
+    for(std::size_t k = nodes.size() - 1; k > 0; k--)
+    {
+        // Options expiring at this node start from their payoff
+        while(alive < m && options[order[alive]].m_T >= nodes[k] - tolerance)
+        {
+            double* values = &m_values[alive*n];
+            for(std::size_t i = 0; i < n; i++){values[i] = Payoff(options[order[alive]], m_mesh[i]);}
+            alive++;
+            implicit_steps = Rannacher_Steps;
+        }
+
+        // One factorization of the step for every option alive
+        const double t_low = nodes[k-1], t_high = nodes[k], dt = t_high - t_low;
+        Build_Operator(0.5*(t_low + t_high), m_carry_curve.Forward_Rate(t_low, t_high), m_rate_curve.Forward_Rate(t_low, t_high));
+        const double theta = (implicit_steps > 0) ? 1.0 : 0.5;
+        if(implicit_steps > 0){implicit_steps--;}
+        Factorize(theta*dt);
+        for(std::size_t o = 0; o < alive; o++)
+        {
+            double* values = &m_values[o*n];
+            Step(values, theta*dt, (1.0 - theta)*dt);
+            if(options[order[o]].m_american)
+            {
+                for(std::size_t i = 0; i < n; i++){values[i] = std::max(values[i], Payoff(options[order[o]], m_mesh[i]));}
+            }
+        }
+    }
+
+    for(std::size_t o = 0; o < m; o++)
+    {
+        results[order[o]] = Interpolate(&m_values[o*n], S);
+    }
+}
+
+void LocalVolEngine::Price_Forward(const std::vector<LocalVol_Option>& options, const double& S, std::vector<double>& results)
+{
+    results.assign(options.size(), 0.0);
+    if(options.empty()){return;}
+    std::vector<double> expiries(options.size());
+    for(std::size_t i = 0; i < options.size(); i++)
+    {
+        if(options[i].m_american){throw std::invalid_argument("Error: the Dupire forward sweep prices European options only.");}
+        expiries[i] = options[i].m_T;
+    }
+    std::sort(expiries.begin(), expiries.end());
+    expiries.erase(std::unique(expiries.begin(), expiries.end()), expiries.end());
+
+    std::vector<double> surface;
+    Dupire_Surface(S, expiries, surface);
+
+    const std::size_t n = m_mesh.size();
+    for(std::size_t i = 0; i < options.size(); i++)
+    {
+        const std::size_t e = std::lower_bound(expiries.begin(), expiries.end(), options[i].m_T) - expiries.begin();
+        const double T = options[i].m_T, K = options[i].m_K;
+        const double call = Interpolate(&surface[e*n], K);
+        results[i] = (options[i].m_optiontype == Option_Type::Call) ? call : call - S*m_rate_curve.DF(T)/m_carry_curve.DF(T) + K*m_rate_curve.DF(T);
+    }
+}
+
+void LocalVolEngine::Dupire_Surface(const double& S, const std::vector<double>& expiries, std::vector<double>& surface)
+{
+    const std::size_t n = m_mesh.size();
+    surface.assign(expiries.size()*n, 0.0);
+    if(expiries.empty()){return;}
+    std::vector<LocalVol_Option> strip(expiries.size());
+    for(std::size_t e = 0; e < expiries.size(); e++)
+    {
+        if(e > 0 && !(expiries[e] > expiries[e-1])){throw std::invalid_argument("Error: Dupire expiries must be strictly increasing.");}
+        strip[e] = LocalVol_Option{S, expiries[e], Option_Type::Call, false};
+    }
+    const std::vector<double> nodes = Time_Nodes(strip);
+    const double tolerance = 1e-3*nodes.back()/double(m_time_steps);
+
+    // C(K, 0) = max(S - K, 0), then dC/dT = 0.5*Sig(K,T)^2*K^2*C_KK - B*K*C_K - (R - B)*C
+    m_values.resize(n);
+    double* call = m_values.data();
+    for(std::size_t i = 0; i < n; i++){call[i] = std::max(S - m_mesh[i], 0.0);}
+
+    std::size_t e = 0, implicit_steps = Rannacher_Steps;
+    for(std::size_t k = 1; k < nodes.size(); k++)
+    {
+        const double t_low = nodes[k-1], t_high = nodes[k], dt = t_high - t_low;
+        const double r = m_rate_curve.Forward_Rate(t_low, t_high), b = m_carry_curve.Forward_Rate(t_low, t_high);
+        Build_Operator(0.5*(t_low + t_high), -b, r - b);
+        const double theta = (implicit_steps > 0) ? 1.0 : 0.5;
+        if(implicit_steps > 0){implicit_steps--;}
+        Factorize(theta*dt);
+        Step(call, theta*dt, (1.0 - theta)*dt);
+
+        while(e < expiries.size() && expiries[e] <= t_high + tolerance)
+        {
+            std::copy(call, call + n, &surface[e*n]);
+            e++;
+        }
+    }
+}
+
+
+//GETTERS
+
+std::vector<double> const& LocalVolEngine::getMesh() const
+{
+    return m_mesh;
+}
+
+std::size_t const& LocalVolEngine::getTimeSteps() const
+{
+    return m_time_steps;
+}
@@ -0,0 +1,83 @@
+//LocalVolEngine.hpp
+//
+//Purpose: Finite-difference pricing of European and American options under local volatility Sig(S,t), on a one-dimensional non-uniform mesh in S (typically
+//         from Mesh_Generate_Clustered(), concentrated around the strikes and the spot). The local volatility is read from a VolSurface, whose strike axis is
+//         taken as S and its expiry axis as calendar time, and the rate and cost of carry from term structures. Time stepping is Crank-Nicolson, with two fully
+//         implicit steps after each payoff starts (Rannacher smoothing of the kinks); the boundary conditions are linearity (zero second derivative) at both
+//         ends of the mesh, which do not depend on the payoff.
+//         Since neither the operator nor the boundary conditions depend on the payoff, a single backward sweep prices any number of options: the tridiagonal
+//         system of each time step is factorized once and solved for every option alive at that time, each option starting from its payoff at its own expiry
+//         (American options are projected on their exercise value after each step). The Dupire forward equation instead gives call prices over the whole
+//         strike mesh and every expiry in a single forward sweep from the spot, which prices any European strip at once. The coefficient, factorization and
+//         value arrays are members, allocated with the mesh and reused by every sweep: an engine is therefore not shared between threads.
+//
+//Modification date: 10/18/2026
+
+#ifndef LocalVolEngine_hpp
+#define LocalVolEngine_hpp
+
+#include "PricingEngine.hpp"    //PricingEngine base class
+#include "OptionData.hpp"       //Option_Type enum class
+#include "VolSurface.hpp"       //Local volatility Sig(S,t)
+#include "TermStructure.hpp"    //Rate and carry curves
+#include <vector>
+#include <cstddef>
+
+struct LocalVol_Option
+{
+    double m_K;
+    double m_T;
+    Option_Type m_optiontype;
+    bool m_american;            // Early exercise at any time, priced by the backward sweep only
+};
+
+class LocalVolEngine: public PricingEngine
+{
+    private:
+        VolSurface m_local_vol;             // Sig(S,t): strikes read as S, expiries as t
+        TermStructure m_rate_curve;
+        TermStructure m_carry_curve;        // Cost of carry B, as the rate of its own curve (DF_B = exp(-B*T))
+        std::vector<double> m_mesh;         // Mesh in S (backward sweep) or K (forward sweep), strictly increasing and non-negative
+        std::size_t m_time_steps;           // Time steps over the longest expiry, the expiries of the options being added as time nodes
+
+        // Workspace, sized with the mesh: operator rows (lower, diagonal, upper), factorization, right-hand side, local vols, and the values of the options
+        std::vector<double> m_lower, m_diag, m_upper;
+        std::vector<double> m_factor, m_pivot, m_rhs;
+        std::vector<double> m_vols, m_times;
+        std::vector<double> m_values;
+
+        void Check_Mesh() const;
+        void Allocate();
+        std::vector<double> Time_Nodes(const std::vector<LocalVol_Option>& options) const;     // 0, the expiries, and the uniform steps, sorted
+        void Build_Operator(const double& t, const double& drift, const double& discount);    // Rows of L at time t, see LocalVolEngine.cpp
+        void Factorize(const double& theta_dt);                 // Thomas factorization of I - theta_dt*L
+        void Step(double* values, const double& theta_dt, const double& explicit_dt);     // values <- (I - theta_dt*L)^-1 (I + explicit_dt*L) values
+        double Interpolate(const double* values, const double& x) const;                  // Quadratic interpolation on the mesh
+
+    public:
+    //CONSTRUCTORS AND DESTRUCTOR
+
+        LocalVolEngine();                                       // Default constructor: flat 30% vol, 8% rate and carry, 400 points clustered at 100 on [0, 400], 200 steps
+        LocalVolEngine(const VolSurface& local_vol, const TermStructure& rate_curve, const TermStructure& carry_curve, const std::vector<double>& mesh,
+            const std::size_t& time_steps);                     // Overloaded constructor
+        LocalVolEngine(const LocalVolEngine& source);           // Copy constructor
+        virtual ~LocalVolEngine();                              // Destructor
+        LocalVolEngine& operator = (const LocalVolEngine& source);  // Assignment operator
+
+    //PRICING
+
+        // One backward sweep for all the options, European or American, of any strikes and expiries, valued at spot S. Results are written into the vector provided.
+        void Price_Backward(const std::vector<LocalVol_Option>& options, const double& S, std::vector<double>& results);
+
+        // One Dupire forward sweep from spot S for all the options, which must be European: calls are read off the surface, puts by put-call parity
+        void Price_Forward(const std::vector<LocalVol_Option>& options, const double& S, std::vector<double>& results);
+
+        // Call prices over the mesh of strikes at each expiry (sorted, positive), from one forward sweep: row i of surface is expiry i
+        void Dupire_Surface(const double& S, const std::vector<double>& expiries, std::vector<double>& surface);
+
+    //GETTERS
+        std::vector<double> const& getMesh() const;
+        std::size_t const& getTimeSteps() const;
+};
+
+#endif //LocalVolEngine_hpp
@@ -1,426 +1,567 @@
-//Matrix.cpp
-
-#ifndef Matrix_cpp
-#define Matrix_cpp
-
-#include "Matrix.hpp"
-#include "BSExactPricingEngine.hpp"
-#include "DividedDifferences.hpp"
-#include "AmericanOption.hpp"
-
-
-// Default constructor
-
-Matrix::Matrix(): m_id(rand())  
-{
-    Init();
-    m_mesh = Mesh_Generate(0.0, 0.0, 0.0);
-    m_param_variable = Param_Type::S;
-    m_exercise_style = Exercise_Type::Spot;
-    m_basetype = Base_Type::European;
-}
-
-//Overloaded constructor
-Matrix::Matrix(const std::vector<double>& source_parameter_data, const double& start_mesh, const double& end_mesh, const double& size_mesh, const Param_Type& source_type, const Base_Type& source_base)  
-{
-    m_id = rand();
-    m_param_variable = source_type;   //Setting for S,K,T,R,Sig if European option, for example
-    m_mesh = Mesh_Generate(start_mesh, end_mesh, size_mesh);      // Create mesh with inputted arguments: start and end of mesh, as well as the mesh size.
-    m_basetype = source_base;         //American or European
-
-    std::vector<double> current_vector = source_parameter_data; // Take the vector of vector parameter data and store it temporarily, so that we can modify a variable with mesh points
-
-    if(m_basetype == Base_Type::European)
-    {
-        switch(m_param_variable)
-        {
-            case (Param_Type::S):
-                for(int i = 0; i < m_mesh.size(); i++)
-                {
-                    current_vector[0] = m_mesh[i];
-                    m_matrixdata.push_back(current_vector);
-                }
-                
-                break;
-            
-            case (Param_Type::K):
-                for(int i =0; i < m_mesh.size(); i++)
-                {
-                    current_vector[1] = m_mesh[i];
-                    m_matrixdata.push_back(current_vector);
-                }
-                break;
-
-            case (Param_Type::T):
-                for(int i =0; i < m_mesh.size(); i++)
-                {
-                    current_vector[2] = m_mesh[i];
-                    m_matrixdata.push_back(current_vector);
-                }
-                break;
-            
-            case (Param_Type::R):
-                for(int i =0; i < m_mesh.size(); i++)
-                {
-                    current_vector[3] = m_mesh[i];
-                    m_matrixdata.push_back(current_vector);
-                }
-                break;
-                        
-            case (Param_Type::Sig):
-                for(int i =0; i < m_mesh.size(); i++)
-                {
-                    current_vector[4] = m_mesh[i];
-                    m_matrixdata.push_back(current_vector);
-                }
-                break;
-
-                //5th element is B, but is either = R, and if not, is set to 0.
-
-            case (Param_Type::h):
-                current_vector.push_back(m_mesh[0]);
-                for(int i =0; i < m_mesh.size(); i++)
-                {
-                    current_vector[6] = m_mesh[i];
-                    m_matrixdata.push_back(current_vector);
-                }
-
-            default:
-                /// ERROR HANDLING
-                break;
-        }
-    }
-    else if (m_basetype == Base_Type::American)
-    {
-        switch(m_param_variable)
-        {
-            case (Param_Type::S):
-            for(int i = 0; i < m_mesh.size(); i++)
-            {
-                current_vector[0] = m_mesh[i];
-                m_matrixdata.push_back(current_vector);
-            }
-            break;
-
-            default:
-            break;
-        }
-    }
-    else
-    {
-        throw std::invalid_argument("Error: BASE TYPE inappropriate for matrix function.");
-    }
-}
-
-// Copy constructor
-Matrix::Matrix(const Matrix& source_matrix): m_id(rand()), m_matrixdata(source_matrix.m_matrixdata), m_mesh(source_matrix.m_mesh), 
-m_param_variable(source_matrix.m_param_variable), m_exercise_style(source_matrix.m_exercise_style), m_basetype(source_matrix.m_basetype)
-{
-    // std::cout << "Copy constructor in Matrix header file used << std::endl;
-}               
-
-
-// Assignment operator
-Matrix Matrix::operator = (const Matrix& source_matrix)     
-{
-    if (this == &source_matrix)
-	{
-		return *this;
-	}
-	else
-	{
-	    m_matrixdata = source_matrix.m_matrixdata;          // Assigning same matrix data
-        m_mesh = source_matrix.m_mesh;                      // Assigning mesh points
-        m_param_variable = source_matrix.m_param_variable;    // Assigning variable (S,K,T,R,Sig)
-        m_exercise_style = source_matrix.m_exercise_style;  // Assigning exercise style (spot, future)
-        m_basetype = source_matrix.m_basetype;              //Assigning base type (American or European)
-
-		return *this;
-	}
-}
-
-//Destructor
-Matrix::~Matrix() 
-{
-    //std::cout << "Destructor in Matrix class used." << std::endl;
-}
-
-
-//FUNCTIONS
-
-//Computes option prices, taking as argument a matrix (a vector of vectors of option data parameters)
-std::vector<double> Matrix::MatrixPricer_BS(const Option_Type& optiontype, const Exercise_Type& exercisetype)
-{
-    if(m_basetype != Base_Type::European){return{};}
-   //Checking if of European option type, and returns nothing if not.
-
-    std::vector<double> results;    // Vector containing the prices
-
-    if(exercisetype == Exercise_Type::Spot && isSpot() || (exercisetype == Exercise_Type::Future && isFuture()))
-    { 
-        if(optiontype == Option_Type::Call)
-        {
-            for(int i=0; i < m_matrixdata.size(); i++)
-            {
-                results.push_back(BSExactPricingEngine::Call_Price_BS(m_matrixdata[i])); 
-            }
-            return results;
-        }
-        else // (optiontype == Option_Type::Put)
-        {
-            for(int i=0; i < m_matrixdata.size(); i++)
-            {
-                results.push_back(BSExactPricingEngine::Put_Price_BS(m_matrixdata[i])); 
-            }
-            return results;
-        }
-    }
-    else
-    {
-        throw std::invalid_argument("Error: EXERCISE TYPE inappropriate for pricing function.");
-    }
-    
-}
-
-
-std::vector<double> Matrix::Matrix_Delta_BS(const Option_Type& optiontype, const Exercise_Type& exercisetype)
-{
-    if(m_basetype != Base_Type::European){return{};}
-   //Checking if of European option type, and returns nothing if not.
-
-    std::vector<double> results;    // Vector containing the prices
-
-    if(exercisetype == Exercise_Type::Spot && isSpot() || (exercisetype == Exercise_Type::Future && isFuture()))
-    {
-        if(optiontype == Option_Type::Call)
-        {
-            for(int i=0; i < m_matrixdata.size(); i++)
-            {
-                results.push_back(BSExactPricingEngine::Call_Delta_BS(m_matrixdata[i])); 
-            }
-        }
-        else // (optiontype == Option_Type::Put)
-        {
-            for(int i=0; i < m_matrixdata.size(); i++)
-            {
-                results.push_back(BSExactPricingEngine::Put_Delta_BS(m_matrixdata[i])); 
-            }
-        }
-    }
-    else
-    {
-        throw std::invalid_argument("Error: EXERCISE TYPE inappropriate for pricing function.");
-    }
-    return results;   
-}
-
-
-std::vector<double> Matrix::Matrix_Gamma_BS(const Option_Type& optiontype, const Exercise_Type& exercisetype)
-{
-    if(m_basetype != Base_Type::European){return{};}
-   //Checking if of European option type, and returns nothing if not.
-
-    std::vector<double> results;    // Vector containing the prices
-
-    if(exercisetype == Exercise_Type::Spot && isSpot() || (exercisetype == Exercise_Type::Future && isFuture()))
-    {
-       for(int i=0; i < m_matrixdata.size(); i++)
-        {
-            results.push_back(BSExactPricingEngine::Gamma_BS(m_matrixdata[i])); 
-        }
-    }
-    else
-    {
-        throw std::invalid_argument("Error: EXERCISE TYPE inappropriate for pricing function.");
-    }
-    return results;
-}
-
-
-
-
-
-void Matrix::Init()
-{
-    m_matrixdata.push_back(std::vector<double>());
-    m_matrixdata[0].assign(6, 0.0);
-}
-
-
-double Matrix::size_matrix() const
- {
-    return m_matrixdata.size();
- }
-
-std::vector<double> Matrix::size_vectorsinmatrix() const
-{
-    std::vector<double> sizes;
-    for(int i=0; i< size_matrix(); i++)
-    {
-        sizes.push_back(m_matrixdata[i].size());
-    }
-    return sizes;
-}
-
-
-bool Matrix::isSpot() const
-{
-    bool result = true;
-    if(m_basetype == Base_Type::European)
-    {
-        for(int i=0; i < m_matrixdata.size(); i++)
-        {
-            //Checking for B = R condition necessary for a stock spot option
-            if(m_matrixdata[i][5] != m_matrixdata[i][3]) 
-            {
-                result = false;
-                break;
-            }
-        }
-        return result;
-    }
-    else if(m_basetype == Base_Type::American)
-    {
-        for(int i=0; i < m_matrixdata.size(); i++)
-        {
-        // Not certain of conditions to check whether Amrican option is spot or future
-        }
-        return result;
-    }
-    else{throw std::invalid_argument("Error: BASE TYPE inappropriate for function.");}
-}
-
-bool Matrix::isFuture() const
-{
-    bool result = true;
-    if(m_basetype == Base_Type::European)
-    {
-        for(int i=0; i < m_matrixdata.size(); i++)
-        {
-            if(m_matrixdata[i][5] != 0.0) //Checking for B = R condition necessary for a stock spot option
-            {
-                result = false;
-                break;
-            }
-        }
-        return result;
-    }
-    else if(m_basetype == Base_Type::American)
-    {
-        for(int i=0; i < m_matrixdata.size(); i++)
-        {
-        // Not certain of conditions to check whether Amrican option is spot or future
-        }
-        return result;
-    }
-    else{throw std::invalid_argument("Error: BASE TYPE inappropriate for function.");}
-}
-
-std::vector<double> const& Matrix::getMesh() const  //Returns mesh vector data points
-{
-    return m_mesh;
-}
-
-void Matrix::printer_Vector()
-{
-    for (const auto &row : m_matrixdata) {
-            for (const auto &element : row) {
-                std::cout << element << " ";
-            }
-            std::cout << std::endl;
-        }
-}
-
-
-// DIVIDED DIFFERENCE
-
-
-std::vector<double> Matrix::Matrix_Delta_DividedDiff(const Option_Type& optiontype, const Exercise_Type& exercisetype)
-{
-    if(m_param_variable != Param_Type::h){std::invalid_argument("Error: Matrix of wrong param type to compute divided differences.");}
-    //Checking if the matrix used is of the right type 
-
-    std::vector<double> results;    // Vector containing the prices
-
-    if(exercisetype == Exercise_Type::Spot && isSpot() || (exercisetype == Exercise_Type::Future && isFuture()))
-    {
-        if(optiontype == Option_Type::Call)
-        {
-            for(int i=0; i < m_matrixdata.size(); i++)
-            {
-                results.push_back(DividedDifferences::Delta_Call_DividedDiff(m_matrixdata[i],Param_Type::h)  ); 
-            }
-        }
-        else // (optiontype == Option_Type::Put)
-        {
-            for(int i=0; i < m_matrixdata.size(); i++)
-            {
-                results.push_back(DividedDifferences::Delta_Put_DividedDiff(m_matrixdata[i],Param_Type::h)  ); 
-            }
-        }
-    }
-    else
-    {
-        throw std::invalid_argument("Error: EXERCISE TYPE inappropriate for pricing function.");
-    }
-    return results;   
-}
-
-
-std::vector<double> Matrix::Matrix_Gamma_DividedDiff(const Exercise_Type& exercisetype)
-{
-    if(m_param_variable != Param_Type::h){std::invalid_argument("Error: Matrix of wrong param type to compute divided differences.");}
-    //Checking if the matrix used is of the right type 
-
-    std::vector<double> results;    // Vector containing the prices
-
-    if(exercisetype == Exercise_Type::Spot && isSpot() || (exercisetype == Exercise_Type::Future && isFuture()))
-    {
-        for(int i=0; i < m_matrixdata.size(); i++)
-        {
-            results.push_back(DividedDifferences::Gamma_DividedDiff(m_matrixdata[i], Param_Type::h) ); 
-        }
-    }
-    else
-    {
-        throw std::invalid_argument("Error: EXERCISE TYPE inappropriate for pricing function.");
-    }
-    return results;
-}
-
-
-std::vector<double> Matrix::Matrix_Pricer_Perp(const Option_Type& optiontype, const Exercise_Type& exercisetype)
-{
-    if(m_basetype != Base_Type::American){return{};}
-   //Checking if of European option type, and returns nothing if not.
-
-    std::vector<double> results;    // Vector containing the prices
-
-    if(exercisetype == Exercise_Type::Spot  || (exercisetype == Exercise_Type::Future ))
-    { 
-        if(optiontype == Option_Type::Call)
-        {
-            for(int i=0; i < m_matrixdata.size(); i++)
-            {
-                results.push_back(AmericanOption::Price_Call_American_Perp(m_matrixdata[i])); 
-            }
-            return results;
-        }
-        else // (optiontype == Option_Type::Put)
-        {
-            for(int i=0; i < m_matrixdata.size(); i++)
-            {
-                results.push_back(AmericanOption::Price_Put_American_Perp(m_matrixdata[i])); 
-            }
-            return results;
-        }
-    }
-    else
-    {
-        throw std::invalid_argument("Error: EXERCISE TYPE inappropriate for pricing function.");
-    }
-    
-}
-
-
+//Matrix.cpp
+
+#ifndef Matrix_cpp
+#define Matrix_cpp
+
+#include "Matrix.hpp"
+#include "BSExactPricingEngine.hpp"
+#include "DividedDifferences.hpp"
+#include "AmericanOption.hpp"
+#include "ResultCache.hpp"
+
+
+// Default constructor
+
+Matrix::Matrix(): m_id(rand())  
+{
+    Init();
+    m_mesh = Mesh_Generate(0.0, 0.0, 0.0);
+    m_param_variable = Param_Type::S;
+    m_exercise_style = Exercise_Type::Spot;
+    m_basetype = Base_Type::European;
+}
+
+//Overloaded constructor
+Matrix::Matrix(const std::vector<double>& source_parameter_data, const double& start_mesh, const double& end_mesh, const double& size_mesh, const Param_Type& source_type, const Base_Type& source_base)  
+    : Matrix(Param_Data_From_Vector(source_parameter_data, source_base), start_mesh, end_mesh, size_mesh, source_type, source_base)
+{
+    //std::cout << "Overloaded constructor taking a vector of parameter data in Matrix class used." << std::endl;
+}
+
+//Overloaded constructor, taking a parameter block. Each mesh point gets a copy of the block with the meshed variable replaced, without further allocation than the matrix itself.
+Matrix::Matrix(const Param_Data& source_parameter_data, const double& start_mesh, const double& end_mesh, const double& size_mesh, const Param_Type& source_type, const Base_Type& source_base)  
+{
+    m_id = rand();
+    m_param_variable = source_type;   //Setting for S,K,T,R,Sig if European option, for example
+    m_mesh = Mesh_Generate(start_mesh, end_mesh, size_mesh);      // Create mesh with inputted arguments: start and end of mesh, as well as the mesh size.
+    m_basetype = source_base;         //American or European
+    m_exercise_style = Exercise_Type::Spot;
+
+    Param_Data current_params = source_parameter_data; // Take the parameter data and store it temporarily, so that we can modify a variable with mesh points
+    double Param_Data::* variable = nullptr;            // Member replaced by the mesh points
+
+    if(m_basetype == Base_Type::European)
+    {
+        switch(m_param_variable)
+        {
+            case (Param_Type::S):   variable = &Param_Data::m_S;    break;
+            case (Param_Type::K):   variable = &Param_Data::m_K;    break;
+            case (Param_Type::T):   variable = &Param_Data::m_T;    break;
+            case (Param_Type::R):   variable = &Param_Data::m_R;    break;
+            case (Param_Type::Sig): variable = &Param_Data::m_Sig;  break;
+            //B is either = R, and if not, is set to 0.
+            case (Param_Type::h):   variable = &Param_Data::m_h;    break;
+            default:
+                /// ERROR HANDLING
+                break;
+        }
+    }
+    else if (m_basetype == Base_Type::American)
+    {
+        switch(m_param_variable)
+        {
+            case (Param_Type::S):   variable = &Param_Data::m_S;    break;
+            default:
+                break;
+        }
+    }
+    else
+    {
+        throw std::invalid_argument("Error: BASE TYPE inappropriate for matrix function.");
+    }
+
+    if(variable != nullptr)
+    {
+        m_matrixdata.reserve(m_mesh.size());
+        for(std::size_t i = 0; i < m_mesh.size(); i++)
+        {
+            current_params.*variable = m_mesh[i];
+            m_matrixdata.push_back(current_params);
+        }
+    }
+}
+
+//Parameter block from a vector of parameter data: (S,K,T,R,Sig,B), optionally followed by h, for European options, and (S,K,R,Sig,B) for American options
+Param_Data Matrix::Param_Data_From_Vector(const std::vector<double>& source_parameter_data, const Base_Type& source_base)
+{
+    Param_Data params = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    const std::vector<double>& v = source_parameter_data;
+
+    if(source_base == Base_Type::European)
+    {
+        if(v.size() < 6){throw std::invalid_argument("Error: European matrix requires parameter data (S,K,T,R,Sig,B).");}
+        params.m_S = v[0]; params.m_K = v[1]; params.m_T = v[2]; params.m_R = v[3]; params.m_Sig = v[4]; params.m_B = v[5];
+        if(v.size() > 6){params.m_h = v[6];}
+    }
+    else if(source_base == Base_Type::American)
+    {
+        if(v.size() < 5){throw std::invalid_argument("Error: American matrix requires parameter data (S,K,R,Sig,B).");}
+        params.m_S = v[0]; params.m_K = v[1]; params.m_R = v[2]; params.m_Sig = v[3]; params.m_B = v[4];
+    }
+    else
+    {
+        throw std::invalid_argument("Error: BASE TYPE inappropriate for matrix function.");
+    }
+    return params;
+}
+
+// Copy constructor
+Matrix::Matrix(const Matrix& source_matrix): m_id(rand()), m_matrixdata(source_matrix.m_matrixdata), m_mesh(source_matrix.m_mesh), 
+m_param_variable(source_matrix.m_param_variable), m_exercise_style(source_matrix.m_exercise_style), m_basetype(source_matrix.m_basetype)
+{
+    // std::cout << "Copy constructor in Matrix header file used << std::endl;
+}               
+
+
+// Assignment operator
+Matrix Matrix::operator = (const Matrix& source_matrix)     
+{
+    if (this == &source_matrix)
+	{
+		return *this;
+	}
+	else
+	{
+	    m_matrixdata = source_matrix.m_matrixdata;          // Assigning same matrix data
+        m_mesh = source_matrix.m_mesh;                      // Assigning mesh points
+        m_param_variable = source_matrix.m_param_variable;    // Assigning variable (S,K,T,R,Sig)
+        m_exercise_style = source_matrix.m_exercise_style;  // Assigning exercise style (spot, future)
+        m_basetype = source_matrix.m_basetype;              //Assigning base type (American or European)
+
+		return *this;
+	}
+}
+
+//Destructor
+Matrix::~Matrix() 
+{
+    //std::cout << "Destructor in Matrix class used." << std::endl;
+}
+
+
+//FUNCTIONS
+
+//Computes option prices, taking as argument a matrix (a vector of vectors of option data parameters)
+std::vector<double> Matrix::MatrixPricer_BS(const Option_Type& optiontype, const Exercise_Type& exercisetype)
+{
+    if(m_basetype != Base_Type::European){return{};}
+   //Checking if of European option type, and returns nothing if not.
+
+    std::vector<double> results;    // Vector containing the prices
+    results.reserve(m_matrixdata.size());
+
+    if(exercisetype == Exercise_Type::Spot && isSpot() || (exercisetype == Exercise_Type::Future && isFuture()))
+    { 
+        if(optiontype == Option_Type::Call)
+        {
+            for(int i=0; i < m_matrixdata.size(); i++)
+            {
+                const Param_Data& p = m_matrixdata[i];
+                results.push_back(BS_Kernel<double>::Call_Price(p.m_S, p.m_K, p.m_T, p.m_R, p.m_Sig, p.m_B));
+            }
+            return results;
+        }
+        else // (optiontype == Option_Type::Put)
+        {
+            for(int i=0; i < m_matrixdata.size(); i++)
+            {
+                const Param_Data& p = m_matrixdata[i];
+                results.push_back(BS_Kernel<double>::Put_Price(p.m_S, p.m_K, p.m_T, p.m_R, p.m_Sig, p.m_B));
+            }
+            return results;
+        }
+    }
+    else
+    {
+        throw std::invalid_argument("Error: EXERCISE TYPE inappropriate for pricing function.");
+    }
+    
+}
+
+
+//Computes option prices with the volatility of each vector of parameter data taken from the volatility surface, at its strike (element 1) and expiry (element 2)
+std::vector<double> Matrix::MatrixPricer_BS(const Option_Type& optiontype, const Exercise_Type& exercisetype, const VolSurface& surface)
+{
+    if(m_basetype != Base_Type::European){return{};}
+   //Checking if of European option type, and returns nothing if not.
+
+    if(!((exercisetype == Exercise_Type::Spot && isSpot()) || (exercisetype == Exercise_Type::Future && isFuture())))
+    {
+        throw std::invalid_argument("Error: EXERCISE TYPE inappropriate for pricing function.");
+    }
+
+    std::vector<double> strikes(m_matrixdata.size()), expiries(m_matrixdata.size()), vols(m_matrixdata.size());
+    for(std::size_t i = 0; i < m_matrixdata.size(); i++)  // Gathering strikes and expiries, so that the surface is looked up in one batch
+    {
+        strikes[i] = m_matrixdata[i].m_K;
+        expiries[i] = m_matrixdata[i].m_T;
+    }
+    surface.Vol_Batch(strikes.data(), expiries.data(), vols.data(), vols.size());
+
+    std::vector<double> results;    // Vector containing the prices
+    results.reserve(m_matrixdata.size());
+
+    for(std::size_t i = 0; i < m_matrixdata.size(); i++)
+    {
+        const Param_Data& row = m_matrixdata[i];
+        if(optiontype == Option_Type::Call)
+        {
+            results.push_back(BS_Kernel<double>::Call_Price(row.m_S, row.m_K, row.m_T, row.m_R, vols[i], row.m_B));
+        }
+        else // (optiontype == Option_Type::Put)
+        {
+            results.push_back(BS_Kernel<double>::Put_Price(row.m_S, row.m_K, row.m_T, row.m_R, vols[i], row.m_B));
+        }
+    }
+    return results;
+}
+
+
+//Computes option prices through the persistent result cache: identical grids priced by the same engine version are returned without repricing
+std::vector<double> Matrix::MatrixPricer_BS(const Option_Type& optiontype, const Exercise_Type& exercisetype, ResultCache& cache)
+{
+    const std::uint32_t engine_version = 2;     // To be bumped whenever the Black-Scholes engine changes its results (2: BS_Kernel, results may differ in the last bit)
+    Cache_Key key = ResultCache::Key(*this, optiontype, exercisetype, "BSExactPricingEngine", engine_version);
+    return cache.Get_Or_Compute(key, [&](){return MatrixPricer_BS(optiontype, exercisetype);});
+}
+
+
+//Float32 screening pricer, using the float batch kernel over parameter columns
+std::vector<float> Matrix::MatrixPricer_BS_Float(const Option_Type& optiontype, const Exercise_Type& exercisetype)
+{
+    if(m_basetype != Base_Type::European){return{};}
+   //Checking if of European option type, and returns nothing if not.
+
+    if(!((exercisetype == Exercise_Type::Spot && isSpot()) || (exercisetype == Exercise_Type::Future && isFuture())))
+    {
+        throw std::invalid_argument("Error: EXERCISE TYPE inappropriate for pricing function.");
+    }
+
+    std::vector<float> results;
+    BS_Kernel<float>::Price_Batch(optiontype, getColumns_Float(), results);
+    return results;
+}
+
+Param_Columns<float> Matrix::getColumns_Float() const
+{
+    if(m_basetype != Base_Type::European){throw std::invalid_argument("Error: BASE TYPE inappropriate for parameter columns.");}
+
+    Param_Columns<float> columns;
+    columns.resize(m_matrixdata.size());
+    for(std::size_t i = 0; i < m_matrixdata.size(); i++)
+    {
+        columns.S[i] = static_cast<float>(m_matrixdata[i].m_S);
+        columns.K[i] = static_cast<float>(m_matrixdata[i].m_K);
+        columns.T[i] = static_cast<float>(m_matrixdata[i].m_T);
+        columns.R[i] = static_cast<float>(m_matrixdata[i].m_R);
+        columns.Sig[i] = static_cast<float>(m_matrixdata[i].m_Sig);
+        columns.B[i] = static_cast<float>(m_matrixdata[i].m_B);
+    }
+    return columns;
+}
+
+
+std::vector<double> Matrix::Matrix_Delta_BS(const Option_Type& optiontype, const Exercise_Type& exercisetype)
+{
+    if(m_basetype != Base_Type::European){return{};}
+   //Checking if of European option type, and returns nothing if not.
+
+    std::vector<double> results;    // Vector containing the prices
+    results.reserve(m_matrixdata.size());
+
+    if(exercisetype == Exercise_Type::Spot && isSpot() || (exercisetype == Exercise_Type::Future && isFuture()))
+    {
+        if(optiontype == Option_Type::Call)
+        {
+            for(int i=0; i < m_matrixdata.size(); i++)
+            {
+                const Param_Data& p = m_matrixdata[i];
+                results.push_back(BS_Kernel<double>::Call_Delta(p.m_S, p.m_K, p.m_T, p.m_R, p.m_Sig, p.m_B));
+            }
+        }
+        else // (optiontype == Option_Type::Put)
+        {
+            for(int i=0; i < m_matrixdata.size(); i++)
+            {
+                const Param_Data& p = m_matrixdata[i];
+                results.push_back(BS_Kernel<double>::Put_Delta(p.m_S, p.m_K, p.m_T, p.m_R, p.m_Sig, p.m_B));
+            }
+        }
+    }
+    else
+    {
+        throw std::invalid_argument("Error: EXERCISE TYPE inappropriate for pricing function.");
+    }
+    return results;   
+}
+
+
+std::vector<double> Matrix::Matrix_Gamma_BS(const Option_Type& optiontype, const Exercise_Type& exercisetype)
+{
+    if(m_basetype != Base_Type::European){return{};}
+   //Checking if of European option type, and returns nothing if not.
+
+    std::vector<double> results;    // Vector containing the prices
+    results.reserve(m_matrixdata.size());
+
+    if(exercisetype == Exercise_Type::Spot && isSpot() || (exercisetype == Exercise_Type::Future && isFuture()))
+    {
+       for(int i=0; i < m_matrixdata.size(); i++)
+        {
+            const Param_Data& p = m_matrixdata[i];
+            results.push_back(BS_Kernel<double>::Gamma(p.m_S, p.m_K, p.m_T, p.m_R, p.m_Sig, p.m_B));
+        }
+    }
+    else
+    {
+        throw std::invalid_argument("Error: EXERCISE TYPE inappropriate for pricing function.");
+    }
+    return results;
+}
+
+
+
+
+
+void Matrix::Init()
+{
+    Param_Data zero = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    m_matrixdata.push_back(zero);
+}
+
+
+double Matrix::size_matrix() const
+ {
+    return m_matrixdata.size();
+ }
+
+std::vector<double> Matrix::size_vectorsinmatrix() const
+{
+    return std::vector<double>(m_matrixdata.size(), static_cast<double>(Row_Size()));
+}
+
+std::size_t Matrix::Row_Size() const
+{
+    if(m_basetype == Base_Type::American){return 5;}
+    return (m_param_variable == Param_Type::h) ? 7 : 6;
+}
+
+
+bool Matrix::isSpot() const
+{
+    bool result = true;
+    if(m_basetype == Base_Type::European)
+    {
+        for(int i=0; i < m_matrixdata.size(); i++)
+        {
+            //Checking for B = R condition necessary for a stock spot option
+            if(m_matrixdata[i].m_B != m_matrixdata[i].m_R) 
+            {
+                result = false;
+                break;
+            }
+        }
+        return result;
+    }
+    else if(m_basetype == Base_Type::American)
+    {
+        for(int i=0; i < m_matrixdata.size(); i++)
+        {
+        // Not certain of conditions to check whether Amrican option is spot or future
+        }
+        return result;
+    }
+    else{throw std::invalid_argument("Error: BASE TYPE inappropriate for function.");}
+}
+
+bool Matrix::isFuture() const
+{
+    bool result = true;
+    if(m_basetype == Base_Type::European)
+    {
+        for(int i=0; i < m_matrixdata.size(); i++)
+        {
+            if(m_matrixdata[i].m_B != 0.0) //Checking for B = R condition necessary for a stock spot option
+            {
+                result = false;
+                break;
+            }
+        }
+        return result;
+    }
+    else if(m_basetype == Base_Type::American)
+    {
+        for(int i=0; i < m_matrixdata.size(); i++)
+        {
+        // Not certain of conditions to check whether Amrican option is spot or future
+        }
+        return result;
+    }
+    else{throw std::invalid_argument("Error: BASE TYPE inappropriate for function.");}
+}
+
+std::vector<double> const& Matrix::getMesh() const  //Returns mesh vector data points
+{
+    return m_mesh;
+}
+
+std::vector<Param_Data> const& Matrix::getMatrixData() const  //Returns parameter data, one parameter block per mesh point
+{
+    return m_matrixdata;
+}
+
+Param_Type const& Matrix::getParamType() const
+{
+    return m_param_variable;
+}
+
+Base_Type const& Matrix::getBaseType() const
+{
+    return m_basetype;
+}
+
+void Matrix::printer_Vector()
+{
+    // Same order as the vectors of parameter data: S,K,T,R,Sig,B[,h] for European options, and S,K,R,Sig,B for American options.
+    // Rows are formatted into one buffer, written by large blocks and flushed once at the end.
+    ReportBuffer buffer(std::cout);
+    for (const auto &row : m_matrixdata) {
+            const double european[7] = {row.m_S, row.m_K, row.m_T, row.m_R, row.m_Sig, row.m_B, row.m_h};
+            const double american[5] = {row.m_S, row.m_K, row.m_R, row.m_Sig, row.m_B};
+            const double* elements = (m_basetype == Base_Type::American) ? american : european;
+            for (std::size_t i = 0; i < Row_Size(); i++) {
+                buffer << elements[i] << " ";
+            }
+            buffer.End_Line();
+        }
+    buffer.Flush(true);
+}
+
+
+void Matrix::Export_Columnar(const std::string& path, const std::vector<std::string>& result_names, const std::vector<std::vector<double>>& results,
+    const Column_Encoding& parameter_encoding, const Column_Encoding& result_encoding) const
+{
+    if(result_names.size() != results.size()){throw std::invalid_argument("Error: One name is needed per result column.");}
+    for(std::size_t r = 0; r < results.size(); r++)
+    {
+        if(results[r].size() != m_matrixdata.size()){throw std::invalid_argument("Error: Result column " + result_names[r] + " is not of the size of the matrix.");}
+    }
+
+    ColumnarWriter writer(path, m_matrixdata.size());
+    writer.Add_Column("mesh", m_mesh, parameter_encoding);
+
+    // Parameter blocks are stored by mesh point: each column is gathered into one reused vector
+    static const char* const european_names[7] = {"S", "K", "T", "R", "Sig", "B", "h"};
+    static const char* const american_names[5] = {"S", "K", "R", "Sig", "B"};
+    static const double Param_Data::* const european_fields[7] = {&Param_Data::m_S, &Param_Data::m_K, &Param_Data::m_T, &Param_Data::m_R, &Param_Data::m_Sig,
+        &Param_Data::m_B, &Param_Data::m_h};
+    static const double Param_Data::* const american_fields[5] = {&Param_Data::m_S, &Param_Data::m_K, &Param_Data::m_R, &Param_Data::m_Sig, &Param_Data::m_B};
+    const bool american = (m_basetype == Base_Type::American);
+    std::vector<double> column(m_matrixdata.size());
+    for(std::size_t p = 0; p < Row_Size(); p++)
+    {
+        const double Param_Data::* field = american ? american_fields[p] : european_fields[p];
+        for(std::size_t i = 0; i < m_matrixdata.size(); i++){column[i] = m_matrixdata[i].*field;}
+        writer.Add_Column(american ? american_names[p] : european_names[p], column, parameter_encoding);
+    }
+
+    for(std::size_t r = 0; r < results.size(); r++){writer.Add_Column(result_names[r], results[r], result_encoding);}
+    writer.Close();
+}
+
+
+// DIVIDED DIFFERENCE
+
+
+std::vector<double> Matrix::Matrix_Delta_DividedDiff(const Option_Type& optiontype, const Exercise_Type& exercisetype)
+{
+    if(m_param_variable != Param_Type::h){throw std::invalid_argument("Error: Matrix of wrong param type to compute divided differences.");}
+    //Checking if the matrix used is of the right type 
+
+    std::vector<double> results;    // Vector containing the prices
+    results.reserve(m_matrixdata.size());
+
+    if(exercisetype == Exercise_Type::Spot && isSpot() || (exercisetype == Exercise_Type::Future && isFuture()))
+    {
+        if(optiontype == Option_Type::Call)
+        {
+            for(int i=0; i < m_matrixdata.size(); i++)
+            {
+                results.push_back(DividedDifferences::Delta_Call_DividedDiff(m_matrixdata[i])); 
+            }
+        }
+        else // (optiontype == Option_Type::Put)
+        {
+            for(int i=0; i < m_matrixdata.size(); i++)
+            {
+                results.push_back(DividedDifferences::Delta_Put_DividedDiff(m_matrixdata[i])); 
+            }
+        }
+    }
+    else
+    {
+        throw std::invalid_argument("Error: EXERCISE TYPE inappropriate for pricing function.");
+    }
+    return results;   
+}
+
+
+std::vector<double> Matrix::Matrix_Gamma_DividedDiff(const Exercise_Type& exercisetype)
+{
+    if(m_param_variable != Param_Type::h){throw std::invalid_argument("Error: Matrix of wrong param type to compute divided differences.");}
+    //Checking if the matrix used is of the right type 
+
+    std::vector<double> results;    // Vector containing the prices
+    results.reserve(m_matrixdata.size());
+
+    if(exercisetype == Exercise_Type::Spot && isSpot() || (exercisetype == Exercise_Type::Future && isFuture()))
+    {
+        for(int i=0; i < m_matrixdata.size(); i++)
+        {
+            results.push_back(DividedDifferences::Gamma_DividedDiff(m_matrixdata[i])); 
+        }
+    }
+    else
+    {
+        throw std::invalid_argument("Error: EXERCISE TYPE inappropriate for pricing function.");
+    }
+    return results;
+}
+
+
+std::vector<double> Matrix::Matrix_Pricer_Perp(const Option_Type& optiontype, const Exercise_Type& exercisetype)
+{
+    if(m_basetype != Base_Type::American){return{};}
+   //Checking if of European option type, and returns nothing if not.
+
+    std::vector<double> results;    // Vector containing the prices
+    results.reserve(m_matrixdata.size());
+
+    if(exercisetype == Exercise_Type::Spot  || (exercisetype == Exercise_Type::Future ))
+    { 
+        if(optiontype == Option_Type::Call)
+        {
+            for(int i=0; i < m_matrixdata.size(); i++)
+            {
+                results.push_back(AmericanOption::Price_Call_American_Perp(m_matrixdata[i])); 
+            }
+            return results;
+        }
+        else // (optiontype == Option_Type::Put)
+        {
+            for(int i=0; i < m_matrixdata.size(); i++)
+            {
+                results.push_back(AmericanOption::Price_Put_American_Perp(m_matrixdata[i])); 
+            }
+            return results;
+        }
+    }
+    else
+    {
+        throw std::invalid_argument("Error: EXERCISE TYPE inappropriate for pricing function.");
+    }
+    
+}
+
+
 #endif //Matrix_cpp
\ No newline at end of file
@@ -1,79 +1,145 @@
-//Mesher.hpp
-//
-//Purpose: Creating a mesh from starting and ending mesh points, and defining mesh point size. There is also << operator overloading and PrintVector() function
-//         to print the output results of the matrices after having been stored into a vector. This function sets mesh points with those data points within the vector provided, and prints out
-//         the appropriate information.
-//Modification dates: 12/30/2022 - 1/25/2023
-
-#ifndef Mesher_hpp
-#define Mesher_hpp
-
-#include <vector>
-#include <iomanip>
-#include <iostream>
-#include <sstream>
-
-enum class Param_Type //Parameter variables, in order to create appropriate mesh points 
-{
-    //S=underlying asset price/ K=strike price/R=interest rate/Sig=volatility/T=time to expiry/h=parameter for divided differences
-    S,K,R,Sig,T, h       
-};
-
-//Create mesh points with starting and ending mesh points, and uniform mesh size
-inline std::vector<double> Mesh_Generate(const double& start_mesh, const double& end_mesh, const double& size_mesh) 
-{
-    std::vector<double> mesh;
-    double tmp = start_mesh; //Take starting point and set it as the beginning of the vector of points
-
-	while(tmp <= end_mesh)   //Iterating through increments of mesh points by storing each new mesh point into the vector, and thus iterating till it reaches the end mesh point
-    {
-        mesh.push_back(tmp);
-        tmp+= size_mesh;    //Resetting value of departing mesh point with previous mesh point attained, and incrementing with uniform mesh size
-    }
-
-    return mesh;
-}
-   
-// Inline definition or there will be a linking error due to GCC compiler.
-// << operator overloading to print out the type of parameter at hand
-inline std::ostream& operator << (std::ostream& os, const Param_Type& source_type) {
-    switch (source_type) {
-        case Param_Type::S:
-            os << "S";
-            break;
-        case Param_Type::K:
-            os << "K";
-            break;
-        case Param_Type::R:
-            os << "R";
-            break;
-        case Param_Type::Sig:
-            os << "Sig";
-            break;
-        case Param_Type::T:
-            os << "T";
-        case Param_Type::h:
-            os << "h";
-            break;
-    }
-    return os;
-}
-
-//Takes a mesh array and the results associated, and prints these as a function of the type of values at hand (Strike, Volatility, etc.)
-inline void Print_Vector(const std::vector<double>& source_mesh, const std::vector<double>& source_results, const Param_Type& source_type)  
-{
-    if(source_mesh.size() == source_results.size()) //Verifying if both vectors are of the same size
-    {
-        for(int i = 0; i < source_mesh.size(); i++) //For-loop iterating through mesh points, and getting associated output results from the vector provided
-        {
-            std::cout << source_type << " at: " << source_mesh[i] <<" = " << source_results[i] << std::endl;
-        }
-    }
-    else
-    {
-        std::cout << "Not of the same size. We cannot print appropriate information if they are not of the same size." << std::endl;
-    }
-}
-
-
-#endif //Mesher_hpp
+//Mesher.hpp
+//
+//Purpose: Creating a mesh from starting and ending mesh points, and defining mesh point size. There is also << operator overloading and PrintVector() function
+//         to print the output results of the matrices after having been stored into a vector. This function sets mesh points with those data points within the vector provided, and prints out
+//         the appropriate information.
+//Modification dates: 12/30/2022 - 1/25/2023
+
+#ifndef Mesher_hpp
+#define Mesher_hpp
+
+#include <vector>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include "ReportFormatter.hpp"
+
+enum class Param_Type //Parameter variables, in order to create appropriate mesh points 
+{
+    //S=underlying asset price/ K=strike price/R=interest rate/Sig=volatility/T=time to expiry/h=parameter for divided differences
+    S,K,R,Sig,T, h       
+};
+
+//Create mesh points with starting and ending mesh points, and uniform mesh size. Templated on the scalar type, so that float grids can be generated for screening.
+template<typename Real>
+inline std::vector<Real> Mesh_Generate(const Real& start_mesh, const Real& end_mesh, const Real& size_mesh) 
+{
+    std::vector<Real> mesh;
+    Real tmp = start_mesh; //Take starting point and set it as the beginning of the vector of points
+
+	while(tmp <= end_mesh)   //Iterating through increments of mesh points by storing each new mesh point into the vector, and thus iterating till it reaches the end mesh point
+    {
+        mesh.push_back(tmp);
+        tmp+= size_mesh;    //Resetting value of departing mesh point with previous mesh point attained, and incrementing with uniform mesh size
+    }
+
+    return mesh;
+}
+   
+//Create Chebyshev points (extrema of the Chebyshev polynomial of degree n, i.e. n+1 points) between the starting and ending mesh points, in increasing order.
+//The points cluster near both ends, which keeps polynomial interpolation on them stable as the degree grows, unlike uniform mesh points.
+inline std::vector<double> Mesh_Generate_Chebyshev(const double& start_mesh, const double& end_mesh, const std::size_t& degree)
+{
+    std::vector<double> mesh(degree + 1, 0.5 * (start_mesh + end_mesh));
+    if(degree == 0){return mesh;}
+    const double pi = 3.14159265358979323846;
+    for(std::size_t j = 0; j <= degree; j++)    // cos(pi*j/n) goes from 1 to -1, so -cos() gives increasing points
+    {
+        mesh[j] = 0.5 * (start_mesh + end_mesh) - 0.5 * (end_mesh - start_mesh) * std::cos(pi * static_cast<double>(j) / static_cast<double>(degree));
+    }
+    return mesh;
+}
+
+//Create mesh points between the starting and ending mesh points, clustered around the centres given (strikes, spot), for PDE grids. The points equidistribute
+//the density 1 + concentration/sqrt(1 + ((x - c)/width)^2), c the nearest centre, which is the density of the sinh mapping of Tavella and Randall: spacing
+//near a centre is about (1 + concentration) times finer than far from every centre. The first and last points are the starting and ending mesh points.
+//Throws std::invalid_argument unless end_mesh > start_mesh, width > 0 and concentration >= 0, for which the mapping would give inf or NaN points.
+inline std::vector<double> Mesh_Generate_Clustered(const double& start_mesh, const double& end_mesh, const std::size_t& points, const std::vector<double>& centres,
+    const double& width, const double& concentration)
+{
+    if(!(end_mesh > start_mesh)){throw std::invalid_argument("Error: Ending mesh point must be above the starting mesh point.");}
+    if(!(width > 0.0)){throw std::invalid_argument("Error: Width of the mesh clustering must be positive.");}
+    if(!(concentration >= 0.0)){throw std::invalid_argument("Error: Concentration of the mesh clustering must be non-negative.");}     // Else the density can be negative
+    std::vector<double> mesh(points, start_mesh);
+    if(points < 2){return mesh;}
+
+    // Cumulative integral of the density on a fine uniform grid, by the trapezoidal rule
+    const std::size_t fine = 64 * points;
+    const double step = (end_mesh - start_mesh) / static_cast<double>(fine);
+    std::vector<double> cumulative(fine + 1, 0.0);
+    double previous = 0.0;
+    for(std::size_t i = 0; i <= fine; i++)
+    {
+        const double x = start_mesh + step * static_cast<double>(i);
+        double nearest = 0.0;   // Largest clustering term, i.e. that of the nearest centre
+        for(std::size_t c = 0; c < centres.size(); c++)
+        {
+            const double z = (x - centres[c]) / width;
+            nearest = std::fmax(nearest, 1.0 / std::sqrt(1.0 + z * z));
+        }
+        const double density = 1.0 + concentration * nearest;
+        if(i > 0){cumulative[i] = cumulative[i-1] + 0.5 * step * (previous + density);}
+        previous = density;
+    }
+
+    // Mesh point j sits where the cumulative integral reaches j/(points-1) of its total, by linear interpolation between fine points
+    std::size_t i = 0;
+    for(std::size_t j = 1; j + 1 < points; j++)
+    {
+        const double target = cumulative[fine] * static_cast<double>(j) / static_cast<double>(points - 1);
+        while(cumulative[i+1] < target){i++;}
+        const double w = (target - cumulative[i]) / (cumulative[i+1] - cumulative[i]);
+        mesh[j] = start_mesh + step * (static_cast<double>(i) + w);
+    }
+    mesh[points - 1] = end_mesh;
+    return mesh;
+}
+
+// Inline definition or there will be a linking error due to GCC compiler.
+// << operator overloading to print out the type of parameter at hand
+inline std::ostream& operator << (std::ostream& os, const Param_Type& source_type) {
+    switch (source_type) {
+        case Param_Type::S:
+            os << "S";
+            break;
+        case Param_Type::K:
+            os << "K";
+            break;
+        case Param_Type::R:
+            os << "R";
+            break;
+        case Param_Type::Sig:
+            os << "Sig";
+            break;
+        case Param_Type::T:
+            os << "T";
+        case Param_Type::h:
+            os << "h";
+            break;
+    }
+    return os;
+}
+
+//Takes a mesh array and the results associated, and prints these as a function of the type of values at hand (Strike, Volatility, etc.)
+//The lines are formatted into one buffer and written by large blocks, with a single flush at the end rather than one std::endl per line.
+inline void Print_Vector(const std::vector<double>& source_mesh, const std::vector<double>& source_results, const Param_Type& source_type)  
+{
+    if(source_mesh.size() == source_results.size()) //Verifying if both vectors are of the same size
+    {
+        std::ostringstream label;                   //Name of the parameter type, formatted once
+        label << source_type;
+        ReportBuffer buffer(std::cout);
+        buffer.Text(label.str(), source_mesh, source_results);
+        buffer.Flush(true);
+    }
+    else
+    {
+        std::cout << "Not of the same size. We cannot print appropriate information if they are not of the same size." << std::endl;
+    }
+}
+
+
+#endif //Mesher_hpp
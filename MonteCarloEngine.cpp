@@ -0,0 +1,360 @@
+//MonteCarloEngine.cpp
+//
+//Purpose: Monte Carlo pricing of path-dependent options under Black-Scholes dynamics (cost of carry B): arithmetic and geometric Asians, knock-in and knock-out
+//         barriers, and fixed and floating strike lookbacks, all monitored at equally spaced dates up to expiry. Paths are never stored: each path is built into a
+//         per-thread buffer of Brownian values and folded into running statistics (sum, log-sum, extremes, barrier hit) as it is walked, and the payoffs into
+//         running sums per block of paths. Normals come from a pseudo-random generator or from a Sobol sequence, through the inverse normal CDF; with the Brownian
+//         bridge, the first coordinates of each point set the terminal value and the coarse shape of the path, where quasi-random points are most uniform.
+//         Paths are split into fixed-size blocks, each with its own stream (a seeded generator, or its own run of Sobol points), processed in parallel and summed
+//         in block order: the price does not depend on the number of threads. The arithmetic Asian uses the closed form of the geometric Asian as a control
+//         variate; barriers and lookbacks use the European option of the same strike.
+//         With Path_Generator::Sobol_Scrambled, the paths are split into independent scrambles of the Sobol sequence (randomized quasi-Monte Carlo): the price is
+//         the mean of their estimates, and its standard error comes from their spread, which is a valid error estimate unlike that of a single Sobol sequence.
+//
+//Modification date: 10/18/2026
+
+
+#include "MonteCarloEngine.hpp"
+#include "SobolSequence.hpp"
+#include "PricingKernels.hpp"   // BS_Kernel<double>, for the closed forms of the control variates
+#include "KernelDispatch.hpp"   // Inverse_N_Batch_Dispatch(), turning the uniforms of each path into normals
+#include "Parallel.hpp"
+#include <random>       // For std::mt19937_64, std::seed_seq
+#include <cmath>        // For exp(), log(), sqrt(), erfc()
+#include <algorithm>    // For std::max(), std::min()
+#include <stdexcept>
+
+
+// Brownian bridge over the times t_0 < ... < t_(n-1): the terminal value first, then each remaining point between its nearest constructed neighbours
+struct Brownian_Bridge
+{
+    std::vector<std::size_t> m_left, m_right, m_point;     // Step i constructs W(t_point) from W(t_(left-1)) (or 0 if left = 0) and W(t_right)
+    std::vector<double> m_left_weight, m_right_weight, m_std_dev;
+};
+
+static Brownian_Bridge Build_Bridge(const std::vector<double>& times)
+{
+    const std::size_t n = times.size();
+    Brownian_Bridge bridge;
+    bridge.m_left.assign(n, 0); bridge.m_right.assign(n, 0); bridge.m_point.assign(n, 0);
+    bridge.m_left_weight.assign(n, 0.0); bridge.m_right_weight.assign(n, 0.0); bridge.m_std_dev.assign(n, 0.0);
+
+    std::vector<std::size_t> constructed(n, 0);     // Step at which each point is constructed, plus one (0 while not yet constructed)
+    constructed[n-1] = 1;
+    bridge.m_point[0] = n - 1;
+    bridge.m_std_dev[0] = sqrt(times[n-1]);
+
+    std::size_t j = 0;
+    for(std::size_t i = 1; i < n; i++)
+    {
+        while(constructed[j] != 0){j++;}           // First point not constructed yet
+        std::size_t k = j;
+        while(constructed[k] == 0){k++;}           // Next constructed point, on the right
+        std::size_t l = j + ((k - 1 - j) >> 1);    // Middle of the gap
+        constructed[l] = i + 1;
+        bridge.m_point[i] = l;
+        bridge.m_left[i] = j;
+        bridge.m_right[i] = k;
+
+        double t_left = (j == 0) ? 0.0 : times[j-1];
+        bridge.m_left_weight[i] = (times[k] - times[l]) / (times[k] - t_left);
+        bridge.m_right_weight[i] = (times[l] - t_left) / (times[k] - t_left);
+        bridge.m_std_dev[i] = sqrt((times[l] - t_left)*(times[k] - times[l]) / (times[k] - t_left));
+
+        j = k + 1;
+        if(j >= n){j = 0;}
+    }
+    return bridge;
+}
+
+static void Bridge_Transform(const Brownian_Bridge& bridge, const double* z, double* w)
+{
+    const std::size_t n = bridge.m_point.size();
+    w[n-1] = bridge.m_std_dev[0]*z[0];
+    for(std::size_t i = 1; i < n; i++)
+    {
+        const std::size_t j = bridge.m_left[i], k = bridge.m_right[i], l = bridge.m_point[i];
+        double left = (j == 0) ? 0.0 : w[j-1];
+        w[l] = bridge.m_left_weight[i]*left + bridge.m_right_weight[i]*w[k] + bridge.m_std_dev[i]*z[i];
+    }
+}
+
+
+// Paths are a whole number of blocks, and with scrambling, a whole number of blocks per scramble
+static std::size_t Paths_Multiple(const Path_Generator& generator)
+{
+    return (generator == Path_Generator::Sobol_Scrambled) ? MonteCarloEngine::Scrambles*MonteCarloEngine::Block_Size : MonteCarloEngine::Block_Size;
+}
+
+
+//Default constructor
+MonteCarloEngine::MonteCarloEngine(): m_paths(65536), m_generator(Path_Generator::Sobol), m_brownian_bridge(true), m_control_variate(true), m_seed(42), m_threads(0)
+{
+    //std::cout << "Default constructor in MonteCarloEngine used." << std::endl;
+}
+
+//Overloaded constructor
+MonteCarloEngine::MonteCarloEngine(const std::size_t& paths, const Path_Generator& generator, const bool& brownian_bridge, const bool& control_variate,
+    const std::uint64_t& seed, const unsigned& threads)
+    : m_paths(((paths + Paths_Multiple(generator) - 1) / Paths_Multiple(generator))*Paths_Multiple(generator)), m_generator(generator), m_brownian_bridge(brownian_bridge), m_control_variate(control_variate),
+    m_seed(seed), m_threads(threads)
+{
+    if(paths < 2){throw std::invalid_argument("Error: at least 2 Monte Carlo paths are required.");}
+    if(m_paths >= (std::size_t(1) << 31)){throw std::invalid_argument("Error: number of Monte Carlo paths beyond the Sobol sequence.");}
+    //std::cout << "Overloaded constructor in MonteCarloEngine used." << std::endl;
+}
+
+//Copy constructor
+MonteCarloEngine::MonteCarloEngine(const MonteCarloEngine& source): m_paths(source.m_paths), m_generator(source.m_generator), m_brownian_bridge(source.m_brownian_bridge),
+    m_control_variate(source.m_control_variate), m_seed(source.m_seed), m_threads(source.m_threads)
+{
+    //std::cout << "Copy constructor in MonteCarloEngine used." << std::endl;
+}
+
+//Destructor
+MonteCarloEngine::~MonteCarloEngine()
+{
+    //std::cout << "Destructor in MonteCarloEngine used." << std::endl;
+}
+
+//Assignment operator
+MonteCarloEngine& MonteCarloEngine::operator = (const MonteCarloEngine& source)
+{
+    if (this == &source)    // Checking for self-assignment
+    {
+        return *this;
+    }
+    else
+    {
+        m_paths = source.m_paths;
+        m_generator = source.m_generator;
+        m_brownian_bridge = source.m_brownian_bridge;
+        m_control_variate = source.m_control_variate;
+        m_seed = source.m_seed;
+        m_threads = source.m_threads;
+        return *this;
+    }
+}
+
+
+//PRICING
+
+double MonteCarloEngine::Geometric_Asian_Price(const Path_Option& option)
+{
+    // With t_i = iT/n, ln G is normal with mean ln S + (B - Sig^2/2)T(n+1)/(2n) and variance Sig^2 T(n+1)(2n+1)/(6n^2): Black formula on the forward of G
+    const Param_Data& p = option.m_params;
+    const double n = double(option.m_steps);
+    double mean = log(p.m_S) + (p.m_B - 0.5*p.m_Sig*p.m_Sig)*p.m_T*(n + 1.0)/(2.0*n);
+    double std_dev = p.m_Sig*sqrt(p.m_T*(n + 1.0)*(2.0*n + 1.0)/(6.0*n*n));
+    double d2 = (mean - log(p.m_K)) / std_dev, d1 = d2 + std_dev;
+    double forward_value = exp(mean + 0.5*std_dev*std_dev - p.m_R*p.m_T), strike_value = p.m_K*exp(-p.m_R*p.m_T);
+    return (option.m_optiontype == Option_Type::Call)
+        ? BS_Kernel<double>::Call_Value(forward_value, strike_value, BS_Kernel<double>::N(d1), BS_Kernel<double>::N(d2))
+        : BS_Kernel<double>::Put_Value(forward_value, strike_value, BS_Kernel<double>::N(-d1), BS_Kernel<double>::N(-d2));
+}
+
+MC_Result MonteCarloEngine::Price(const Path_Option& option) const
+{
+    const Param_Data& p = option.m_params;
+    if(!(p.m_S > 0.0 && p.m_K > 0.0 && p.m_T > 0.0 && p.m_Sig > 0.0)){throw std::invalid_argument("Error: S, K, T and Sig must be positive for Monte Carlo pricing.");}
+    if(option.m_steps == 0){throw std::invalid_argument("Error: at least one monitoring date is required.");}
+    if(m_generator != Path_Generator::Pseudo_Random && option.m_steps > SobolSequence::Max_Dimension){throw std::invalid_argument("Error: more monitoring dates than Sobol dimensions.");}
+    const bool barrier = (option.m_payoff == Path_Payoff::Barrier_Up_Out || option.m_payoff == Path_Payoff::Barrier_Up_In ||
+                          option.m_payoff == Path_Payoff::Barrier_Down_Out || option.m_payoff == Path_Payoff::Barrier_Down_In);
+    if(barrier && !(option.m_barrier > 0.0)){throw std::invalid_argument("Error: barrier must be positive.");}
+
+    const std::size_t n = option.m_steps;
+    std::vector<double> times(n);
+    for(std::size_t i = 0; i < n; i++){times[i] = p.m_T*double(i + 1)/double(n);}
+    const double sqrt_dt = sqrt(p.m_T/double(n));
+    const Brownian_Bridge bridge = m_brownian_bridge ? Build_Bridge(times) : Brownian_Bridge();
+
+    // Control variate: discounted payoff X with known expectation, from the same path
+    const bool asian = (option.m_payoff == Path_Payoff::Asian_Arithmetic);
+    const bool control = m_control_variate && option.m_payoff != Path_Payoff::Asian_Geometric;
+    double control_expectation = 0.0;
+    if(control)
+    {
+        control_expectation = asian ? Geometric_Asian_Price(option)
+            : ((option.m_optiontype == Option_Type::Call) ? BS_Kernel<double>::Call_Price(p.m_S, p.m_K, p.m_T, p.m_R, p.m_Sig, p.m_B)
+                                                          : BS_Kernel<double>::Put_Price(p.m_S, p.m_K, p.m_T, p.m_R, p.m_Sig, p.m_B));
+    }
+
+    const double sign = (option.m_optiontype == Option_Type::Call) ? 1.0 : -1.0;
+    const double log_S = log(p.m_S), drift = p.m_B - 0.5*p.m_Sig*p.m_Sig, discount = exp(-p.m_R*p.m_T);
+    const std::size_t blocks = m_paths / Block_Size;
+    const bool scrambled = (m_generator == Path_Generator::Sobol_Scrambled);
+    const std::size_t blocks_per_scramble = scrambled ? blocks / Scrambles : blocks;
+
+    // Per block: sums of the payoff Y and of the control X, and their co-moments about the block means (sums of products of deviations), accumulated with
+    // Welford's updates rather than as raw sums of squares, which would cancel when the spread of the payoffs is small against their mean
+    struct Block_Sums {double m_y, m_x, m_mean_y, m_mean_x, m_yy, m_xx, m_xy;};
+    std::vector<Block_Sums> sums(blocks);
+
+    Parallel_For(blocks, [&](std::size_t begin, std::size_t end, std::size_t)
+    {
+        std::vector<double> u(n), z(n), w(n);   // Uniforms, normals and Brownian values of one path: the only per-path storage
+        const bool sobol_paths = (m_generator != Path_Generator::Pseudo_Random);
+        SobolSequence sobol(sobol_paths ? n : 1);
+        std::mt19937_64 generator;              // Reseeded per block, on the pseudo-random path only
+        for(std::size_t b = begin; b < end; b++)
+        {
+            if(!sobol_paths)
+            {
+                std::seed_seq seeds{std::uint32_t(m_seed), std::uint32_t(m_seed >> 32), std::uint32_t(b)};
+                generator.seed(seeds);
+            }
+            if(scrambled)
+            {
+                // Scramble s covers blocks [s*blocks_per_scramble, (s+1)*blocks_per_scramble), from point 0 of its own scrambled sequence
+                const std::size_t scramble = b / blocks_per_scramble;
+                const std::uint64_t scramble_seed = m_seed + 0x9E3779B97F4A7C15ull*(scramble + 1);
+                if(sobol.getScrambling() != Sobol_Scrambling::Linear_Matrix || sobol.getSeed() != scramble_seed){sobol.Scramble(Sobol_Scrambling::Linear_Matrix, scramble_seed);}
+                sobol.Skip_To((b % blocks_per_scramble)*Block_Size);
+            }
+            else if(sobol_paths)
+            {
+                sobol.Skip_To(1 + b*Block_Size);
+            }
+
+            Block_Sums s = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+            for(std::size_t path = 0; path < Block_Size; path++)
+            {
+                if(sobol_paths)
+                {
+                    sobol.Next(u.data());
+                }
+                else
+                {
+                    for(std::size_t i = 0; i < n; i++){u[i] = (double(generator() >> 11) + 0.5) * (1.0 / 9007199254740992.0);}   // (k + 1/2) 2^-53, in (0,1)
+                }
+                Inverse_N_Batch_Dispatch(n, u.data(), z.data());
+
+                if(m_brownian_bridge)
+                {
+                    Bridge_Transform(bridge, z.data(), w.data());
+                }
+                else
+                {
+                    double sum_z = 0.0;
+                    for(std::size_t i = 0; i < n; i++){sum_z += z[i]; w[i] = sqrt_dt*sum_z;}
+                }
+
+                // Walk of the path, keeping only running statistics
+                double sum = 0.0, sum_log = 0.0, high = p.m_S, low = p.m_S, S_T = p.m_S;
+                for(std::size_t i = 0; i < n; i++)
+                {
+                    double log_S_i = log_S + drift*times[i] + p.m_Sig*w[i];
+                    S_T = exp(log_S_i);
+                    sum += S_T;
+                    sum_log += log_S_i;
+                    high = std::max(high, S_T);
+                    low = std::min(low, S_T);
+                }
+
+                double vanilla = std::max(sign*(S_T - p.m_K), 0.0);
+                double y = 0.0;
+                switch(option.m_payoff)
+                {
+                    case (Path_Payoff::Asian_Arithmetic):  y = std::max(sign*(sum/double(n) - p.m_K), 0.0); break;
+                    case (Path_Payoff::Asian_Geometric):   y = std::max(sign*(exp(sum_log/double(n)) - p.m_K), 0.0); break;
+                    case (Path_Payoff::Barrier_Up_Out):    y = (high >= option.m_barrier) ? 0.0 : vanilla; break;
+                    case (Path_Payoff::Barrier_Up_In):     y = (high >= option.m_barrier) ? vanilla : 0.0; break;
+                    case (Path_Payoff::Barrier_Down_Out):  y = (low <= option.m_barrier) ? 0.0 : vanilla; break;
+                    case (Path_Payoff::Barrier_Down_In):   y = (low <= option.m_barrier) ? vanilla : 0.0; break;
+                    case (Path_Payoff::Lookback_Fixed):    y = (sign > 0.0) ? std::max(high - p.m_K, 0.0) : std::max(p.m_K - low, 0.0); break;
+                    case (Path_Payoff::Lookback_Floating): y = (sign > 0.0) ? S_T - low : high - S_T; break;
+                }
+                y *= discount;
+                double x = 0.0;
+                if(control)
+                {
+                    x = discount*(asian ? std::max(sign*(exp(sum_log/double(n)) - p.m_K), 0.0) : vanilla);
+                }
+
+                s.m_y += y; s.m_x += x;
+                const double paths = double(path + 1), dy = y - s.m_mean_y, dx = x - s.m_mean_x;
+                s.m_mean_y += dy / paths;
+                s.m_mean_x += dx / paths;
+                s.m_yy += dy*(y - s.m_mean_y);
+                s.m_xx += dx*(x - s.m_mean_x);
+                s.m_xy += dx*(y - s.m_mean_y);
+            }
+            sums[b] = s;
+        }
+    }, m_threads, 1);
+
+    // Blocks merged in block order: sums are added, and co-moments combined with the deviation between the running and the block means (Chan et al.)
+    Block_Sums total = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    for(std::size_t b = 0; b < blocks; b++)
+    {
+        const double merged = double(b*Block_Size), size = double(Block_Size), weight = merged*size/(merged + size);
+        const double dy = sums[b].m_mean_y - total.m_mean_y, dx = sums[b].m_mean_x - total.m_mean_x;
+        total.m_yy += sums[b].m_yy + dy*dy*weight;
+        total.m_xx += sums[b].m_xx + dx*dx*weight;
+        total.m_xy += sums[b].m_xy + dx*dy*weight;
+        total.m_mean_y += dy*size/(merged + size);
+        total.m_mean_x += dx*size/(merged + size);
+        total.m_y += sums[b].m_y; total.m_x += sums[b].m_x;
+    }
+    const double count = double(m_paths);
+    double mean_y = total.m_y / count, mean_x = total.m_x / count;
+    double var_y = total.m_yy / (count - 1.0);
+    double var_x = total.m_xx / (count - 1.0);
+    double cov = total.m_xy / (count - 1.0);
+
+    MC_Result result;
+    result.m_beta = (control && var_x > 0.0) ? cov / var_x : 0.0;
+    result.m_price = mean_y - result.m_beta*(mean_x - control_expectation);
+    double var_residual = var_y - 2.0*result.m_beta*cov + result.m_beta*result.m_beta*var_x;
+    result.m_std_error = sqrt(std::max(var_residual, 0.0) / count);
+
+    if(scrambled)   // The scrambles are independent estimates of equal size, whose mean is the price: the error is that of their mean
+    {
+        double sum_squares = 0.0;
+        for(std::size_t s = 0; s < Scrambles; s++)
+        {
+            double y = 0.0, x = 0.0;
+            for(std::size_t b = s*blocks_per_scramble; b < (s + 1)*blocks_per_scramble; b++){y += sums[b].m_y; x += sums[b].m_x;}
+            const double scramble_paths = double(blocks_per_scramble*Block_Size);
+            double estimate = y / scramble_paths - result.m_beta*(x / scramble_paths - control_expectation);
+            sum_squares += (estimate - result.m_price)*(estimate - result.m_price);
+        }
+        result.m_std_error = sqrt(sum_squares / double(Scrambles*(Scrambles - 1)));
+    }
+    result.m_paths = m_paths;
+    return result;
+}
+
+
+//GETTERS
+
+std::size_t const& MonteCarloEngine::getPaths() const
+{
+    return m_paths;
+}
+
+Path_Generator const& MonteCarloEngine::getGenerator() const
+{
+    return m_generator;
+}
+
+bool const& MonteCarloEngine::getBrownianBridge() const
+{
+    return m_brownian_bridge;
+}
+
+bool const& MonteCarloEngine::getControlVariate() const
+{
+    return m_control_variate;
+}
+
+std::uint64_t const& MonteCarloEngine::getSeed() const
+{
+    return m_seed;
+}
+
+unsigned const& MonteCarloEngine::getThreads() const
+{
+    return m_threads;
+}
@@ -0,0 +1,99 @@
+//MonteCarloEngine.hpp
+//
+//Purpose: Monte Carlo pricing of path-dependent options under Black-Scholes dynamics (cost of carry B): arithmetic and geometric Asians, knock-in and knock-out
+//         barriers, and fixed and floating strike lookbacks, all monitored at equally spaced dates up to expiry. Paths are never stored: each path is built into a
+//         per-thread buffer of Brownian values and folded into running statistics (sum, log-sum, extremes, barrier hit) as it is walked, and the payoffs into
+//         running sums per block of paths. Normals come from a pseudo-random generator or from a Sobol sequence, through the inverse normal CDF; with the Brownian
+//         bridge, the first coordinates of each point set the terminal value and the coarse shape of the path, where quasi-random points are most uniform.
+//         Paths are split into fixed-size blocks, each with its own stream (a seeded generator, or its own run of Sobol points), processed in parallel and summed
+//         in block order: the price does not depend on the number of threads. The arithmetic Asian uses the closed form of the geometric Asian as a control
+//         variate; barriers and lookbacks use the European option of the same strike.
+//         With Path_Generator::Sobol_Scrambled, the paths are split into independent scrambles of the Sobol sequence (randomized quasi-Monte Carlo): the price is
+//         the mean of their estimates, and its standard error comes from their spread, which is a valid error estimate unlike that of a single Sobol sequence.
+//
+//Modification date: 10/18/2026
+
+#ifndef MonteCarloEngine_hpp
+#define MonteCarloEngine_hpp
+
+#include "OptionData.hpp"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Path-dependent payoffs, with A the average, M the maximum and m the minimum of the underlying over the monitoring dates (the extremes include S at t = 0)
+enum class Path_Payoff
+{
+    Asian_Arithmetic,   // max(A - K, 0) or max(K - A, 0), A arithmetic
+    Asian_Geometric,    // Same with A geometric, which has a closed form
+    Barrier_Up_Out,     // European payoff if S never reaches the barrier from below, 0 otherwise
+    Barrier_Up_In,      // European payoff only if S reaches the barrier from below
+    Barrier_Down_Out,
+    Barrier_Down_In,
+    Lookback_Fixed,     // max(M - K, 0) or max(K - m, 0)
+    Lookback_Floating   // S(T) - m or M - S(T)
+};
+
+// Source of the normals of the paths
+enum class Path_Generator
+{
+    Pseudo_Random, Sobol, Sobol_Scrambled     // Sobol_Scrambled: Scrambles independent linear scrambles of the Sobol sequence
+};
+
+struct Path_Option
+{
+    Param_Data m_params;        // S, K, T, R, Sig, B (m_h is not used)
+    Option_Type m_optiontype;
+    Path_Payoff m_payoff;
+    double m_barrier;           // Barrier payoffs only
+    std::size_t m_steps;        // Number of monitoring dates, equally spaced on (0, T]
+};
+
+struct MC_Result
+{
+    double m_price;
+    double m_std_error;         // Standard error of the estimate: over the paths, or over the scrambles with Sobol_Scrambled; indicative only for Sobol paths, which are not independent
+    double m_beta;              // Control-variate coefficient, 0 without control variate
+    std::size_t m_paths;
+};
+
+class MonteCarloEngine
+{
+    public:
+        static const std::size_t Block_Size = 4096;     // Paths per block: each block has its own stream of normals
+        static const std::size_t Scrambles = 8;         // Independent scrambles with Sobol_Scrambled, each of the same whole number of blocks
+
+    private:
+        std::size_t m_paths;            // Number of paths, rounded up to a whole number of blocks (per scramble with Sobol_Scrambled)
+        Path_Generator m_generator;
+        bool m_brownian_bridge;         // Brownian bridge construction of the paths, rather than cumulative increments
+        bool m_control_variate;
+        std::uint64_t m_seed;           // Seed of the pseudo-random streams
+        unsigned m_threads;             // Number of threads, 0 for the number of hardware threads
+
+    public:
+    //CONSTRUCTORS AND DESTRUCTOR
+
+        MonteCarloEngine();             // Default constructor: 65536 Sobol paths, Brownian bridge, control variate, seed 42, all hardware threads
+        MonteCarloEngine(const std::size_t& paths, const Path_Generator& generator, const bool& brownian_bridge, const bool& control_variate,
+            const std::uint64_t& seed, const unsigned& threads);       // Overloaded constructor
+        MonteCarloEngine(const MonteCarloEngine& source);               // Copy constructor
+        ~MonteCarloEngine();                                            // Destructor
+        MonteCarloEngine& operator = (const MonteCarloEngine& source);  // Assignment operator
+
+    //PRICING
+
+        MC_Result Price(const Path_Option& option) const;
+
+        static double Geometric_Asian_Price(const Path_Option& option);    // Closed form of the discretely monitored geometric Asian
+
+    //GETTERS
+        std::size_t const& getPaths() const;
+        Path_Generator const& getGenerator() const;
+        bool const& getBrownianBridge() const;
+        bool const& getControlVariate() const;
+        std::uint64_t const& getSeed() const;
+        unsigned const& getThreads() const;
+};
+
+#endif //MonteCarloEngine_hpp
@@ -0,0 +1,87 @@
+//Parallel.hpp
+//
+//Purpose: Parallel_For() function splitting a range of indices [0, size) into contiguous chunks, each processed on its own std::thread. The function provided is
+//         called as function(begin, end, chunk) for each chunk, so that the caller keeps its loops tight and can hold per-chunk buffers indexed by chunk. Exceptions thrown in a chunk are
+//         rethrown in the calling thread once every chunk is done. Chunks whose thread cannot be created are processed on the calling thread.
+//
+//Modification date: 10/18/2026
+
+#ifndef Parallel_hpp
+#define Parallel_hpp
+
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <exception>
+
+// Number of threads to use: the number requested, or the number of hardware threads if 0 is requested
+inline unsigned Thread_Count(const unsigned& requested = 0)
+{
+    if(requested > 0){return requested;}
+    unsigned hardware = std::thread::hardware_concurrency();
+    return (hardware > 0) ? hardware : 1;
+}
+
+// Number of chunks a range is split into, given a minimum chunk size so that small ranges do not pay for thread creation
+inline std::size_t Chunk_Count(const std::size_t& size, const unsigned& threads = 0, const std::size_t& min_chunk = 1024)
+{
+    if(size == 0){return 0;}
+    std::size_t chunks = (size + min_chunk - 1) / min_chunk;
+    std::size_t max_chunks = Thread_Count(threads);
+    return (chunks < max_chunks) ? chunks : max_chunks;
+}
+
+// Calls function(begin, end, chunk) on contiguous chunks of [0, size). Chunk c covers [c*size/chunks, (c+1)*size/chunks), with chunks = Chunk_Count(size, threads, min_chunk).
+template<typename Function>
+inline void Parallel_For(const std::size_t& size, const Function& function, const unsigned& threads = 0, const std::size_t& min_chunk = 1024)
+{
+    const std::size_t chunks = Chunk_Count(size, threads, min_chunk);
+    if(chunks == 0){return;}
+    if(chunks == 1)     // No thread created for a single chunk
+    {
+        function(std::size_t(0), size, std::size_t(0));
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(chunks);
+    std::vector<std::thread> workers;
+    workers.reserve(chunks - 1);
+
+    // The calling thread processes the first chunk itself, and the chunks from the first thread that could not be created (std::system_error), if any,
+    // so that the threads already started are still joined
+    std::size_t started = 1;
+    for(; started < chunks; started++)
+    {
+        const std::size_t c = started;
+        try
+        {
+            workers.emplace_back([&, c]()
+            {
+                try{function(c * size / chunks, (c + 1) * size / chunks, c);}
+                catch(...){errors[c] = std::current_exception();}
+            });
+        }
+        catch(...){break;}
+    }
+
+    try{function(std::size_t(0), size / chunks, std::size_t(0));}
+    catch(...){errors[0] = std::current_exception();}
+
+    for(std::size_t c = started; c < chunks; c++)
+    {
+        try{function(c * size / chunks, (c + 1) * size / chunks, c);}
+        catch(...){errors[c] = std::current_exception();}
+    }
+
+    for(std::size_t i = 0; i < workers.size(); i++)
+    {
+        workers[i].join();
+    }
+
+    for(std::size_t c = 0; c < chunks; c++)
+    {
+        if(errors[c]){std::rethrow_exception(errors[c]);}
+    }
+}
+
+#endif //Parallel_hpp
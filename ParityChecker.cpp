@@ -0,0 +1,137 @@
+//ParityChecker.cpp
+//
+//Purpose: Batch put-call parity checker over a book of European options. Unlike EuropeanOption::Parity_Difference(), it does not modify the options: for each
+//         option, the call and the put are priced in one fused evaluation, and the parity relation C - P = S*exp((B-R)T) - K*exp(-RT) is checked. This covers
+//         spot options (B = R: C - P = S - K*exp(-RT)) as well as futures options (B = 0: C - P = (F - K)*exp(-RT)). The book is processed in parallel, and only
+//         the violations are reported.
+//
+//Modification date: 10/18/2026
+
+
+#include "ParityChecker.hpp"
+#include "BSExactPricingEngine.hpp"
+#include "Parallel.hpp"
+#include <cmath>        // For exp(), fabs(), std::isfinite()
+#include <limits>
+
+
+//Default constructor
+ParityChecker::ParityChecker(): m_tolerance(1e-8), m_threads(0)
+{
+    //std::cout << "Default constructor in ParityChecker used." << std::endl;
+}
+
+//Overloaded constructor
+ParityChecker::ParityChecker(const double& tolerance, const unsigned& threads): m_tolerance(tolerance), m_threads(threads)
+{
+    //std::cout << "Overloaded constructor in ParityChecker used." << std::endl;
+}
+
+//Copy constructor
+ParityChecker::ParityChecker(const ParityChecker& source): m_tolerance(source.m_tolerance), m_threads(source.m_threads)
+{
+    //std::cout << "Copy constructor in ParityChecker used." << std::endl;
+}
+
+//Destructor
+ParityChecker::~ParityChecker()
+{
+    //std::cout << "Destructor in ParityChecker used." << std::endl;
+}
+
+//Assignment operator
+ParityChecker& ParityChecker::operator = (const ParityChecker& source)
+{
+    if (this == &source)    // Checking for self-assignment
+    {
+        return *this;
+    }
+    else
+    {
+        m_tolerance = source.m_tolerance;
+        m_threads = source.m_threads;
+        return *this;
+    }
+}
+
+
+//PARITY CHECKS
+
+double ParityChecker::Parity_Difference(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B)
+{
+    if(!(S > 0.0 && K > 0.0 && T > 0.0 && Sig > 0.0))   // Also catches NaN inputs: the option cannot be priced, which is reported as a violation
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    double call, put;
+    BSExactPricingEngine::Call_Put_Price_BS(S, K, T, R, Sig, B, call, put);     // Call and put priced in one evaluation
+
+    // C - P = S*exp((B-R)T) - K*exp(-RT). With B = R (spot), this is S - K*exp(-RT); with B = 0 (futures), this is (F - K)*exp(-RT).
+    return std::fabs((call - put) - (S*exp((B-R)*T) - K*exp(-R*T)));
+}
+
+double ParityChecker::Parity_Difference(const EuropeanOption& option) const
+{
+    return Parity_Difference(option.getS(), option.getK(), option.getT(), option.getR(), option.getSig(), option.getB());
+}
+
+std::vector<Parity_Violation> ParityChecker::Check(const std::vector<EuropeanOption>& book) const
+{
+    std::vector<Parity_Violation> violations;
+    Check(book, violations);
+    return violations;
+}
+
+void ParityChecker::Check(const std::vector<EuropeanOption>& book, std::vector<Parity_Violation>& violations) const
+{
+    violations.clear();
+
+    // Each chunk of the book collects its own violations, which are then appended in chunk order, so that the result follows the order of the book
+    std::vector<std::vector<Parity_Violation>> chunk_violations(Chunk_Count(book.size(), m_threads));
+
+    Parallel_For(book.size(), [&](std::size_t begin, std::size_t end, std::size_t chunk)
+    {
+        std::vector<Parity_Violation>& local = chunk_violations[chunk];
+        for(std::size_t i = begin; i < end; i++)
+        {
+            double difference = Parity_Difference(book[i]);
+            if(!(difference <= m_tolerance))    // NaN differences are violations as well
+            {
+                Parity_Violation violation;
+                violation.m_index = static_cast<std::uint32_t>(i);
+                violation.m_id = book[i].getID();
+                violation.m_difference = difference;
+                local.push_back(violation);
+            }
+        }
+    }, m_threads);
+
+    for(std::size_t c = 0; c < chunk_violations.size(); c++)
+    {
+        violations.insert(violations.end(), chunk_violations[c].begin(), chunk_violations[c].end());
+    }
+}
+
+
+//GETTERS AND SETTERS
+
+double const& ParityChecker::getTolerance() const
+{
+    return m_tolerance;
+}
+
+void ParityChecker::setTolerance(const double& newTolerance)
+{
+    m_tolerance = newTolerance;
+}
+
+unsigned const& ParityChecker::getThreads() const
+{
+    return m_threads;
+}
+
+void ParityChecker::setThreads(const unsigned& newThreads)
+{
+    m_threads = newThreads;
+}
@@ -0,0 +1,56 @@
+//ParityChecker.hpp
+//
+//Purpose: Batch put-call parity checker over a book of European options. Unlike EuropeanOption::Parity_Difference(), it does not modify the options: for each
+//         option, the call and the put are priced in one fused evaluation, and the parity relation C - P = S*exp((B-R)T) - K*exp(-RT) is checked. This covers
+//         spot options (B = R: C - P = S - K*exp(-RT)) as well as futures options (B = 0: C - P = (F - K)*exp(-RT)). The book is processed in parallel, and only
+//         the violations are reported.
+//
+//Modification date: 10/18/2026
+
+#ifndef ParityChecker_hpp
+#define ParityChecker_hpp
+
+#include "EuropeanOption.hpp"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Compact record of a parity violation: position in the book, ID of the option, and parity difference (NaN if the prices could not be computed)
+struct Parity_Violation
+{
+    std::uint32_t m_index;      // Position of the option in the book
+    std::int32_t m_id;          // ID of the option
+    double m_difference;        // |(C - P) - (S*exp((B-R)T) - K*exp(-RT))|
+};
+
+class ParityChecker
+{
+    private:
+        double m_tolerance;     // Tolerance on the parity difference, 1e-8 by default as for Parity_Difference()
+        unsigned m_threads;     // Number of threads, 0 for the number of hardware threads
+
+    public:
+    //CONSTRUCTORS AND DESTRUCTOR
+
+        ParityChecker();                                                // Default constructor: tolerance of 1e-8, all hardware threads
+        ParityChecker(const double& tolerance, const unsigned& threads);    // Overloaded constructor
+        ParityChecker(const ParityChecker& source);                     // Copy constructor
+        ~ParityChecker();                                               // Destructor
+        ParityChecker& operator = (const ParityChecker& source);        // Assignment operator
+
+    //PARITY CHECKS
+
+        static double Parity_Difference(const double& S, const double& K, const double& T, const double& R, const double& Sig, const double& B);    // Parity difference of one option, without any object
+        double Parity_Difference(const EuropeanOption& option) const;  // Parity difference of one option, without modifying it
+
+        std::vector<Parity_Violation> Check(const std::vector<EuropeanOption>& book) const;    // Violations over the whole book, in the order of the book
+        void Check(const std::vector<EuropeanOption>& book, std::vector<Parity_Violation>& violations) const;  // Same, reusing the buffer provided
+
+    //GETTERS AND SETTERS
+        double const& getTolerance() const;
+        void setTolerance(const double& newTolerance);
+        unsigned const& getThreads() const;
+        void setThreads(const unsigned& newThreads);
+};
+
+#endif //ParityChecker_hpp
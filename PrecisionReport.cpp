@@ -0,0 +1,92 @@
+//PrecisionReport.cpp
+//
+//Purpose: Command-line report of the accuracy of the fast pricing kernels: the float batch kernels against double, then every fast path against the
+//         high-precision reference (see PrecisionValidation.hpp and ReferenceKernels.hpp), one line per region, option type and path. It is meant to be run after
+//         changing a kernel, a compiler flag or an instruction-set variant, and its output compared with that of the previous build. Each path has a ceiling on
+//         its largest relative error, per kernel and precision, about ten times the error of the current kernels: lines above it are marked, and the report
+//         then returns 1 (0 when every path is within its ceiling), so that it can run as a test.
+//
+//         Usage: precision_report [samples per region] [seed]
+//         Defaults: 100000 samples, seed 42
+//
+//Modification date: 10/18/2026
+
+
+#include "PrecisionValidation.hpp"
+#include "KernelDispatch.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+
+// Largest relative error allowed per fast path, the path being matched by the start of its name (instruction-set variants share their ceiling)
+struct Error_Threshold
+{
+    const char* m_path;
+    double m_max_rel_error;
+};
+
+static const Error_Threshold Reference_Thresholds[] =
+{
+    {"BS_Kernel<double> scalar", 1e-11},
+    {"Batch double", 1e-11},
+    {"Batch float", 1e-2},              // Prices just above the price floor, whose float rounding is large against them
+    {"Delta", 1e-11},
+    {"Gamma", 1e-11},
+    {"Vega", 1e-11},
+    {"Theta", 1e-9},
+    {"Divided differences delta", 1e-2},    // Truncation error of the divided difference at low vol, not rounding
+    {"American perpetual", 1e-11},
+    {"Parity C - P", 1e-8},             // Relative to C - P, which cancels near the forward
+    {"BS_Kernel<double>::Inverse_N", 1e-10},
+    {"Inverse_N batch double", 1e-10},
+    {"Inverse_N batch float", 1e-6}
+};
+
+static const double Float_Threshold = 1e-2;     // Float against double batch kernels
+
+// Ceiling of the path, negative for a path without one (which fails, so that a new path is given its own)
+static double Reference_Threshold(const std::string& path)
+{
+    for(const Error_Threshold& threshold: Reference_Thresholds)
+    {
+        if(path.compare(0, std::string(threshold.m_path).size(), threshold.m_path) == 0){return threshold.m_max_rel_error;}
+    }
+    return -1.0;
+}
+
+
+int main(int argc, char* argv[])
+{
+    std::size_t samples = (argc > 1) ? static_cast<std::size_t>(std::atol(argv[1])) : 100000;
+    unsigned seed = (argc > 2) ? static_cast<unsigned>(std::atol(argv[2])) : 42;
+    std::cout << "Kernel variant detected: " << Kernel_ISA_Name(Kernel_ISA_Detected()) << "; samples per region: " << samples << "; seed: " << seed << "\n";
+
+    bool ok = true;
+
+    std::cout << "\nFloat against double batch kernels (max rel error up to " << Float_Threshold << ")\n";
+    std::vector<Precision_Report> float_reports = PrecisionValidation::Validate_All(samples, seed);
+    for(std::size_t i = 0; i < float_reports.size(); i++)
+    {
+        const bool within = (float_reports[i].m_max_rel_error <= Float_Threshold);
+        std::cout << float_reports[i].ToString() << (within ? "" : "  <-- FAILED") << "\n";
+        ok = ok && within;
+    }
+
+    std::cout << "\nFast paths against the long double reference\n";
+    std::vector<Reference_Report> reference_reports = PrecisionValidation::Validate_Reference_All(samples, seed);
+    for(std::size_t i = 0; i < reference_reports.size(); i++)
+    {
+        const double threshold = Reference_Threshold(reference_reports[i].m_path);
+        const bool within = (reference_reports[i].m_max_rel_error <= threshold);      // False for NaN errors
+        std::cout << reference_reports[i].ToString();
+        if(!within && threshold < 0.0){std::cout << "  <-- FAILED (no threshold for this path)";}
+        else if(!within){std::cout << "  <-- FAILED (threshold " << threshold << ")";}
+        std::cout << "\n";
+        ok = ok && within;
+    }
+
+    std::cout << "\n" << (ok ? "PASSED" : "FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,345 @@
+//PrecisionValidation.cpp
+//
+//Purpose: Validation harness for the fast pricing kernels. Over a region of parameters, options are sampled at random and priced by the kernels under test, and
+//         their errors are summarized: float against double batch kernels, which tells where float screening is safe, and every fast path (scalar and batch
+//         kernels under each instruction-set variant, float, Greeks, divided differences, perpetual American options, inverse normal) against the
+//         high-precision reference of ReferenceKernels.hpp, in ULPs of the result type and in relative error.
+//
+//Modification date: 10/18/2026
+
+
+#include "PrecisionValidation.hpp"
+#include "PricingKernels.hpp"
+#include "ReferenceKernels.hpp"
+#include "KernelDispatch.hpp"
+#include <algorithm>    // For std::sort
+#include <cmath>
+#include <limits>
+#include <random>
+#include <sstream>
+
+
+std::string Precision_Report::ToString() const
+{
+    std::stringstream ss;
+    ss << m_name << " " << ((m_optiontype == Option_Type::Call) ? "CALL" : "PUT") << ": samples: " << m_samples << "; max abs error: " << m_max_abs_error
+       << "; max rel error: " << m_max_rel_error << "; p99 rel error: " << m_p99_rel_error << "; below floor: " << m_below_floor;
+    return ss.str();
+}
+
+std::string Reference_Report::ToString() const
+{
+    std::stringstream ss;
+    ss << m_name << " " << ((m_optiontype == Option_Type::Call) ? "CALL" : "PUT") << ", " << m_path << ": samples: " << m_samples << "; max ULP: " << m_max_ulp
+       << "; max rel error: " << m_max_rel_error << "; max abs error: " << m_max_abs_error << "; excluded: " << m_excluded;
+    return ss.str();
+}
+
+// Report of one path, filled by Reference_Add() sample by sample
+static Reference_Report Reference_Start(const std::string& path, const std::string& name, const Option_Type& optiontype, const std::size_t& samples)
+{
+    Reference_Report report = {path, name, optiontype, samples, 0.0, 0.0, 0.0, 0};
+    return report;
+}
+
+// Adds the error of one fast value (of type Result, whose ULP is used) against its reference. NaN errors propagate into the report.
+template<typename Result>
+static void Reference_Add(Reference_Report& report, const Result& fast, const long double& reference, const double& value_floor)
+{
+    if(!std::isfinite(reference))
+    {
+        report.m_excluded++;
+        return;
+    }
+    const double error = static_cast<double>(std::fabs(static_cast<long double>(fast) - reference));
+    if(!(error <= report.m_max_abs_error)){report.m_max_abs_error = error;}
+    if(std::fabs(reference) < value_floor)
+    {
+        report.m_excluded++;
+        return;
+    }
+    const Result magnitude = static_cast<Result>(std::fabs(reference));
+    const double ulp = static_cast<double>(std::nextafter(magnitude, std::numeric_limits<Result>::infinity()) - magnitude);
+    const double ulps = error / ulp, relative = error / static_cast<double>(std::fabs(reference));
+    if(!(ulps <= report.m_max_ulp)){report.m_max_ulp = ulps;}
+    if(!(relative <= report.m_max_rel_error)){report.m_max_rel_error = relative;}
+}
+
+static const Kernel_ISA All_ISA[] = {Kernel_ISA::Generic, Kernel_ISA::SSE4, Kernel_ISA::AVX2, Kernel_ISA::AVX512};
+
+
+std::vector<Precision_Region> PrecisionValidation::Default_Regions()
+{
+    // Name, moneyness S/K, T, R, Sig, future
+    std::vector<Precision_Region> regions = {
+        {"ATM short",        0.95, 1.05, 0.02, 0.25, 0.00, 0.10, 0.10, 0.60, false},
+        {"ATM long",         0.95, 1.05, 1.00, 30.0, 0.00, 0.10, 0.10, 0.60, false},
+        {"ITM",              1.20, 2.00, 0.10, 2.00, 0.00, 0.10, 0.10, 0.60, false},
+        {"OTM",              0.50, 0.80, 0.10, 2.00, 0.00, 0.10, 0.10, 0.60, false},
+        {"Deep OTM short",   0.30, 0.60, 0.02, 0.25, 0.00, 0.10, 0.05, 0.30, false},
+        {"Low vol",          0.80, 1.20, 0.10, 2.00, 0.00, 0.10, 0.01, 0.05, false},
+        {"High vol",         0.50, 2.00, 0.10, 2.00, 0.00, 0.10, 0.80, 2.00, false},
+        {"Futures ATM",      0.90, 1.10, 0.10, 2.00, 0.00, 0.10, 0.10, 0.60, true}
+    };
+    return regions;
+}
+
+Precision_Report PrecisionValidation::Validate(const Precision_Region& region, const Option_Type& optiontype, const std::size_t& samples, const unsigned& seed,
+    const double& price_floor)
+{
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> moneyness(region.m_moneyness_low, region.m_moneyness_high), T(region.m_T_low, region.m_T_high),
+        R(region.m_R_low, region.m_R_high), Sig(region.m_Sig_low, region.m_Sig_high);
+
+    // Sampling in double, and rounding the same parameters to float, so that the float error only comes from the kernels
+    Param_Columns<double> columns_double;
+    Param_Columns<float> columns_float;
+    columns_double.resize(samples);
+    columns_float.resize(samples);
+    for(std::size_t i = 0; i < samples; i++)
+    {
+        columns_float.S[i] = static_cast<float>(100.0 * moneyness(generator));
+        columns_float.K[i] = 100.0f;
+        columns_float.T[i] = static_cast<float>(T(generator));
+        columns_float.R[i] = static_cast<float>(R(generator));
+        columns_float.Sig[i] = static_cast<float>(Sig(generator));
+        columns_float.B[i] = region.m_future ? 0.0f : columns_float.R[i];
+
+        columns_double.S[i] = columns_float.S[i];
+        columns_double.K[i] = columns_float.K[i];
+        columns_double.T[i] = columns_float.T[i];
+        columns_double.R[i] = columns_float.R[i];
+        columns_double.Sig[i] = columns_float.Sig[i];
+        columns_double.B[i] = columns_float.B[i];
+    }
+
+    std::vector<double> prices_double;
+    std::vector<float> prices_float;
+    BS_Kernel<double>::Price_Batch(optiontype, columns_double, prices_double);
+    BS_Kernel<float>::Price_Batch(optiontype, columns_float, prices_float);
+
+    Precision_Report report;
+    report.m_name = region.m_name;
+    report.m_optiontype = optiontype;
+    report.m_samples = samples;
+    report.m_max_abs_error = 0.0;
+    report.m_below_floor = 0;
+
+    std::vector<double> relative_errors;
+    relative_errors.reserve(samples);
+    for(std::size_t i = 0; i < samples; i++)
+    {
+        double error = std::fabs(static_cast<double>(prices_float[i]) - prices_double[i]);
+        if(!(error <= report.m_max_abs_error)){report.m_max_abs_error = error;}     // NaN errors propagate into the report
+
+        if(std::fabs(prices_double[i]) < price_floor)
+        {
+            report.m_below_floor++;
+            continue;
+        }
+        relative_errors.push_back(error / std::fabs(prices_double[i]));
+    }
+
+    std::sort(relative_errors.begin(), relative_errors.end());
+    report.m_max_rel_error = relative_errors.empty() ? 0.0 : relative_errors.back();
+    report.m_p99_rel_error = relative_errors.empty() ? 0.0 : relative_errors[static_cast<std::size_t>(0.99 * static_cast<double>(relative_errors.size() - 1))];
+    return report;
+}
+
+std::vector<Precision_Report> PrecisionValidation::Validate_All(const std::size_t& samples, const unsigned& seed)
+{
+    std::vector<Precision_Region> regions = Default_Regions();
+    std::vector<Precision_Report> reports;
+    for(std::size_t r = 0; r < regions.size(); r++)
+    {
+        reports.push_back(Validate(regions[r], Option_Type::Call, samples, seed + static_cast<unsigned>(r)));
+        reports.push_back(Validate(regions[r], Option_Type::Put, samples, seed + static_cast<unsigned>(r)));
+    }
+    return reports;
+}
+
+std::vector<Reference_Report> PrecisionValidation::Validate_Reference(const Precision_Region& region, const Option_Type& optiontype, const std::size_t& samples,
+    const unsigned& seed, const double& value_floor)
+{
+    typedef Reference_Kernel<long double> Reference;
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> moneyness(region.m_moneyness_low, region.m_moneyness_high), T(region.m_T_low, region.m_T_high),
+        R(region.m_R_low, region.m_R_high), Sig(region.m_Sig_low, region.m_Sig_high);
+    const bool call = (optiontype == Option_Type::Call);
+
+    // Parameters rounded to float, so that the float and double paths see the same exact inputs, and the reference as well
+    Param_Columns<double> columns;
+    Param_Columns<float> columns_float;
+    columns.resize(samples);
+    columns_float.resize(samples);
+    for(std::size_t i = 0; i < samples; i++)
+    {
+        columns_float.S[i] = static_cast<float>(100.0 * moneyness(generator));
+        columns_float.K[i] = 100.0f;
+        columns_float.T[i] = static_cast<float>(T(generator));
+        columns_float.R[i] = static_cast<float>(R(generator));
+        columns_float.Sig[i] = static_cast<float>(Sig(generator));
+        columns_float.B[i] = region.m_future ? 0.0f : columns_float.R[i];
+
+        columns.S[i] = columns_float.S[i]; columns.K[i] = columns_float.K[i]; columns.T[i] = columns_float.T[i];
+        columns.R[i] = columns_float.R[i]; columns.Sig[i] = columns_float.Sig[i]; columns.B[i] = columns_float.B[i];
+    }
+
+    // Reference prices, computed once for all the price paths
+    std::vector<long double> reference(samples);
+    for(std::size_t i = 0; i < samples; i++)
+    {
+        reference[i] = call ? Reference::Call_Price(columns.S[i], columns.K[i], columns.T[i], columns.R[i], columns.Sig[i], columns.B[i])
+                            : Reference::Put_Price(columns.S[i], columns.K[i], columns.T[i], columns.R[i], columns.Sig[i], columns.B[i]);
+    }
+
+    std::vector<Reference_Report> reports;
+    Reference_Report report = Reference_Start("BS_Kernel<double> scalar", region.m_name, optiontype, samples);
+    for(std::size_t i = 0; i < samples; i++)
+    {
+        const double price = call ? BS_Kernel<double>::Call_Price(columns.S[i], columns.K[i], columns.T[i], columns.R[i], columns.Sig[i], columns.B[i])
+                                  : BS_Kernel<double>::Put_Price(columns.S[i], columns.K[i], columns.T[i], columns.R[i], columns.Sig[i], columns.B[i]);
+        Reference_Add(report, price, reference[i], value_floor);
+    }
+    reports.push_back(report);
+
+    // Batch kernels under each available variant, in double and in float
+    const Kernel_ISA active = Kernel_ISA_Active();
+    std::vector<double> prices(samples);
+    std::vector<float> prices_float(samples);
+    for(const Kernel_ISA& isa: All_ISA)
+    {
+        if(!Kernel_ISA_Available(isa)){continue;}
+        Kernel_ISA_Select(isa);
+        Price_BS_Batch_Dispatch(optiontype, samples, columns.S.data(), columns.K.data(), columns.T.data(), columns.R.data(), columns.Sig.data(), columns.B.data(),
+            prices.data());
+        Price_BS_Batch_Dispatch(optiontype, samples, columns_float.S.data(), columns_float.K.data(), columns_float.T.data(), columns_float.R.data(),
+            columns_float.Sig.data(), columns_float.B.data(), prices_float.data());
+        Reference_Report report_double = Reference_Start("Batch double, " + Kernel_ISA_Name(isa), region.m_name, optiontype, samples);
+        Reference_Report report_float = Reference_Start("Batch float, " + Kernel_ISA_Name(isa), region.m_name, optiontype, samples);
+        for(std::size_t i = 0; i < samples; i++)
+        {
+            Reference_Add(report_double, prices[i], reference[i], value_floor);
+            Reference_Add(report_float, prices_float[i], reference[i], value_floor);
+        }
+        reports.push_back(report_double);
+        reports.push_back(report_float);
+    }
+    Kernel_ISA_Select(active);
+
+    // Greeks of the double kernel, the divided-difference delta (h = 1e-4*S, i.e. about the step of least total error), and perpetual American prices
+    // (calls where B < R, puts where R > 0, the others being excluded). The closed form of the perpetual kernel is the value of the option held, so it is only
+    // compared where the option is held: spots beyond the exercise boundary, where the option is worth its intrinsic value, are excluded too.
+    Reference_Report delta = Reference_Start("Delta", region.m_name, optiontype, samples), gamma = Reference_Start("Gamma", region.m_name, optiontype, samples),
+        vega = Reference_Start("Vega", region.m_name, optiontype, samples), theta = Reference_Start("Theta", region.m_name, optiontype, samples),
+        divided = Reference_Start("Divided differences delta", region.m_name, optiontype, samples),
+        perpetual = Reference_Start("American perpetual", region.m_name, optiontype, samples);
+    for(std::size_t i = 0; i < samples; i++)
+    {
+        const double S = columns.S[i], K = columns.K[i], t = columns.T[i], r = columns.R[i], sig = columns.Sig[i], b = columns.B[i];
+        const long double reference_delta = call ? Reference::Call_Delta(S, K, t, r, sig, b) : Reference::Put_Delta(S, K, t, r, sig, b);
+        Reference_Add(delta, call ? BS_Kernel<double>::Call_Delta(S, K, t, r, sig, b) : BS_Kernel<double>::Put_Delta(S, K, t, r, sig, b), reference_delta, value_floor);
+        Reference_Add(gamma, BS_Kernel<double>::Gamma(S, K, t, r, sig, b), Reference::Gamma(S, K, t, r, sig, b), value_floor);
+        Reference_Add(vega, BS_Kernel<double>::Vega(S, K, t, r, sig, b), Reference::Vega(S, K, t, r, sig, b), value_floor);
+        Reference_Add(theta, call ? BS_Kernel<double>::Call_Theta(S, K, t, r, sig, b) : BS_Kernel<double>::Put_Theta(S, K, t, r, sig, b),
+            call ? Reference::Call_Theta(S, K, t, r, sig, b) : Reference::Put_Theta(S, K, t, r, sig, b), value_floor);
+        Reference_Add(divided, call ? DividedDiff_Kernel<double>::Delta_Call(S, K, t, r, sig, b, 1e-4*S) : DividedDiff_Kernel<double>::Delta_Put(S, K, t, r, sig, b, 1e-4*S),
+            reference_delta, value_floor);
+        const long double boundary = call ? Reference::Call_Perpetual_Boundary(K, r, sig, b) : Reference::Put_Perpetual_Boundary(K, r, sig, b);
+        const bool held = call ? (S < boundary) : (S > boundary);
+        Reference_Add(perpetual, call ? AmericanPerp_Kernel<double>::Call_Price(S, K, r, sig, b) : AmericanPerp_Kernel<double>::Put_Price(S, K, r, sig, b),
+            held ? (call ? Reference::Call_Perpetual(S, K, r, sig, b) : Reference::Put_Perpetual(S, K, r, sig, b)) : std::numeric_limits<long double>::quiet_NaN(),
+            value_floor);
+    }
+    reports.push_back(delta);
+    reports.push_back(gamma);
+    reports.push_back(vega);
+    reports.push_back(theta);
+    reports.push_back(divided);
+    reports.push_back(perpetual);
+
+    // Put-call parity C - P of the fused call and put, against its exact value: the error that any parity tolerance has to absorb
+    if(call)
+    {
+        Reference_Report parity = Reference_Start("Parity C - P", region.m_name, optiontype, samples);
+        for(std::size_t i = 0; i < samples; i++)
+        {
+            double call_price, put_price;
+            BS_Kernel<double>::Call_Put_Price(columns.S[i], columns.K[i], columns.T[i], columns.R[i], columns.Sig[i], columns.B[i], call_price, put_price);
+            Reference_Add(parity, call_price - put_price, Reference::Parity(columns.S[i], columns.K[i], columns.T[i], columns.R[i], columns.B[i]), value_floor);
+        }
+        reports.push_back(parity);
+    }
+    return reports;
+}
+
+std::vector<Reference_Report> PrecisionValidation::Validate_Inverse_N(const std::size_t& samples, const unsigned& seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> central(0.02425, 0.97575), exponent(2.0, 300.0), side(0.0, 1.0);
+    std::vector<Reference_Report> reports;
+    const Kernel_ISA active = Kernel_ISA_Active();
+
+    for(int tail = 0; tail < 2; tail++)
+    {
+        // Central region of the approximation, or p = 10^-e in either tail (as 1-p, rounded to double, in the upper tail when it is below 1)
+        const std::string name = tail ? "Inverse_N tails" : "Inverse_N central";
+        std::vector<double> p(samples), x(samples);
+        std::vector<float> p_float(samples), x_float(samples);
+        for(std::size_t i = 0; i < samples; i++)
+        {
+            const double value = tail ? std::pow(10.0, -exponent(generator)) : central(generator);
+            p[i] = (tail && side(generator) < 0.5 && 1.0 - value < 1.0) ? 1.0 - value : value;
+            p_float[i] = static_cast<float>(p[i]);
+        }
+
+        // References at the double and at the float inputs, started from the double kernel
+        std::vector<long double> reference(samples), reference_float(samples);
+        for(std::size_t i = 0; i < samples; i++)
+        {
+            reference[i] = Reference_Kernel<long double>::Inverse_N(p[i], BS_Kernel<double>::Inverse_N(std::fmin(p[i], 1.0 - p[i])));
+            const double q = static_cast<double>(p_float[i]);
+            reference_float[i] = (q > 0.0 && q < 1.0) ? Reference_Kernel<long double>::Inverse_N(q, BS_Kernel<double>::Inverse_N(std::fmin(q, 1.0 - q)))
+                                                      : std::numeric_limits<long double>::quiet_NaN();     // p underflowed in float
+        }
+
+        Reference_Report scalar = Reference_Start("BS_Kernel<double>::Inverse_N scalar", name, Option_Type::Call, samples);
+        for(std::size_t i = 0; i < samples; i++){Reference_Add(scalar, BS_Kernel<double>::Inverse_N(p[i]), reference[i], 0.0);}
+        reports.push_back(scalar);
+        for(const Kernel_ISA& isa: All_ISA)
+        {
+            if(!Kernel_ISA_Available(isa)){continue;}
+            Kernel_ISA_Select(isa);
+            Inverse_N_Batch_Dispatch(samples, p.data(), x.data());
+            Inverse_N_Batch_Dispatch(samples, p_float.data(), x_float.data());
+            Reference_Report report_double = Reference_Start("Inverse_N batch double, " + Kernel_ISA_Name(isa), name, Option_Type::Call, samples);
+            Reference_Report report_float = Reference_Start("Inverse_N batch float, " + Kernel_ISA_Name(isa), name, Option_Type::Call, samples);
+            for(std::size_t i = 0; i < samples; i++)
+            {
+                Reference_Add(report_double, x[i], reference[i], 0.0);
+                Reference_Add(report_float, x_float[i], reference_float[i], 0.0);
+            }
+            reports.push_back(report_double);
+            reports.push_back(report_float);
+        }
+        Kernel_ISA_Select(active);
+    }
+    return reports;
+}
+
+std::vector<Reference_Report> PrecisionValidation::Validate_Reference_All(const std::size_t& samples, const unsigned& seed)
+{
+    std::vector<Precision_Region> regions = Default_Regions();
+    std::vector<Reference_Report> reports;
+    for(std::size_t r = 0; r < regions.size(); r++)
+    {
+        for(const Option_Type& optiontype: {Option_Type::Call, Option_Type::Put})
+        {
+            std::vector<Reference_Report> region_reports = Validate_Reference(regions[r], optiontype, samples, seed + static_cast<unsigned>(r));
+            reports.insert(reports.end(), region_reports.begin(), region_reports.end());
+        }
+    }
+    std::vector<Reference_Report> inverse_reports = Validate_Inverse_N(samples, seed);
+    reports.insert(reports.end(), inverse_reports.begin(), inverse_reports.end());
+    return reports;
+}
@@ -0,0 +1,82 @@
+//PrecisionValidation.hpp
+//
+//Purpose: Validation harness for the fast pricing kernels. Over a region of parameters, options are sampled at random and priced by the kernels under test, and
+//         their errors are summarized: float against double batch kernels, which tells where float screening is safe, and every fast path (scalar and batch
+//         kernels under each instruction-set variant, float, Greeks, divided differences, perpetual American options, inverse normal) against the
+//         high-precision reference of ReferenceKernels.hpp, in ULPs of the result type and in relative error.
+//
+//Modification date: 10/18/2026
+
+#ifndef PrecisionValidation_hpp
+#define PrecisionValidation_hpp
+
+#include "OptionData.hpp"
+#include <string>
+#include <vector>
+#include <cstddef>
+
+// Region of parameters, sampled uniformly between the lower and upper bounds. Moneyness is S/K, with K fixed at 100.
+struct Precision_Region
+{
+    std::string m_name;
+    double m_moneyness_low, m_moneyness_high;
+    double m_T_low, m_T_high;
+    double m_R_low, m_R_high;
+    double m_Sig_low, m_Sig_high;
+    bool m_future;          // B = 0 if true, B = R otherwise
+};
+
+// Errors of float against double over a region
+struct Precision_Report
+{
+    std::string m_name;
+    Option_Type m_optiontype;
+    std::size_t m_samples;
+    double m_max_abs_error;         // Largest |float - double|
+    double m_max_rel_error;         // Largest |float - double| / |double|, over prices above the price floor
+    double m_p99_rel_error;         // 99th percentile of the relative error, over prices above the price floor
+    std::size_t m_below_floor;      // Number of prices below the price floor, excluded from relative errors
+
+    std::string ToString() const;   // One line summary
+};
+
+// Errors of one fast path against the high-precision reference over a region
+struct Reference_Report
+{
+    std::string m_path;             // Fast path, e.g. "Batch double, AVX2"
+    std::string m_name;             // Region
+    Option_Type m_optiontype;
+    std::size_t m_samples;
+    double m_max_ulp;               // Largest |fast - reference| in ULPs of the result type at the reference value
+    double m_max_rel_error;         // Largest |fast - reference| / |reference|
+    double m_max_abs_error;         // Largest |fast - reference|, over all the samples with a finite reference
+    std::size_t m_excluded;         // Samples under the value floor (excluded from ULPs and relative errors) or with no finite reference
+
+    std::string ToString() const;   // One line summary
+};
+
+class PrecisionValidation
+{
+public:
+    static std::vector<Precision_Region> Default_Regions();    // ATM/ITM/OTM, short and long expiries, low and high volatilities, spot and futures
+
+    // Samples the region and compares the float batch kernel to the double batch kernel. Prices under price_floor (e.g. 1e-4) are excluded from relative errors.
+    static Precision_Report Validate(const Precision_Region& region, const Option_Type& optiontype, const std::size_t& samples, const unsigned& seed,
+        const double& price_floor = 1e-4);
+
+    static std::vector<Precision_Report> Validate_All(const std::size_t& samples, const unsigned& seed);   // Default regions, calls and puts
+
+    // Samples the region and compares every fast path to the long double reference: prices (scalar kernel, double and float batches under each available
+    // instruction-set variant), delta, gamma, vega, theta, divided-difference delta, perpetual American prices (T not used; spots where the option is held, short
+    // of the exercise boundary), and for calls put-call parity.
+    // Values under value_floor in magnitude are excluded from ULPs and relative errors. The selected instruction-set variant is restored on return.
+    static std::vector<Reference_Report> Validate_Reference(const Precision_Region& region, const Option_Type& optiontype, const std::size_t& samples,
+        const unsigned& seed, const double& value_floor = 1e-4);
+
+    // Inverse normal of the scalar kernel and of the double and float batches under each available variant, over the central region and the tails of p
+    static std::vector<Reference_Report> Validate_Inverse_N(const std::size_t& samples, const unsigned& seed);
+
+    static std::vector<Reference_Report> Validate_Reference_All(const std::size_t& samples, const unsigned& seed);  // Default regions, calls and puts, and inverse normal
+};
+
+#endif //PrecisionValidation_hpp
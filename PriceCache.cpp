@@ -0,0 +1,347 @@
+//PriceCache.cpp
+//
+//Purpose: In-process cache of prices for repeated quotes, in front of the Black-Scholes and perpetual American engines. Parameters are quantized to configurable
+//         tick sizes, and each cached entry holds the price, delta and vega at the centre of its tick, so that requests falling within the same ticks are served
+//         without calling N(): either the price at the centre, or with a first-order Taylor correction in S and Sig using the cached delta and vega.
+//         The cache is split into shards, each a set-associative table with LRU replacement within a set (recency is counted in writes to the shard, so that
+//         hits do not contend on a shared clock). Reads take no lock: each entry is guarded by a sequence counter (seqlock), and a read that overlaps a write is
+//         retried. Writers of a shard are serialized by its own mutex.
+//         Hits, misses and a sample of the latencies of each path are recorded for instrumentation.
+//
+//Modification date: 10/18/2026
+
+
+#include "PriceCache.hpp"
+#include "BSExactPricingEngine.hpp"
+#include "PricingKernels.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstring>      // For std::memcpy
+#include <sstream>
+#include <stdexcept>
+
+
+// Every field is atomic so that lock-free readers racing with a writer are well defined; the sequence counter tells them whether what they read is consistent
+struct PriceCache::Entry
+{
+    std::atomic<std::uint32_t> m_sequence{0};   // Odd while a write is in progress
+    std::atomic<std::uint64_t> m_tag{0};        // Hash of the key, with the lowest bit set; 0 for an empty entry
+    std::atomic<std::int64_t> m_key[6];         // Quantized S, K, T, R, Sig, B
+    std::atomic<double> m_price{0.0};
+    std::atomic<double> m_delta{0.0};
+    std::atomic<double> m_vega{0.0};
+    std::atomic<std::uint64_t> m_last_used{0};  // Value of the shard clock at the last hit or write
+
+    Entry(){for(int p = 0; p < 6; p++){m_key[p].store(0, std::memory_order_relaxed);}}
+};
+
+struct alignas(64) PriceCache::Shard
+{
+    std::mutex m_mutex;                         // Serializes writers
+    std::unique_ptr<Entry[]> m_entries;         // Sets of Ways entries, contiguous
+    std::atomic<std::uint64_t> m_clock{0};      // Number of writes into the shard
+    std::atomic<std::uint64_t> m_hits{0}, m_corrected{0}, m_misses{0}, m_retries{0};
+    std::atomic<std::uint64_t> m_hit_ns{0}, m_hit_samples{0}, m_miss_ns{0}, m_miss_samples{0};
+    std::atomic<std::uint64_t> m_hit_buckets[Latency_Buckets];
+    std::atomic<std::uint64_t> m_miss_buckets[Latency_Buckets];
+
+    Shard()
+    {
+        for(std::size_t b = 0; b < Latency_Buckets; b++)
+        {
+            m_hit_buckets[b].store(0, std::memory_order_relaxed);
+            m_miss_buckets[b].store(0, std::memory_order_relaxed);
+        }
+    }
+};
+
+namespace
+{
+    std::size_t Round_Power_Of_Two(const std::size_t& value)
+    {
+        std::size_t power = 1;
+        while(power < value){power <<= 1;}
+        return power;
+    }
+
+    std::uint64_t Combine(const std::uint64_t& hash, const std::uint64_t& word)     // Combines one word into the hash, one multiply per word
+    {
+        return (hash ^ word) * 0x9E3779B97F4A7C15ULL;
+    }
+
+    std::uint64_t Finalize(std::uint64_t hash)      // Spreads every bit of the hash over the bits used for the shard and the set (splitmix64 finalizer)
+    {
+        hash ^= hash >> 30;
+        hash *= 0xBF58476D1CE4E5B9ULL;
+        hash ^= hash >> 27;
+        hash *= 0x94D049BB133111EBULL;
+        return hash ^ (hash >> 31);
+    }
+
+    std::size_t Latency_Bucket(const std::uint64_t& ns)     // Bucket b holds latencies in [2^(b-1), 2^b)
+    {
+        std::size_t bucket = 0;
+        for(std::uint64_t v = ns; v > 0 && bucket + 1 < PriceCache::Latency_Buckets; v >>= 1){bucket++;}
+        return bucket;
+    }
+
+    double Percentile_Bucket(const std::vector<std::uint64_t>& buckets, const double& q)    // Upper bound of the bucket holding the q-quantile
+    {
+        std::uint64_t total = 0;
+        for(std::size_t b = 0; b < buckets.size(); b++){total += buckets[b];}
+        if(total == 0){return 0.0;}
+        std::uint64_t cumulative = 0;
+        for(std::size_t b = 0; b < buckets.size(); b++)
+        {
+            cumulative += buckets[b];
+            if(static_cast<double>(cumulative) >= q * static_cast<double>(total)){return std::ldexp(1.0, static_cast<int>(b));}
+        }
+        return std::ldexp(1.0, static_cast<int>(buckets.size()));
+    }
+
+    thread_local std::uint64_t Calls = 0;    // Per-thread call counter for latency sampling, so that sampling does not contend
+}
+
+
+//Overloaded constructor
+PriceCache::PriceCache(const Price_Cache_Ticks& ticks, const std::size_t& capacity, const std::size_t& shards, const bool& taylor)
+: m_ticks(ticks), m_taylor(taylor)
+{
+    const double values[6] = {ticks.m_S, ticks.m_K, ticks.m_T, ticks.m_R, ticks.m_Sig, ticks.m_B};
+    for(int p = 0; p < 6; p++)
+    {
+        if(!(values[p] >= 0.0)){throw std::invalid_argument("Error: Tick sizes of the price cache must be non-negative.");}
+        m_inverse_ticks[p] = (values[p] > 0.0) ? 1.0 / values[p] : 0.0;
+    }
+    if(capacity == 0 || shards == 0){throw std::invalid_argument("Error: Price cache needs a positive capacity and number of shards.");}
+
+    const std::size_t shard_count = Round_Power_Of_Two(shards);
+    std::size_t entries = Round_Power_Of_Two(capacity);
+    if(entries < shard_count * Ways){entries = shard_count * Ways;}
+    m_sets_per_shard = entries / (shard_count * Ways);
+
+    for(std::size_t s = 0; s < shard_count; s++)
+    {
+        m_shards.emplace_back(new Shard());
+        m_shards.back()->m_entries.reset(new Entry[m_sets_per_shard * Ways]);
+    }
+}
+
+//Destructor
+PriceCache::~PriceCache()
+{
+    //std::cout << "Destructor in PriceCache used." << std::endl;
+}
+
+
+std::int64_t PriceCache::Quantize(const double& value, const double& tick, const double& inverse_tick, double& centre)
+{
+    if(tick == 0.0)
+    {
+        centre = value;
+        std::int64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+    std::int64_t index = static_cast<std::int64_t>(std::nearbyint(value * inverse_tick));    // Round to nearest, cheaper than llround()
+    centre = static_cast<double>(index) * tick;
+    return index;
+}
+
+void PriceCache::Compute(const Model_Type& model, const Option_Type& optiontype, const double* centre, double& price, double& delta, double& vega)
+{
+    const double S = centre[0], K = centre[1], T = centre[2], R = centre[3], Sig = centre[4], B = centre[5];
+    if(model == Model_Type::European)
+    {
+        BS_Greeks greeks = BSExactPricingEngine::Greeks_BS(S, K, T, R, Sig, B);   // One fused evaluation for the price, delta and vega
+        price = (optiontype == Option_Type::Call) ? greeks.m_call_price : greeks.m_put_price;
+        delta = (optiontype == Option_Type::Call) ? greeks.m_call_delta : greeks.m_put_delta;
+        vega = greeks.m_vega;
+        return;
+    }
+
+    // Perpetual American: delta and vega by central differences, with steps relative to S and Sig
+    typedef double (*Perpetual)(const double&, const double&, const double&, const double&, const double&);
+    Perpetual pricer = (optiontype == Option_Type::Call) ? &AmericanPerp_Kernel<double>::Call_Price : &AmericanPerp_Kernel<double>::Put_Price;
+    const double h_S = 1e-4 * S, h_Sig = 1e-4 * Sig;
+    price = pricer(S, K, R, Sig, B);
+    delta = (pricer(S + h_S, K, R, Sig, B) - pricer(S - h_S, K, R, Sig, B)) / (2.0 * h_S);
+    vega = (pricer(S, K, R, Sig + h_Sig, B) - pricer(S, K, R, Sig - h_Sig, B)) / (2.0 * h_Sig);
+}
+
+
+double PriceCache::Price(const Model_Type& model, const Option_Type& optiontype, const double& S, const double& K, const double& T, const double& R, const double& Sig,
+    const double& B)
+{
+    const bool sampled = (++Calls % Sample_Period == 0);
+    std::chrono::steady_clock::time_point start;
+    if(sampled){start = std::chrono::steady_clock::now();}
+
+    const double values[6] = {S, K, (model == Model_Type::European) ? T : 0.0, R, Sig, B};   // T does not enter the perpetual key
+    const double ticks[6] = {m_ticks.m_S, m_ticks.m_K, m_ticks.m_T, m_ticks.m_R, m_ticks.m_Sig, m_ticks.m_B};
+    double centre[6];
+    std::int64_t key[6];
+    std::uint64_t hash = static_cast<std::uint64_t>(model) * 2 + static_cast<std::uint64_t>(optiontype);
+    for(int p = 0; p < 6; p++)
+    {
+        key[p] = Quantize(values[p], ticks[p], m_inverse_ticks[p], centre[p]);
+        hash = Combine(hash, static_cast<std::uint64_t>(key[p]));
+    }
+    hash = Finalize(hash);
+    const std::uint64_t tag = hash | 1;
+
+    Shard& shard = *m_shards[(hash >> 40) & (m_shards.size() - 1)];
+    Entry* set = shard.m_entries.get() + ((hash >> 1) & (m_sets_per_shard - 1)) * Ways;
+
+    double price = 0.0, delta = 0.0, vega = 0.0;
+    bool hit = false;
+    for(std::size_t w = 0; w < Ways && !hit; w++)
+    {
+        Entry& entry = set[w];
+        for(int attempt = 0; attempt < 4; attempt++)
+        {
+            std::uint32_t before = entry.m_sequence.load(std::memory_order_acquire);
+            if(before & 1)  // Write in progress
+            {
+                shard.m_retries.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+            if(entry.m_tag.load(std::memory_order_relaxed) != tag){break;}
+            bool same = true;
+            for(int p = 0; p < 6; p++){same = same && (entry.m_key[p].load(std::memory_order_relaxed) == key[p]);}
+            price = entry.m_price.load(std::memory_order_relaxed);
+            delta = entry.m_delta.load(std::memory_order_relaxed);
+            vega = entry.m_vega.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if(entry.m_sequence.load(std::memory_order_relaxed) != before)     // Overlapped a write
+            {
+                shard.m_retries.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+            if(same)
+            {
+                hit = true;
+                // The clock only advances on writes, so that hits do not contend on it: recency is measured in writes, which is all replacement needs
+                std::uint64_t now = shard.m_clock.load(std::memory_order_relaxed);
+                if(entry.m_last_used.load(std::memory_order_relaxed) != now){entry.m_last_used.store(now, std::memory_order_relaxed);}
+            }
+            break;
+        }
+    }
+
+    if(!hit)
+    {
+        Compute(model, optiontype, centre, price, delta, vega);
+
+        std::lock_guard<std::mutex> lock(shard.m_mutex);
+        Entry* victim = &set[0];
+        for(std::size_t w = 0; w < Ways; w++)   // Empty way, or the least recently used one
+        {
+            if(set[w].m_tag.load(std::memory_order_relaxed) == 0){victim = &set[w]; break;}
+            if(set[w].m_last_used.load(std::memory_order_relaxed) < victim->m_last_used.load(std::memory_order_relaxed)){victim = &set[w];}
+        }
+        std::uint32_t sequence = victim->m_sequence.load(std::memory_order_relaxed);
+        victim->m_sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        victim->m_tag.store(tag, std::memory_order_relaxed);
+        for(int p = 0; p < 6; p++){victim->m_key[p].store(key[p], std::memory_order_relaxed);}
+        victim->m_price.store(price, std::memory_order_relaxed);
+        victim->m_delta.store(delta, std::memory_order_relaxed);
+        victim->m_vega.store(vega, std::memory_order_relaxed);
+        victim->m_last_used.store(shard.m_clock.fetch_add(1, std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        victim->m_sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    // The same correction on hits and misses, so that the answer does not depend on which request filled the entry
+    const double dS = S - centre[0], dSig = Sig - centre[4];
+    if(m_taylor && (dS != 0.0 || dSig != 0.0))
+    {
+        price += delta * dS + vega * dSig;
+        if(hit){shard.m_corrected.fetch_add(1, std::memory_order_relaxed);}
+    }
+    (hit ? shard.m_hits : shard.m_misses).fetch_add(1, std::memory_order_relaxed);
+
+    if(sampled)
+    {
+        std::uint64_t ns = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+        (hit ? shard.m_hit_ns : shard.m_miss_ns).fetch_add(ns, std::memory_order_relaxed);
+        (hit ? shard.m_hit_samples : shard.m_miss_samples).fetch_add(1, std::memory_order_relaxed);
+        (hit ? shard.m_hit_buckets : shard.m_miss_buckets)[Latency_Bucket(ns)].fetch_add(1, std::memory_order_relaxed);
+    }
+    return price;
+}
+
+void PriceCache::Clear()
+{
+    for(std::size_t s = 0; s < m_shards.size(); s++)
+    {
+        Shard& shard = *m_shards[s];
+        std::lock_guard<std::mutex> lock(shard.m_mutex);
+        for(std::size_t e = 0; e < m_sets_per_shard * Ways; e++)
+        {
+            Entry& entry = shard.m_entries[e];
+            std::uint32_t sequence = entry.m_sequence.load(std::memory_order_relaxed);
+            entry.m_sequence.store(sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            entry.m_tag.store(0, std::memory_order_relaxed);
+            entry.m_last_used.store(0, std::memory_order_relaxed);
+            entry.m_sequence.store(sequence + 2, std::memory_order_release);
+        }
+    }
+}
+
+
+//GETTERS
+
+Price_Cache_Statistics PriceCache::Statistics() const
+{
+    Price_Cache_Statistics statistics = {};
+    std::uint64_t hit_ns = 0, hit_samples = 0, miss_ns = 0, miss_samples = 0;
+    std::vector<std::uint64_t> hit_buckets(Latency_Buckets, 0), miss_buckets(Latency_Buckets, 0);
+    for(std::size_t s = 0; s < m_shards.size(); s++)
+    {
+        const Shard& shard = *m_shards[s];
+        statistics.m_hits += shard.m_hits.load(std::memory_order_relaxed);
+        statistics.m_corrected += shard.m_corrected.load(std::memory_order_relaxed);
+        statistics.m_misses += shard.m_misses.load(std::memory_order_relaxed);
+        statistics.m_retries += shard.m_retries.load(std::memory_order_relaxed);
+        hit_ns += shard.m_hit_ns.load(std::memory_order_relaxed);
+        hit_samples += shard.m_hit_samples.load(std::memory_order_relaxed);
+        miss_ns += shard.m_miss_ns.load(std::memory_order_relaxed);
+        miss_samples += shard.m_miss_samples.load(std::memory_order_relaxed);
+        for(std::size_t b = 0; b < Latency_Buckets; b++)
+        {
+            hit_buckets[b] += shard.m_hit_buckets[b].load(std::memory_order_relaxed);
+            miss_buckets[b] += shard.m_miss_buckets[b].load(std::memory_order_relaxed);
+        }
+    }
+    statistics.m_hit_mean_ns = (hit_samples == 0) ? 0.0 : static_cast<double>(hit_ns) / static_cast<double>(hit_samples);
+    statistics.m_miss_mean_ns = (miss_samples == 0) ? 0.0 : static_cast<double>(miss_ns) / static_cast<double>(miss_samples);
+    statistics.m_hit_p99_ns = Percentile_Bucket(hit_buckets, 0.99);
+    statistics.m_miss_p99_ns = Percentile_Bucket(miss_buckets, 0.99);
+    return statistics;
+}
+
+Price_Cache_Ticks const& PriceCache::getTicks() const
+{
+    return m_ticks;
+}
+
+std::size_t PriceCache::capacity() const
+{
+    return m_shards.size() * m_sets_per_shard * Ways;
+}
+
+
+double Price_Cache_Statistics::Hit_Rate() const
+{
+    return (m_hits + m_misses == 0) ? 0.0 : static_cast<double>(m_hits) / static_cast<double>(m_hits + m_misses);
+}
+
+std::string Price_Cache_Statistics::ToString() const
+{
+    std::stringstream ss;
+    ss << "hits: " << m_hits << " (corrected: " << m_corrected << "); misses: " << m_misses << "; hit rate: " << Hit_Rate() << "; retries: " << m_retries
+       << "; hit latency mean/p99 (ns): " << m_hit_mean_ns << "/" << m_hit_p99_ns << "; miss latency mean/p99 (ns): " << m_miss_mean_ns << "/" << m_miss_p99_ns;
+    return ss.str();
+}
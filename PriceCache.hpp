@@ -0,0 +1,88 @@
+//PriceCache.hpp
+//
+//Purpose: In-process cache of prices for repeated quotes, in front of the Black-Scholes and perpetual American engines. Parameters are quantized to configurable
+//         tick sizes, and each cached entry holds the price, delta and vega at the centre of its tick, so that requests falling within the same ticks are served
+//         without calling N(): either the price at the centre, or with a first-order Taylor correction in S and Sig using the cached delta and vega.
+//         The cache is split into shards, each a set-associative table with LRU replacement within a set (recency is counted in writes to the shard, so that
+//         hits do not contend on a shared clock). Reads take no lock: each entry is guarded by a sequence counter (seqlock), and a read that overlaps a write is
+//         retried. Writers of a shard are serialized by its own mutex.
+//         Hits, misses and a sample of the latencies of each path are recorded for instrumentation.
+//
+//Modification date: 10/18/2026
+
+#ifndef PriceCache_hpp
+#define PriceCache_hpp
+
+#include "OptionData.hpp"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Tick size of each parameter. A tick of 0 disables quantization of that parameter, which must then match exactly.
+struct Price_Cache_Ticks
+{
+    double m_S, m_K, m_T, m_R, m_Sig, m_B;
+};
+
+// Hit rate and sampled latencies of the cache (one call in Sample_Period is timed)
+struct Price_Cache_Statistics
+{
+    std::uint64_t m_hits;               // Requests served from the cache
+    std::uint64_t m_corrected;          // Hits served with a Taylor correction (request away from the centre of its ticks)
+    std::uint64_t m_misses;             // Requests priced by the engine
+    std::uint64_t m_retries;            // Reads retried because they overlapped a write
+    double m_hit_mean_ns, m_hit_p99_ns;     // Latency of hits, mean and 99th percentile (power-of-two buckets), including the two clock reads
+    double m_miss_mean_ns, m_miss_p99_ns;   // Latency of misses, including the pricing and the insertion
+
+    double Hit_Rate() const;            // Hits over requests, 0 if there was no request
+    std::string ToString() const;       // One line summary
+};
+
+class PriceCache
+{
+    public:
+        static const std::size_t Ways = 4;              // Entries per set
+        static const std::uint64_t Sample_Period = 64;  // One call in Sample_Period is timed
+        static const std::size_t Latency_Buckets = 40;  // Power-of-two latency buckets, in nanoseconds
+
+    private:
+        struct Entry;       // Cached tick, defined in PriceCache.cpp
+        struct Shard;       // Sets of entries, writer mutex and counters of a shard
+
+        Price_Cache_Ticks m_ticks;
+        double m_inverse_ticks[6];                  // 1/tick (0 for exact parameters), so that quantization multiplies rather than divides
+        bool m_taylor;                              // Taylor correction in S and Sig on hits
+        std::size_t m_sets_per_shard;               // Power of two
+        std::vector<std::unique_ptr<Shard>> m_shards;   // Power of two
+
+        // Quantized parameter: index of the tick, or the bit pattern of the value if the tick is 0. The centre of the tick is returned in centre.
+        static std::int64_t Quantize(const double& value, const double& tick, const double& inverse_tick, double& centre);
+        // Prices and Greeks at the centre of the ticks, with the engine
+        static void Compute(const Model_Type& model, const Option_Type& optiontype, const double* centre, double& price, double& delta, double& vega);
+
+    public:
+    //CONSTRUCTORS AND DESTRUCTOR
+
+        // Capacity is the number of entries over all shards, rounded up to a power of two, as is the number of shards
+        PriceCache(const Price_Cache_Ticks& ticks, const std::size_t& capacity = 65536, const std::size_t& shards = 16, const bool& taylor = true);
+        PriceCache(const PriceCache& source) = delete;                  // Not copyable, as it holds mutexes and atomics
+        PriceCache& operator = (const PriceCache& source) = delete;
+        ~PriceCache();                                                  // Destructor
+
+    //PRICING
+
+        double Price(const Model_Type& model, const Option_Type& optiontype, const double& S, const double& K, const double& T, const double& R, const double& Sig,
+            const double& B);       // Cached price (T is not used by the perpetual American engine)
+        void Clear();               // Empties every shard, the statistics are kept
+
+    //GETTERS
+        Price_Cache_Statistics Statistics() const;
+        Price_Cache_Ticks const& getTicks() const;
+        std::size_t capacity() const;
+};
+
+#endif //PriceCache_hpp
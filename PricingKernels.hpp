@@ -0,0 +1,330 @@
+//PricingKernels.hpp
+//
+//Purpose: Pricing kernels templated on the scalar type (float or double), for Black-Scholes prices and Greeks, divided differences, and perpetual American
+//         options. Batch functions work on contiguous columns of parameters (structure of arrays), with branch-free loop bodies so that the compiler can vectorize
+//         them: in float, twice as many options fit in a SIMD register and half the memory bandwidth is used, which suits coarse what-if screening. For float, N()
+//         uses the polynomial approximation 26.2.17 of Abramowitz and Stegun (absolute error below 7.5e-8, under float resolution) rather than erfc().
+//         Inverse_N() turns uniforms (e.g. quasi-random points) into normals, with the same branch-free structure.
+//         PrecisionValidation.hpp quantifies the error of the float kernels against double.
+//         The scalar functions of BS_Kernel and DividedDiff_Kernel take their arguments by value and are defined here so that they inline into tight loops;
+//         BSExactPricingEngine and DividedDifferences are thin out-of-line wrappers over them.
+//
+//Modification date: 10/18/2026
+
+#ifndef PricingKernels_hpp
+#define PricingKernels_hpp
+
+#include "OptionData.hpp"
+#include <vector>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+
+// Parameter columns of a batch of options: element i of each column belongs to option i
+template<typename Real>
+struct Param_Columns
+{
+    std::vector<Real> S, K, T, R, Sig, B;
+
+    void resize(const std::size_t& size) {S.resize(size); K.resize(size); T.resize(size); R.resize(size); Sig.resize(size); B.resize(size);}
+    std::size_t size() const {return S.size();}
+};
+
+
+template<typename Real>
+class BS_Kernel
+{
+public:
+    // Algebra of the formulae, constexpr so that it is folded at compile time for constant inputs. The transcendental functions of <cmath> are not constexpr in
+    // C++17, so log(S/K), sqrt(T), the exponentials and N() are computed by the callers below and passed in.
+    static constexpr Real D1_Log(Real log_moneyness, Real T, Real Sig, Real B, Real sig_sqrt_T)     // D1 = ( ln(S/K) + (B + Sig^2/2)T ) / ( Sig*sqrt(T) )
+    {
+        return (log_moneyness + (B + Real(0.5)*Sig*Sig)*T) / sig_sqrt_T;
+    }
+
+    static constexpr Real D2(Real d1, Real sig_sqrt_T)     // D2 = D1 - Sig*sqrt(T)
+    {
+        return d1 - sig_sqrt_T;
+    }
+
+    // Black formula from the discounted forward S*exp((B-R)T), the discounted strike K*exp(-RT) and N() at d1 and d2 (or at -d1 and -d2 for the put)
+    static constexpr Real Call_Value(Real forward_value, Real strike_value, Real Nd1, Real Nd2)
+    {
+        return forward_value*Nd1 - strike_value*Nd2;
+    }
+
+    static constexpr Real Put_Value(Real forward_value, Real strike_value, Real N_d1, Real N_d2)
+    {
+        return strike_value*N_d2 - forward_value*N_d1;
+    }
+
+    static Real N(Real x)    // CDF of the normal distribution
+    {
+        return Real(0.5) * std::erfc(-x * Real(0.70710678118654752440));
+    }
+
+    static Real n(Real x)    // PDF of the normal distribution
+    {
+        return Real(0.39894228040143267794) * std::exp(Real(-0.5) * x * x);
+    }
+
+    // Inverse of N(), for p in (0,1): rational approximations of P. J. Acklam (relative error below 1.2e-9), refined by one step of Halley's method in the lower
+    // tail, where N(x) - p has no cancellation. The central and tail approximations are both evaluated and one is selected, so that the batch loop below has no
+    // branch and vectorizes.
+    static Real Inverse_N(Real p)
+    {
+        const Real q = p - Real(0.5);
+        const Real p_tail = (q < Real(0)) ? p : Real(1) - p;       // Smaller of p and 1-p, exact for p >= 0.5
+        const Real lower = Refine_Inverse_N(Inverse_N_Lower(p_tail, q), p_tail);
+        return (q < Real(0)) ? lower : -lower;
+    }
+
+    // Approximation of Inverse_N(p_tail) <= 0, with q = p - 1/2
+    static Real Inverse_N_Lower(Real p_tail, Real q)
+    {
+        const Real r = q*q;
+        Real central = (((((Real(-3.969683028665376e+01)*r + Real(2.209460984245205e+02))*r + Real(-2.759285104469687e+02))*r + Real(1.383577518672690e+02))*r
+            + Real(-3.066479806614716e+01))*r + Real(2.506628277459239e+00))*q
+            / (((((Real(-5.447609879822406e+01)*r + Real(1.615858368580409e+02))*r + Real(-1.556989798598866e+02))*r + Real(6.680131188771972e+01))*r
+            + Real(-1.328068155288572e+01))*r + Real(1));
+
+        const Real t = std::sqrt(Real(-2)*std::log(p_tail));
+        Real tail = (((((Real(-7.784894002430293e-03)*t + Real(-3.223964580411365e-01))*t + Real(-2.400758277161838e+00))*t + Real(-2.549732539343734e+00))*t
+            + Real(4.374664141464968e+00))*t + Real(2.938163982698783e+00))
+            / ((((Real(7.784695709041462e-03)*t + Real(3.224671290700398e-01))*t + Real(2.445134137142996e+00))*t + Real(3.754408661907416e+00))*t + Real(1));
+
+        return (std::fabs(q) <= Real(0.47575)) ? -std::fabs(central) : tail;
+    }
+
+    // One step of Halley's method on N(x) - p, for x <= 0
+    static Real Refine_Inverse_N(Real x, Real p)
+    {
+        Real u = (N(x) - p) / n(x);
+        return x - u / (Real(1) + Real(0.5)*x*u);
+    }
+
+    static Real D1(Real S, Real K, Real T, Real Sig, Real B)
+    {
+        return D1_Log(std::log(S/K), T, Sig, B, Sig*std::sqrt(T));
+    }
+
+    static Real Call_Price(Real S, Real K, Real T, Real R, Real Sig, Real B)
+    {
+        Real sig_sqrt_T = Sig*std::sqrt(T);
+        Real d1 = D1_Log(std::log(S/K), T, Sig, B, sig_sqrt_T);
+        return Call_Value(S*std::exp((B-R)*T), K*std::exp(-R*T), N(d1), N(D2(d1, sig_sqrt_T)));
+    }
+
+    static Real Put_Price(Real S, Real K, Real T, Real R, Real Sig, Real B)
+    {
+        Real sig_sqrt_T = Sig*std::sqrt(T);
+        Real d1 = D1_Log(std::log(S/K), T, Sig, B, sig_sqrt_T);
+        return Put_Value(S*std::exp((B-R)*T), K*std::exp(-R*T), N(-d1), N(sig_sqrt_T - d1));
+    }
+
+    // Call and put sharing D1, D2 and the discounting terms
+    static void Call_Put_Price(Real S, Real K, Real T, Real R, Real Sig, Real B, Real& call, Real& put)
+    {
+        Real sig_sqrt_T = Sig*std::sqrt(T);
+        Real d1 = D1_Log(std::log(S/K), T, Sig, B, sig_sqrt_T), d2 = D2(d1, sig_sqrt_T);
+        Real forward_value = S*std::exp((B-R)*T), strike_value = K*std::exp(-R*T);
+        call = Call_Value(forward_value, strike_value, N(d1), N(d2));
+        put = Put_Value(forward_value, strike_value, N(-d1), N(-d2));
+    }
+
+    static Real Call_Delta(Real S, Real K, Real T, Real R, Real Sig, Real B)
+    {
+        return std::exp((B-R)*T)*N(D1(S,K,T,Sig,B));
+    }
+
+    static Real Put_Delta(Real S, Real K, Real T, Real R, Real Sig, Real B)
+    {
+        return std::exp((B-R)*T)*(N(D1(S,K,T,Sig,B)) - Real(1));
+    }
+
+    static Real Gamma(Real S, Real K, Real T, Real R, Real Sig, Real B)
+    {
+        return n(D1(S,K,T,Sig,B))*std::exp((B-R)*T) / (S*Sig*std::sqrt(T));
+    }
+
+    static Real Vega(Real S, Real K, Real T, Real R, Real Sig, Real B)
+    {
+        return S*std::exp((B-R)*T)*n(D1(S,K,T,Sig,B))*std::sqrt(T);
+    }
+
+    // Thetas = -dV/dT
+    static Real Call_Theta(Real S, Real K, Real T, Real R, Real Sig, Real B)
+    {
+        Real sqrt_T = std::sqrt(T);
+        Real d1 = D1_Log(std::log(S/K), T, Sig, B, Sig*sqrt_T), d2 = D2(d1, Sig*sqrt_T);
+        Real carry = std::exp((B-R)*T);
+        return -(S*Sig*carry*n(d1)) / (Real(2)*sqrt_T) - (B-R)*S*carry*N(d1) - R*K*std::exp(-R*T)*N(d2);
+    }
+
+    static Real Put_Theta(Real S, Real K, Real T, Real R, Real Sig, Real B)
+    {
+        Real sqrt_T = std::sqrt(T);
+        Real d1 = D1_Log(std::log(S/K), T, Sig, B, Sig*sqrt_T), d2 = D2(d1, Sig*sqrt_T);
+        Real carry = std::exp((B-R)*T);
+        return -(S*Sig*carry*n(d1)) / (Real(2)*sqrt_T) + (B-R)*S*carry*N(-d1) + R*K*std::exp(-R*T)*N(-d2);
+    }
+
+    // Higher-order Greeks: vanna and volga in volatility, charm and color in time (sign convention of theta), speed in S
+    static Real Vanna(Real S, Real K, Real T, Real R, Real Sig, Real B)
+    {
+        Real sig_sqrt_T = Sig*std::sqrt(T);
+        Real d1 = D1_Log(std::log(S/K), T, Sig, B, sig_sqrt_T);
+        return -std::exp((B-R)*T)*n(d1)*D2(d1, sig_sqrt_T) / Sig;
+    }
+
+    static Real Volga(Real S, Real K, Real T, Real R, Real Sig, Real B)
+    {
+        Real sqrt_T = std::sqrt(T);
+        Real d1 = D1_Log(std::log(S/K), T, Sig, B, Sig*sqrt_T);
+        return S*std::exp((B-R)*T)*n(d1)*sqrt_T*d1*D2(d1, Sig*sqrt_T) / Sig;
+    }
+
+    static Real Call_Charm(Real S, Real K, Real T, Real R, Real Sig, Real B)
+    {
+        Real sig_sqrt_T = Sig*std::sqrt(T);
+        Real d1 = D1_Log(std::log(S/K), T, Sig, B, sig_sqrt_T);
+        return -std::exp((B-R)*T)*(n(d1)*(B/sig_sqrt_T - D2(d1, sig_sqrt_T)/(Real(2)*T)) + (B-R)*N(d1));
+    }
+
+    static Real Put_Charm(Real S, Real K, Real T, Real R, Real Sig, Real B)
+    {
+        Real sig_sqrt_T = Sig*std::sqrt(T);
+        Real d1 = D1_Log(std::log(S/K), T, Sig, B, sig_sqrt_T);
+        return -std::exp((B-R)*T)*(n(d1)*(B/sig_sqrt_T - D2(d1, sig_sqrt_T)/(Real(2)*T)) - (B-R)*N(-d1));
+    }
+
+    static Real Speed(Real S, Real K, Real T, Real R, Real Sig, Real B)
+    {
+        Real sig_sqrt_T = Sig*std::sqrt(T);
+        Real d1 = D1_Log(std::log(S/K), T, Sig, B, sig_sqrt_T);
+        Real gamma = n(d1)*std::exp((B-R)*T) / (S*sig_sqrt_T);
+        return -gamma*(Real(1) + d1/sig_sqrt_T) / S;
+    }
+
+    static Real Color(Real S, Real K, Real T, Real R, Real Sig, Real B)
+    {
+        Real sig_sqrt_T = Sig*std::sqrt(T);
+        Real d1 = D1_Log(std::log(S/K), T, Sig, B, sig_sqrt_T), d2 = D2(d1, sig_sqrt_T);
+        Real gamma = n(d1)*std::exp((B-R)*T) / (S*sig_sqrt_T);
+        return gamma*(R - B + B*d1/sig_sqrt_T + (Real(1) - d1*d2)/(Real(2)*T));
+    }
+
+    // Batch prices over parameter columns. Calls and puts share the loop body through a sign: P = K*exp(-RT)*N(-d2) - S*exp((B-R)T)*N(-d1)
+    static void Price_Batch(const Option_Type& optiontype, const std::size_t& size, const Real* S, const Real* K, const Real* T, const Real* R, const Real* Sig,
+        const Real* B, Real* results)
+    {
+        const Real sign = (optiontype == Option_Type::Call) ? Real(1) : Real(-1);
+        for(std::size_t i = 0; i < size; i++)
+        {
+            Real sig_sqrt_T = Sig[i]*std::sqrt(T[i]);
+            Real d1 = (std::log(S[i]/K[i]) + (B[i] + Real(0.5)*Sig[i]*Sig[i])*T[i]) / sig_sqrt_T;
+            results[i] = sign*(S[i]*std::exp((B[i]-R[i])*T[i])*N(sign*d1) - K[i]*std::exp(-R[i]*T[i])*N(sign*(d1 - sig_sqrt_T)));
+        }
+    }
+
+    static void Price_Batch(const Option_Type& optiontype, const Param_Columns<Real>& columns, std::vector<Real>& results)
+    {
+        results.resize(columns.size());
+        Price_Batch(optiontype, columns.size(), columns.S.data(), columns.K.data(), columns.T.data(), columns.R.data(), columns.Sig.data(), columns.B.data(), results.data());
+    }
+
+    // Batch inverse normal, e.g. of the uniforms of a quasi-random point
+    static void Inverse_N_Batch(const std::size_t& size, const Real* p, Real* x)
+    {
+        for(std::size_t i = 0; i < size; i++)
+        {
+            x[i] = Inverse_N(p[i]);
+        }
+    }
+};
+
+// In float, N() uses a polynomial approximation made of one exponential and a rational term, with a select rather than a branch, which vectorizes. The tail
+// N(-|x|) is returned as computed for x < 0: forming 1 - N(|x|) there would cancel catastrophically, as N(|x|) is close to 1.
+template<>
+inline float BS_Kernel<float>::N(float x)
+{
+    float z = std::fabs(x);
+    float t = 1.0f / (1.0f + 0.2316419f*z);
+    float poly = t*(0.319381530f + t*(-0.356563782f + t*(1.781477937f + t*(-1.821255978f + t*1.330274429f))));
+    float tail = 0.39894228f*std::exp(-0.5f*z*z)*poly;             // N(-|x|)
+    return (x >= 0.0f) ? 1.0f - tail : tail;
+}
+
+// In float, the approximation of Inverse_N() is evaluated in double, where its error is already below float resolution, and is not refined: in float, its
+// rational functions lose digits to cancellation, and N() is not accurate enough in the tails to refine with
+template<>
+inline float BS_Kernel<float>::Inverse_N(float p)
+{
+    const double q = double(p) - 0.5;
+    const double lower = BS_Kernel<double>::Inverse_N_Lower((q < 0.0) ? double(p) : 0.5 - q, q);
+    return float((q < 0.0) ? lower : -lower);
+}
+
+// For complex-step differentiation, the kernels are evaluated at x + i*y with y of the order of 1e-20: to first order in y, N(x + i*y) = N(x) + i*y*n(x), which is
+// all the complex step uses (the neglected terms are O(y^2)), and avoids a complex erfc(), which the standard library does not provide
+template<>
+inline std::complex<double> BS_Kernel<std::complex<double>>::N(std::complex<double> x)
+{
+    return std::complex<double>(BS_Kernel<double>::N(x.real()), x.imag()*BS_Kernel<double>::n(x.real()));
+}
+
+
+template<typename Real>
+class DividedDiff_Kernel
+{
+public:
+    // ( V(S+h) - V(S-h) ) / 2h
+    static Real Delta_Call(Real S, Real K, Real T, Real R, Real Sig, Real B, Real h)
+    {
+        return (BS_Kernel<Real>::Call_Price(S+h,K,T,R,Sig,B) - BS_Kernel<Real>::Call_Price(S-h,K,T,R,Sig,B)) / (Real(2)*h);
+    }
+
+    static Real Delta_Put(Real S, Real K, Real T, Real R, Real Sig, Real B, Real h)
+    {
+        return (BS_Kernel<Real>::Put_Price(S+h,K,T,R,Sig,B) - BS_Kernel<Real>::Put_Price(S-h,K,T,R,Sig,B)) / (Real(2)*h);
+    }
+
+    // ( V(S+h) - 2V(S) + V(S-h) ) / h^2
+    static Real Gamma(Real S, Real K, Real T, Real R, Real Sig, Real B, Real h)
+    {
+        return (BS_Kernel<Real>::Call_Price(S+h,K,T,R,Sig,B) - Real(2)*BS_Kernel<Real>::Call_Price(S,K,T,R,Sig,B) + BS_Kernel<Real>::Call_Price(S-h,K,T,R,Sig,B)) / (h*h);
+    }
+};
+
+
+template<typename Real>
+class AmericanPerp_Kernel
+{
+public:
+    static Real Call_Price(const Real& S, const Real& K, const Real& R, const Real& Sig, const Real& B)
+    {
+        Real sig2 = Sig*Sig;
+        Real y1 = Real(0.5) - B/sig2 + std::sqrt((B/sig2 - Real(0.5))*(B/sig2 - Real(0.5)) + Real(2)*R/sig2);
+        return (K/(y1 - Real(1)))*std::pow(((y1 - Real(1))/y1)*(S/K), y1);
+    }
+
+    static Real Put_Price(const Real& S, const Real& K, const Real& R, const Real& Sig, const Real& B)
+    {
+        Real sig2 = Sig*Sig;
+        Real y2 = Real(0.5) - B/sig2 - std::sqrt((B/sig2 - Real(0.5))*(B/sig2 - Real(0.5)) + Real(2)*R/sig2);
+        return (K/(Real(1) - y2))*std::pow(((y2 - Real(1))/y2)*(S/K), y2);
+    }
+
+    // Batch prices over parameter columns (T is not used)
+    static void Price_Batch(const Option_Type& optiontype, const Param_Columns<Real>& columns, std::vector<Real>& results)
+    {
+        results.resize(columns.size());
+        for(std::size_t i = 0; i < columns.size(); i++)
+        {
+            results[i] = (optiontype == Option_Type::Call) ? Call_Price(columns.S[i], columns.K[i], columns.R[i], columns.Sig[i], columns.B[i])
+                                                           : Put_Price(columns.S[i], columns.K[i], columns.R[i], columns.Sig[i], columns.B[i]);
+        }
+    }
+};
+
+#endif //PricingKernels_hpp
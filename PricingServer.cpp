@@ -0,0 +1,507 @@
+//PricingServer.cpp
+//
+//Purpose: Standalone pricing service. Clients connect through a Unix domain socket or a local TCP port, and send one pricing request per line:
+//
+//              <request id> <E|A> <C|P> S K T R Sig B
+//
+//         with E for the European Black-Scholes engine and A for the perpetual American formulae (T is then ignored). The server answers "<request id> <price>", or
+//         "<request id> ERR <reason>", and a line "STATS" is answered with the latency and batch-size statistics. Requests from every connection are coalesced
+//         into micro-batches within a configurable time window, and the batches are priced on a thread pool, by the batch kernels of each model and option type.
+//         Replies are written as soon as their batch is done, so that they may come back in a different order than the requests. A line longer than Max_Line
+//         is answered with "ERR request line too long", and its connection closed.
+//
+//Modification date: 10/18/2026
+
+
+#include "PricingServer.hpp"
+#include "PricingKernels.hpp"
+#include "KernelDispatch.hpp"
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdio>       // For snprintf()
+#include <cstdlib>      // For strtod()
+#include <cstring>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+
+
+// Socket of a client, and the thread reading its requests. Replies from several pricing threads may be written to the same connection, hence the mutex.
+// The socket is closed once the connection has left m_connections and the requests still in flight have been answered.
+struct PricingServer::Connection
+{
+    int m_fd;
+    std::mutex m_write_mutex;
+    std::thread m_reader;       // Moved to m_finished_readers by the reader itself when it returns
+
+    explicit Connection(const int& fd): m_fd(fd) {}
+    ~Connection() {::close(m_fd);}
+
+    void Write(const std::string& data)
+    {
+        std::lock_guard<std::mutex> lock(m_write_mutex);
+        std::size_t sent = 0;
+        while(sent < data.size())
+        {
+            ssize_t n = ::send(m_fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+            if(n < 0 && errno == EINTR){continue;}
+            if(n <= 0){return;}     // The client went away: its replies are dropped
+            sent += static_cast<std::size_t>(n);
+        }
+    }
+};
+
+namespace
+{
+    const std::size_t Micro_Buckets = 1000;     // Latency buckets of 1us, up to 1ms
+    const std::size_t Milli_Buckets = 1000;     // Latency buckets of 1ms, up to 1s (the last one also holds anything slower)
+
+    // Fills a socket address from "unix:<path>" or "tcp:<port>". Returns the address family, or -1 if the address cannot be parsed.
+    int Parse_Address(const std::string& address, sockaddr_storage& storage, socklen_t& length)
+    {
+        std::memset(&storage, 0, sizeof(storage));
+        if(address.compare(0, 5, "unix:") == 0)
+        {
+            sockaddr_un* un = reinterpret_cast<sockaddr_un*>(&storage);
+            std::string path = address.substr(5);
+            if(path.empty() || path.size() >= sizeof(un->sun_path)){return -1;}
+            un->sun_family = AF_UNIX;
+            std::memcpy(un->sun_path, path.c_str(), path.size() + 1);
+            length = sizeof(sockaddr_un);
+            return AF_UNIX;
+        }
+        if(address.compare(0, 4, "tcp:") == 0)
+        {
+            sockaddr_in* in = reinterpret_cast<sockaddr_in*>(&storage);
+            in->sin_family = AF_INET;
+            in->sin_port = htons(static_cast<unsigned short>(std::atoi(address.c_str() + 4)));
+            in->sin_addr.s_addr = htonl(INADDR_LOOPBACK);   // Local front-end only
+            length = sizeof(sockaddr_in);
+            return AF_INET;
+        }
+        return -1;
+    }
+
+    double Bucket_Value(const std::size_t& bucket)   // Upper bound of a latency bucket, in microseconds
+    {
+        return (bucket < Micro_Buckets) ? static_cast<double>(bucket + 1) : 1000.0 * static_cast<double>(bucket - Micro_Buckets + 2);
+    }
+}
+
+
+std::string Server_Statistics::ToString() const
+{
+    std::stringstream ss;
+    ss << "requests: " << m_requests << "; batches: " << m_batches << "; mean batch: " << m_mean_batch << "; max batch: " << m_max_batch
+       << "; latency p50: " << m_p50_us << "us; p99: " << m_p99_us << "us; p99.9: " << m_p999_us << "us; max: " << m_max_us << "us";
+    return ss.str();
+}
+
+
+//Constructor
+PricingServer::PricingServer(const std::string& address, const std::chrono::microseconds& window, const std::size_t& max_batch, const unsigned& threads)
+: m_address(address), m_window(window), m_max_batch(max_batch > 0 ? max_batch : 1), m_threads(threads > 0 ? threads : 1), m_listen_fd(-1), m_running(false),
+m_request_count(0), m_batch_count(0), m_max_batch_seen(0), m_latency_histogram(Micro_Buckets + Milli_Buckets, 0)
+{
+    //std::cout << "Constructor in PricingServer used." << std::endl;
+}
+
+//Destructor
+PricingServer::~PricingServer()
+{
+    Stop();
+}
+
+
+//SERVER FUNCTIONS
+
+void PricingServer::Start()
+{
+    if(m_running){return;}
+
+    sockaddr_storage storage;
+    socklen_t length = 0;
+    int family = Parse_Address(m_address, storage, length);
+    if(family < 0){throw std::invalid_argument("Error: Server address must be unix:<path> or tcp:<port>.");}
+
+    m_listen_fd = ::socket(family, SOCK_STREAM, 0);
+    if(m_listen_fd < 0){throw std::runtime_error("Error: Cannot create the server socket.");}
+
+    if(family == AF_UNIX)
+    {
+        ::unlink(m_address.c_str() + 5);    // Removing a socket file left over by a previous run
+    }
+    else
+    {
+        int reuse = 1;
+        ::setsockopt(m_listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    }
+
+    if(::bind(m_listen_fd, reinterpret_cast<sockaddr*>(&storage), length) < 0 || ::listen(m_listen_fd, 128) < 0)
+    {
+        ::close(m_listen_fd);
+        m_listen_fd = -1;
+        throw std::runtime_error("Error: Cannot bind the server socket to " + m_address + ".");
+    }
+
+    m_running = true;
+    for(unsigned i = 0; i < m_threads; i++)
+    {
+        m_workers.emplace_back(&PricingServer::Worker_Loop, this);
+    }
+    m_batcher = std::thread(&PricingServer::Batch_Loop, this);
+    m_acceptor = std::thread(&PricingServer::Accept_Loop, this);
+}
+
+void PricingServer::Stop()
+{
+    if(!m_running.exchange(false)){return;}
+
+    // Unblocking accept() and every recv()
+    ::shutdown(m_listen_fd, SHUT_RDWR);
+    ::close(m_listen_fd);
+    if(m_acceptor.joinable()){m_acceptor.join();}     // No connection is added past this point
+    {
+        std::lock_guard<std::mutex> lock(m_connections_mutex);
+        for(std::list<std::shared_ptr<Connection>>::iterator it = m_connections.begin(); it != m_connections.end(); ++it)
+        {
+            ::shutdown((*it)->m_fd, SHUT_RDWR);
+        }
+    }
+    m_queue_cv.notify_all();
+    m_pool_cv.notify_all();
+
+    // Every reader returns and leaves m_connections; the last ones to return are joined here
+    {
+        std::unique_lock<std::mutex> lock(m_connections_mutex);
+        while(!m_connections.empty() || !m_finished_readers.empty())
+        {
+            m_readers_cv.wait(lock, [this]{return m_connections.empty() || !m_finished_readers.empty();});
+            std::vector<std::thread> finished;
+            finished.swap(m_finished_readers);
+            lock.unlock();
+            for(std::size_t i = 0; i < finished.size(); i++){finished[i].join();}
+            lock.lock();
+        }
+    }
+    if(m_batcher.joinable()){m_batcher.join();}
+    for(std::size_t i = 0; i < m_workers.size(); i++){m_workers[i].join();}
+
+    m_workers.clear();
+    if(m_address.compare(0, 5, "unix:") == 0){::unlink(m_address.c_str() + 5);}
+}
+
+bool PricingServer::isRunning() const
+{
+    return m_running;
+}
+
+Server_Statistics PricingServer::Statistics()
+{
+    Server_Statistics statistics;
+    statistics.m_requests = m_request_count;
+    statistics.m_batches = m_batch_count;
+    statistics.m_max_batch = m_max_batch_seen;
+    statistics.m_mean_batch = (statistics.m_batches > 0) ? static_cast<double>(statistics.m_requests) / static_cast<double>(statistics.m_batches) : 0.0;
+
+    std::vector<std::uint64_t> histogram;
+    {
+        std::lock_guard<std::mutex> lock(m_latency_mutex);
+        histogram = m_latency_histogram;
+    }
+
+    std::uint64_t total = 0;
+    for(std::size_t b = 0; b < histogram.size(); b++){total += histogram[b];}
+
+    // Percentiles from the cumulative histogram, reported as the upper bound of the bucket
+    double quantiles[3] = {0.50, 0.99, 0.999};
+    double* targets[3] = {&statistics.m_p50_us, &statistics.m_p99_us, &statistics.m_p999_us};
+    statistics.m_p50_us = statistics.m_p99_us = statistics.m_p999_us = statistics.m_max_us = 0.0;
+    for(int q = 0; q < 3 && total > 0; q++)
+    {
+        std::uint64_t rank = static_cast<std::uint64_t>(quantiles[q] * static_cast<double>(total - 1)), cumulative = 0;
+        for(std::size_t b = 0; b < histogram.size(); b++)
+        {
+            cumulative += histogram[b];
+            if(cumulative > rank){*targets[q] = Bucket_Value(b); break;}
+        }
+    }
+    for(std::size_t b = histogram.size(); b-- > 0; )
+    {
+        if(histogram[b] > 0){statistics.m_max_us = Bucket_Value(b); break;}
+    }
+    return statistics;
+}
+
+int PricingServer::Connect(const std::string& address)
+{
+    sockaddr_storage storage;
+    socklen_t length = 0;
+    int family = Parse_Address(address, storage, length);
+    if(family < 0){return -1;}
+
+    int fd = ::socket(family, SOCK_STREAM, 0);
+    if(fd < 0){return -1;}
+    if(::connect(fd, reinterpret_cast<sockaddr*>(&storage), length) < 0)
+    {
+        ::close(fd);
+        return -1;
+    }
+    if(family == AF_INET)
+    {
+        int nodelay = 1;
+        ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+    }
+    return fd;
+}
+
+
+//THREADS
+
+void PricingServer::Accept_Loop()
+{
+    while(m_running)
+    {
+        int fd = ::accept(m_listen_fd, nullptr, nullptr);
+        if(fd < 0)
+        {
+            if(errno == EINTR){continue;}
+            break;      // Listening socket closed by Stop()
+        }
+
+        if(m_address.compare(0, 4, "tcp:") == 0)
+        {
+            int nodelay = 1;
+            ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+        }
+
+        std::shared_ptr<Connection> connection = std::make_shared<Connection>(fd);
+        std::lock_guard<std::mutex> lock(m_connections_mutex);
+        if(!m_running){break;}
+        m_connections.push_back(connection);
+        connection->m_reader = std::thread(&PricingServer::Read_Loop, this, connection);    // Under the lock, so that the reader finds its thread when it returns
+    }
+}
+
+void PricingServer::Read_Loop(std::shared_ptr<Connection> connection)
+{
+    std::string pending;    // Bytes received, not yet split into lines
+    char buffer[65536];
+
+    while(m_running)
+    {
+        ssize_t n = ::recv(connection->m_fd, buffer, sizeof(buffer), 0);
+        if(n < 0 && errno == EINTR){continue;}
+        if(n <= 0){break;}      // Client closed the connection, or Stop() shut it down
+
+        pending.append(buffer, static_cast<std::size_t>(n));
+
+        std::vector<Request> parsed;
+        std::string errors;
+        std::size_t start = 0, end;
+        while((end = pending.find('\n', start)) != std::string::npos)
+        {
+            std::string line = pending.substr(start, end - start);
+            start = end + 1;
+            if(!line.empty() && line[line.size()-1] == '\r'){line.erase(line.size()-1);}
+            if(line.empty()){continue;}
+
+            if(line == "STATS")
+            {
+                errors += "STATS " + Statistics().ToString() + "\n";
+                continue;
+            }
+
+            Request request;
+            request.m_connection = connection;
+            request.m_arrival = std::chrono::steady_clock::now();
+            if(Parse_Request(line, request))
+            {
+                parsed.push_back(request);
+            }
+            else
+            {
+                errors += line.substr(0, line.find(' ')) + " ERR malformed request\n";
+            }
+        }
+        pending.erase(0, start);
+
+        // A line longer than Max_Line without its end is refused, and the connection closed, rather than buffered without bound
+        const bool overlong = (pending.size() > Max_Line);
+        if(overlong){errors += "ERR request line too long\n";}
+
+        if(!errors.empty()){connection->Write(errors);}
+        if(!parsed.empty())
+        {
+            std::lock_guard<std::mutex> lock(m_queue_mutex);
+            for(std::size_t i = 0; i < parsed.size(); i++){m_queue.push_back(parsed[i]);}
+            m_queue_cv.notify_one();
+        }
+        if(overlong){break;}
+    }
+
+    // Reaping: the connection leaves m_connections, and this thread is handed to the next reader to return (or to Stop()) to be joined, as it cannot join
+    // itself. The reader threads that returned before are joined here, so that at most one returned thread is left unjoined while the server runs.
+    std::vector<std::thread> finished;
+    {
+        std::lock_guard<std::mutex> lock(m_connections_mutex);
+        finished.swap(m_finished_readers);
+        m_finished_readers.push_back(std::move(connection->m_reader));
+        m_connections.remove(connection);
+    }
+    m_readers_cv.notify_all();
+    for(std::size_t i = 0; i < finished.size(); i++){finished[i].join();}
+}
+
+// Waits for a first request, then for the end of its time window (or for a full batch), and hands the batch to the pricing threads
+void PricingServer::Batch_Loop()
+{
+    while(true)
+    {
+        std::vector<Request> batch;
+        {
+            std::unique_lock<std::mutex> lock(m_queue_mutex);
+            m_queue_cv.wait(lock, [this]{return !m_queue.empty() || !m_running;});
+            if(!m_running){break;}
+
+            std::chrono::steady_clock::time_point deadline = m_queue.front().m_arrival + m_window;
+            m_queue_cv.wait_until(lock, deadline, [this]{return m_queue.size() >= m_max_batch || !m_running;});
+            if(!m_running){break;}
+
+            std::size_t size = (m_queue.size() < m_max_batch) ? m_queue.size() : m_max_batch;
+            batch.assign(m_queue.begin(), m_queue.begin() + size);
+            m_queue.erase(m_queue.begin(), m_queue.begin() + size);
+        }
+
+        std::lock_guard<std::mutex> lock(m_pool_mutex);
+        m_batches.push_back(std::move(batch));
+        m_pool_cv.notify_one();
+    }
+}
+
+void PricingServer::Worker_Loop()
+{
+    while(true)
+    {
+        std::vector<Request> batch;
+        {
+            std::unique_lock<std::mutex> lock(m_pool_mutex);
+            m_pool_cv.wait(lock, [this]{return !m_batches.empty() || !m_running;});
+            if(!m_running){break;}
+            batch = std::move(m_batches.front());
+            m_batches.pop_front();
+        }
+        Price_Batch(batch);
+    }
+}
+
+void PricingServer::Price_Batch(std::vector<Request>& batch)
+{
+    // The batch is split by model and option type into parameter columns, each group priced by one call of its batch kernel, and the prices scattered back
+    std::vector<double> prices(batch.size());
+    Param_Columns<double> columns;
+    std::vector<std::size_t> indices;
+    std::vector<double> group_prices;
+    const Model_Type models[2] = {Model_Type::European, Model_Type::AmericanPerpetual};
+    const Option_Type optiontypes[2] = {Option_Type::Call, Option_Type::Put};
+    for(const Model_Type& model: models)
+    {
+        for(const Option_Type& optiontype: optiontypes)
+        {
+            indices.clear();
+            for(std::size_t i = 0; i < batch.size(); i++)
+            {
+                if(batch[i].m_model == model && batch[i].m_optiontype == optiontype){indices.push_back(i);}
+            }
+            if(indices.empty()){continue;}
+
+            columns.resize(indices.size());
+            for(std::size_t j = 0; j < indices.size(); j++)
+            {
+                const Request& r = batch[indices[j]];
+                columns.S[j] = r.m_S; columns.K[j] = r.m_K; columns.T[j] = r.m_T; columns.R[j] = r.m_R; columns.Sig[j] = r.m_Sig; columns.B[j] = r.m_B;
+            }
+            if(model == Model_Type::European)
+            {
+                group_prices.resize(indices.size());
+                Price_BS_Batch_Dispatch(optiontype, indices.size(), columns.S.data(), columns.K.data(), columns.T.data(), columns.R.data(), columns.Sig.data(),
+                    columns.B.data(), group_prices.data());
+            }
+            else
+            {
+                AmericanPerp_Kernel<double>::Price_Batch(optiontype, columns, group_prices);
+            }
+            for(std::size_t j = 0; j < indices.size(); j++){prices[indices[j]] = group_prices[j];}
+        }
+    }
+
+    // Replies are grouped per connection, so that each connection receives one write per batch
+    std::map<Connection*, std::string> replies;
+    char number[64];
+    for(std::size_t i = 0; i < batch.size(); i++)
+    {
+        std::snprintf(number, sizeof(number), " %.17g\n", prices[i]);
+        std::string& reply = replies[batch[i].m_connection.get()];
+        reply += batch[i].m_id;
+        reply += number;
+    }
+    for(std::size_t i = 0; i < batch.size(); i++)
+    {
+        std::map<Connection*, std::string>::iterator it = replies.find(batch[i].m_connection.get());
+        if(it != replies.end())
+        {
+            it->first->Write(it->second);
+            replies.erase(it);
+        }
+    }
+
+    Record_Latencies(batch, std::chrono::steady_clock::now());
+
+    m_request_count += batch.size();
+    m_batch_count += 1;
+    std::uint64_t previous = m_max_batch_seen;
+    while(batch.size() > previous && !m_max_batch_seen.compare_exchange_weak(previous, batch.size())){}
+}
+
+bool PricingServer::Parse_Request(const std::string& line, Request& request) const
+{
+    const char* p = line.c_str();
+    const char* space = std::strchr(p, ' ');
+    if(space == nullptr || space == p){return false;}
+    request.m_id.assign(p, space);
+    p = space + 1;
+
+    // Model and option type
+    if(p[0] != 'E' && p[0] != 'A'){return false;}
+    request.m_model = (p[0] == 'E') ? Model_Type::European : Model_Type::AmericanPerpetual;
+    if(p[1] != ' ' || (p[2] != 'C' && p[2] != 'P')){return false;}
+    request.m_optiontype = (p[2] == 'C') ? Option_Type::Call : Option_Type::Put;
+    p += 3;
+
+    double* fields[6] = {&request.m_S, &request.m_K, &request.m_T, &request.m_R, &request.m_Sig, &request.m_B};
+    for(int f = 0; f < 6; f++)
+    {
+        char* next = nullptr;
+        *fields[f] = std::strtod(p, &next);
+        if(next == p){return false;}
+        p = next;
+    }
+    return true;
+}
+
+void PricingServer::Record_Latencies(const std::vector<Request>& batch, const std::chrono::steady_clock::time_point& done)
+{
+    std::lock_guard<std::mutex> lock(m_latency_mutex);     // One lock per batch rather than per request
+    for(std::size_t i = 0; i < batch.size(); i++)
+    {
+        std::uint64_t us = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(done - batch[i].m_arrival).count());
+        std::size_t bucket = (us < Micro_Buckets) ? static_cast<std::size_t>(us) : Micro_Buckets + static_cast<std::size_t>(us / 1000) - 1;
+        if(bucket >= m_latency_histogram.size()){bucket = m_latency_histogram.size() - 1;}
+        m_latency_histogram[bucket]++;
+    }
+}
@@ -0,0 +1,118 @@
+//PricingServer.hpp
+//
+//Purpose: Standalone pricing service. Clients connect through a Unix domain socket or a local TCP port, and send one pricing request per line:
+//
+//              <request id> <E|A> <C|P> S K T R Sig B
+//
+//         with E for the European Black-Scholes engine and A for the perpetual American formulae (T is then ignored). The server answers "<request id> <price>", or
+//         "<request id> ERR <reason>", and a line "STATS" is answered with the latency and batch-size statistics. Requests from every connection are coalesced
+//         into micro-batches within a configurable time window, and the batches are priced on a thread pool, by the batch kernels of each model and option type.
+//         Replies are written as soon as their batch is done, so that they may come back in a different order than the requests. A line longer than Max_Line
+//         is answered with "ERR request line too long", and its connection closed.
+//
+//Modification date: 10/18/2026
+
+#ifndef PricingServer_hpp
+#define PricingServer_hpp
+
+#include "OptionData.hpp"
+#include <string>
+#include <vector>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+
+// Latency and batch-size statistics of the server. Latencies are measured from the arrival of a request to the writing of its reply, in microseconds.
+struct Server_Statistics
+{
+    std::uint64_t m_requests;       // Number of requests priced
+    std::uint64_t m_batches;        // Number of micro-batches
+    std::uint64_t m_max_batch;      // Largest micro-batch
+    double m_mean_batch;            // Average micro-batch size
+    double m_p50_us, m_p99_us, m_p999_us, m_max_us;     // Latency percentiles and maximum, in microseconds
+
+    std::string ToString() const;   // One line summary
+};
+
+class PricingServer
+{
+    public:
+        static const std::size_t Max_Line = 4096;      // Longest request line buffered, in bytes
+
+    private:
+        struct Connection;          // Socket of a client, with the mutex serializing the replies written to it
+
+        struct Request              // Pricing request waiting in the queue
+        {
+            std::shared_ptr<Connection> m_connection;
+            std::string m_id;                   // Request ID, echoed in the reply
+            Model_Type m_model;
+            Option_Type m_optiontype;
+            double m_S, m_K, m_T, m_R, m_Sig, m_B;
+            std::chrono::steady_clock::time_point m_arrival;
+        };
+
+        std::string m_address;                  // "unix:<path>" or "tcp:<port>" (bound to 127.0.0.1)
+        std::chrono::microseconds m_window;     // Time window over which requests are coalesced into one batch
+        std::size_t m_max_batch;                // Maximum size of a batch, which is dispatched as soon as it is reached
+        unsigned m_threads;                     // Number of pricing threads
+
+        int m_listen_fd;
+        std::atomic<bool> m_running;
+
+        std::mutex m_queue_mutex;               // Requests waiting to be batched
+        std::condition_variable m_queue_cv;
+        std::deque<Request> m_queue;
+
+        std::mutex m_pool_mutex;                // Batches waiting for a pricing thread
+        std::condition_variable m_pool_cv;
+        std::deque<std::vector<Request>> m_batches;
+
+        std::mutex m_connections_mutex;
+        std::condition_variable m_readers_cv;                   // Signaled when a reader thread returns
+        std::list<std::shared_ptr<Connection>> m_connections;   // Open connections, each holding its reader thread
+        std::vector<std::thread> m_finished_readers;            // Reader threads that returned, joined by the next one to return or by Stop()
+
+        std::thread m_acceptor;                 // Accepts connections, and starts one reader thread per connection, which reaps its connection when the client leaves
+        std::thread m_batcher;                  // Coalesces requests into batches
+        std::vector<std::thread> m_workers;     // Pricing threads
+
+        // Statistics
+        std::atomic<std::uint64_t> m_request_count, m_batch_count, m_max_batch_seen;
+        std::mutex m_latency_mutex;
+        std::vector<std::uint64_t> m_latency_histogram;    // Buckets of 1us up to 1ms, then of 1ms up to 1s
+
+        void Accept_Loop();
+        void Read_Loop(std::shared_ptr<Connection> connection);
+        void Batch_Loop();
+        void Worker_Loop();
+        void Price_Batch(std::vector<Request>& batch);         // Prices a batch by groups of model and option type, and writes the replies
+        bool Parse_Request(const std::string& line, Request& request) const;
+        void Record_Latencies(const std::vector<Request>& batch, const std::chrono::steady_clock::time_point& done);    // Adds the latencies of a batch to the histogram
+
+    public:
+    //CONSTRUCTORS AND DESTRUCTOR
+
+        PricingServer(const std::string& address, const std::chrono::microseconds& window, const std::size_t& max_batch, const unsigned& threads);
+        PricingServer(const PricingServer& source) = delete;               // A server owns its sockets and threads, it cannot be copied
+        PricingServer& operator = (const PricingServer& source) = delete;
+        ~PricingServer();                                                   // Destructor, which stops the server
+
+    //SERVER FUNCTIONS
+
+        void Start();                           // Binds the socket and starts the threads. Throws std::runtime_error if the socket cannot be bound.
+        void Stop();                            // Stops accepting requests, closes connections and joins every thread
+        bool isRunning() const;
+        Server_Statistics Statistics();         // Snapshot of the statistics
+
+        static int Connect(const std::string& address);     // Client side: opens a connection to a server at the address provided, -1 on failure
+};
+
+#endif //PricingServer_hpp
@@ -0,0 +1,51 @@
+//PricingServerMain.cpp
+//
+//Purpose: Pricing daemon. Starts a PricingServer and runs until SIGINT or SIGTERM, then prints the latency and batch-size statistics.
+//
+//         Usage: pricing_server [address] [window in us] [max batch] [threads]
+//         Defaults: unix:/tmp/option_pricing.sock, 200us, 4096 requests, hardware threads
+//
+//Modification date: 10/18/2026
+
+
+#include "PricingServer.hpp"
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <pthread.h>
+
+
+int main(int argc, char* argv[])
+{
+    std::string address = (argc > 1) ? argv[1] : "unix:/tmp/option_pricing.sock";
+    long window_us = (argc > 2) ? std::atol(argv[2]) : 200;
+    long max_batch = (argc > 3) ? std::atol(argv[3]) : 4096;
+    unsigned threads = (argc > 4) ? static_cast<unsigned>(std::atol(argv[4])) : std::thread::hardware_concurrency();
+
+    // Blocking the termination signals before starting the threads, so that only the main thread receives them in sigwait()
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+    PricingServer server(address, std::chrono::microseconds(window_us), static_cast<std::size_t>(max_batch), threads);
+    try
+    {
+        server.Start();
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    std::cout << "Pricing server listening on " << address << " (window: " << window_us << "us, max batch: " << max_batch << ", threads: " << threads << ")" << std::endl;
+
+    int received = 0;
+    sigwait(&signals, &received);
+
+    server.Stop();
+    std::cout << server.Statistics().ToString() << std::endl;
+    return 0;
+}
@@ -0,0 +1,161 @@
+//ReferenceKernels.hpp
+//
+//Purpose: Slow, high-precision reference values of the Black-Scholes prices and Greeks, of the perpetual American options and of the inverse normal CDF, against
+//         which PrecisionValidation measures the fast kernels of PricingKernels.hpp (scalar, per-ISA batches, float, divided differences). The formulas are
+//         templated on the scalar type and written for accuracy rather than speed: N() always goes through erfc() of a non-negative argument, so that neither
+//         tail loses digits, prices are formed as discounted forward values, and the inverse normal is solved by Newton iterations to the full precision of the
+//         type. Mathematical functions are called unqualified, after using-declarations of std, so that a multiprecision type providing exp(), log(), sqrt(),
+//         erf(), erfc() and pow() by argument-dependent lookup can be used. The default is long double (64-bit mantissa on x86, 11 bits more than double),
+//         which resolves errors of double results to a small fraction of their ULP, except for prices far out of the money, where the two terms of the formula
+//         cancel and the reference itself can be off by about one ULP of double (still far below the errors of the fast kernels there).
+//
+//Modification date: 10/18/2026
+
+#ifndef ReferenceKernels_hpp
+#define ReferenceKernels_hpp
+
+#include <cmath>
+#include <limits>
+
+template<typename Real = long double>
+class Reference_Kernel
+{
+public:
+    static Real N(const Real& x)    // CDF of the normal distribution, from erfc() of the non-negative argument |x|/sqrt(2) in both tails
+    {
+        using std::erfc; using std::sqrt;
+        const Real z = x / sqrt(Real(2));
+        return (x < Real(0)) ? Real(0.5)*erfc(-z) : Real(1) - Real(0.5)*erfc(z);
+    }
+
+    static Real n(const Real& x)    // PDF of the normal distribution
+    {
+        using std::exp; using std::sqrt; using std::acos;
+        return exp(-x*x/Real(2)) / sqrt(Real(2)*acos(Real(-1)));
+    }
+
+    // Inverse of N() for p in (0,1), by Newton iterations until the step stops decreasing, on the smaller of p and 1-p: start approximates the (non-positive)
+    // inverse of that smaller value, e.g. from the double kernel. Near p = 1/2, the residual is formed from erf() and 1/2 - p, which are exact to relative
+    // precision, so that x keeps its relative precision as it goes to 0.
+    static Real Inverse_N(const Real& p, const double& start)
+    {
+        using std::fabs; using std::erf; using std::sqrt;
+        const bool upper = (p > Real(0.5));
+        const Real p_tail = upper ? Real(1) - p : p;
+        Real x = Real(start);
+        Real previous_step = std::numeric_limits<Real>::max();
+        for(int i = 0; i < 100; i++)
+        {
+            const Real residual = (p_tail > Real(0.25)) ? (Real(0.5) - p_tail) - Real(0.5)*erf(-x/sqrt(Real(2))) : N(x) - p_tail;
+            const Real step = residual / n(x);
+            if(!(fabs(step) < previous_step)){break;}
+            x -= step;
+            previous_step = fabs(step);
+        }
+        return upper ? -x : x;
+    }
+
+    static Real D1(const Real& S, const Real& K, const Real& T, const Real& Sig, const Real& B)
+    {
+        using std::log; using std::sqrt;
+        return (log(S/K) + (B + Sig*Sig/Real(2))*T) / (Sig*sqrt(T));
+    }
+
+    static Real Call_Price(const Real& S, const Real& K, const Real& T, const Real& R, const Real& Sig, const Real& B)
+    {
+        using std::exp; using std::sqrt;
+        const Real d1 = D1(S, K, T, Sig, B), d2 = d1 - Sig*sqrt(T);
+        return S*exp((B-R)*T)*N(d1) - K*exp(-R*T)*N(d2);
+    }
+
+    static Real Put_Price(const Real& S, const Real& K, const Real& T, const Real& R, const Real& Sig, const Real& B)
+    {
+        using std::exp; using std::sqrt;
+        const Real d1 = D1(S, K, T, Sig, B), d2 = d1 - Sig*sqrt(T);
+        return K*exp(-R*T)*N(-d2) - S*exp((B-R)*T)*N(-d1);
+    }
+
+    // C - P = S*exp((B-R)T) - K*exp(-RT), the exact value of put-call parity
+    static Real Parity(const Real& S, const Real& K, const Real& T, const Real& R, const Real& B)
+    {
+        using std::exp;
+        return S*exp((B-R)*T) - K*exp(-R*T);
+    }
+
+    static Real Call_Delta(const Real& S, const Real& K, const Real& T, const Real& R, const Real& Sig, const Real& B)
+    {
+        using std::exp;
+        return exp((B-R)*T)*N(D1(S, K, T, Sig, B));
+    }
+
+    static Real Put_Delta(const Real& S, const Real& K, const Real& T, const Real& R, const Real& Sig, const Real& B)
+    {
+        using std::exp;
+        return -exp((B-R)*T)*N(-D1(S, K, T, Sig, B));
+    }
+
+    static Real Gamma(const Real& S, const Real& K, const Real& T, const Real& R, const Real& Sig, const Real& B)
+    {
+        using std::exp; using std::sqrt;
+        return exp((B-R)*T)*n(D1(S, K, T, Sig, B)) / (S*Sig*sqrt(T));
+    }
+
+    static Real Vega(const Real& S, const Real& K, const Real& T, const Real& R, const Real& Sig, const Real& B)
+    {
+        using std::exp; using std::sqrt;
+        return S*exp((B-R)*T)*n(D1(S, K, T, Sig, B))*sqrt(T);
+    }
+
+    // Thetas = -dV/dT
+    static Real Call_Theta(const Real& S, const Real& K, const Real& T, const Real& R, const Real& Sig, const Real& B)
+    {
+        using std::exp; using std::sqrt;
+        const Real d1 = D1(S, K, T, Sig, B), d2 = d1 - Sig*sqrt(T), carry = exp((B-R)*T);
+        return -S*carry*n(d1)*Sig/(Real(2)*sqrt(T)) - (B-R)*S*carry*N(d1) - R*K*exp(-R*T)*N(d2);
+    }
+
+    static Real Put_Theta(const Real& S, const Real& K, const Real& T, const Real& R, const Real& Sig, const Real& B)
+    {
+        using std::exp; using std::sqrt;
+        const Real d1 = D1(S, K, T, Sig, B), d2 = d1 - Sig*sqrt(T), carry = exp((B-R)*T);
+        return -S*carry*n(d1)*Sig/(Real(2)*sqrt(T)) + (B-R)*S*carry*N(-d1) + R*K*exp(-R*T)*N(-d2);
+    }
+
+    // Perpetual American options: y1 > 1 (call, B < R) and y2 < 0 (put, R > 0) are the roots of Sig^2/2 y(y-1) + B y - R = 0, and the options are exercised
+    // at once beyond the boundaries K*y1/(y1-1) (call) and K*y2/(y2-1) (put). Outside these conditions on B and R, NaN is returned.
+    static Real Call_Perpetual_Boundary(const Real& K, const Real& R, const Real& Sig, const Real& B)
+    {
+        using std::sqrt;
+        if(!(B < R)){return std::numeric_limits<Real>::quiet_NaN();}
+        const Real a = B/(Sig*Sig) - Real(0.5), y1 = -a + sqrt(a*a + Real(2)*R/(Sig*Sig));
+        return K*y1/(y1 - Real(1));
+    }
+
+    static Real Put_Perpetual_Boundary(const Real& K, const Real& R, const Real& Sig, const Real& B)
+    {
+        using std::sqrt;
+        if(!(R > Real(0))){return std::numeric_limits<Real>::quiet_NaN();}
+        const Real a = B/(Sig*Sig) - Real(0.5), y2 = -a - sqrt(a*a + Real(2)*R/(Sig*Sig));
+        return K*y2/(y2 - Real(1));
+    }
+
+    static Real Call_Perpetual(const Real& S, const Real& K, const Real& R, const Real& Sig, const Real& B)
+    {
+        using std::sqrt; using std::pow;
+        if(!(B < R)){return std::numeric_limits<Real>::quiet_NaN();}
+        const Real a = B/(Sig*Sig) - Real(0.5), y1 = -a + sqrt(a*a + Real(2)*R/(Sig*Sig));
+        if(S >= Call_Perpetual_Boundary(K, R, Sig, B)){return S - K;}
+        return K/(y1 - Real(1))*pow((y1 - Real(1))/y1*S/K, y1);
+    }
+
+    static Real Put_Perpetual(const Real& S, const Real& K, const Real& R, const Real& Sig, const Real& B)
+    {
+        using std::sqrt; using std::pow;
+        if(!(R > Real(0))){return std::numeric_limits<Real>::quiet_NaN();}
+        const Real a = B/(Sig*Sig) - Real(0.5), y2 = -a - sqrt(a*a + Real(2)*R/(Sig*Sig));
+        if(S <= Put_Perpetual_Boundary(K, R, Sig, B)){return K - S;}
+        return K/(Real(1) - y2)*pow((y2 - Real(1))/y2*S/K, y2);
+    }
+};
+
+#endif //ReferenceKernels_hpp
@@ -0,0 +1,237 @@
+//ReportFormatter.cpp
+//
+//Purpose: Formatted output without iostreams: ReportBuffer formats text and numbers with std::to_chars into a reusable character buffer, and writes it to its
+//         sink (an output stream) by large blocks, only when the buffer passes its flush threshold at the end of a line or when Flush() is called, rather than
+//         once per value or per std::endl. Numbers are formatted as streams format them by default (6 significant digits, as %g), so that human-readable
+//         reports are unchanged; the bulk CSV and JSON writers use the shortest representation that reads back to the same double. Reports of a whole book
+//         are built by appending every option to one buffer (see EuropeanOption::ToString(ReportBuffer&)), which keeps its capacity from one report to the next.
+//
+//Modification date: 10/18/2026
+
+
+#include "ReportFormatter.hpp"
+#include <charconv>     // For std::to_chars
+#include <cmath>        // For std::isfinite
+#include <stdexcept>
+
+
+//Default constructor
+ReportBuffer::ReportBuffer(): m_buffer(), m_sink(nullptr), m_flush_bytes(64 * 1024), m_precision(6)
+{
+    //std::cout << "Default constructor in ReportBuffer used." << std::endl;
+}
+
+//Overloaded constructor
+ReportBuffer::ReportBuffer(std::ostream& sink, const std::size_t& flush_bytes, const int& precision): m_buffer(), m_sink(&sink), m_flush_bytes(flush_bytes),
+    m_precision(precision)
+{
+    if(precision < 0){throw std::invalid_argument("Error: Report precision cannot be negative.");}
+    m_buffer.reserve(flush_bytes + 256);     // One line past the threshold fits without reallocation
+    //std::cout << "Overloaded constructor in ReportBuffer used." << std::endl;
+}
+
+//Destructor
+ReportBuffer::~ReportBuffer()
+{
+    if(m_sink != nullptr && !m_buffer.empty()){m_sink->write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));}
+    //std::cout << "Destructor in ReportBuffer used." << std::endl;
+}
+
+
+//FORMATTING
+
+ReportBuffer& ReportBuffer::operator << (const char* text)
+{
+    m_buffer += text;
+    return *this;
+}
+
+ReportBuffer& ReportBuffer::operator << (const std::string& text)
+{
+    m_buffer += text;
+    return *this;
+}
+
+ReportBuffer& ReportBuffer::operator << (const char& character)
+{
+    m_buffer += character;
+    return *this;
+}
+
+ReportBuffer& ReportBuffer::operator << (const double& value)
+{
+    return Number(value, m_precision);
+}
+
+ReportBuffer& ReportBuffer::operator << (const int& value)
+{
+    Integer(value);
+    return *this;
+}
+
+ReportBuffer& ReportBuffer::operator << (const long& value)
+{
+    Integer(value);
+    return *this;
+}
+
+ReportBuffer& ReportBuffer::operator << (const long long& value)
+{
+    Integer(value);
+    return *this;
+}
+
+ReportBuffer& ReportBuffer::operator << (const unsigned& value)
+{
+    Unsigned(value);
+    return *this;
+}
+
+ReportBuffer& ReportBuffer::operator << (const unsigned long& value)
+{
+    Unsigned(value);
+    return *this;
+}
+
+ReportBuffer& ReportBuffer::operator << (const unsigned long long& value)
+{
+    Unsigned(value);
+    return *this;
+}
+
+void ReportBuffer::Integer(const long long& value)
+{
+    char digits[24];
+    const std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value);
+    m_buffer.append(digits, result.ptr);
+}
+
+void ReportBuffer::Unsigned(const unsigned long long& value)
+{
+    char digits[24];
+    const std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value);
+    m_buffer.append(digits, result.ptr);
+}
+
+ReportBuffer& ReportBuffer::Number(const double& value, const int& precision)
+{
+    char digits[64];    // Enough for any double in general format up to 40 significant digits
+    const std::to_chars_result result = (precision > 0) ? std::to_chars(digits, digits + sizeof(digits), value, std::chars_format::general, (precision < 40) ? precision : 40)
+                                                        : std::to_chars(digits, digits + sizeof(digits), value);
+    m_buffer.append(digits, result.ptr);
+    return *this;
+}
+
+void ReportBuffer::End_Line()
+{
+    m_buffer += '\n';
+    if(m_sink != nullptr && m_buffer.size() >= m_flush_bytes){Flush();}
+}
+
+
+//BULK REPORTS
+
+void ReportBuffer::Text(const std::string& label, const std::vector<double>& mesh, const std::vector<double>& results)
+{
+    if(mesh.size() != results.size()){throw std::invalid_argument("Error: Mesh and results are not of the same size.");}
+    for(std::size_t i = 0; i < mesh.size(); i++)
+    {
+        m_buffer += label;
+        m_buffer += " at: ";
+        Number(mesh[i], m_precision);
+        m_buffer += " = ";
+        Number(results[i], m_precision);
+        End_Line();
+    }
+}
+
+void ReportBuffer::CSV(const std::vector<std::string>& names, const std::vector<std::vector<double>>& columns)
+{
+    if(names.size() != columns.size()){throw std::invalid_argument("Error: One name is needed per column.");}
+    const std::size_t rows = columns.empty() ? 0 : columns[0].size();
+    for(std::size_t c = 0; c < columns.size(); c++)
+    {
+        if(columns[c].size() != rows){throw std::invalid_argument("Error: Column " + names[c] + " is not of the size of the others.");}
+        if(c > 0){m_buffer += ',';}
+        m_buffer += names[c];
+    }
+    End_Line();
+    for(std::size_t i = 0; i < rows; i++)
+    {
+        for(std::size_t c = 0; c < columns.size(); c++)
+        {
+            if(c > 0){m_buffer += ',';}
+            Number(columns[c][i], 0);
+        }
+        End_Line();
+    }
+}
+
+void ReportBuffer::JSON(const std::vector<std::string>& names, const std::vector<std::vector<double>>& columns)
+{
+    if(names.size() != columns.size()){throw std::invalid_argument("Error: One name is needed per column.");}
+    const std::size_t rows = columns.empty() ? 0 : columns[0].size();
+    for(std::size_t c = 0; c < columns.size(); c++)
+    {
+        if(columns[c].size() != rows){throw std::invalid_argument("Error: Column " + names[c] + " is not of the size of the others.");}
+    }
+
+    // Keys are formatted once, as "name": with their separators
+    std::vector<std::string> keys(columns.size());
+    for(std::size_t c = 0; c < columns.size(); c++)
+    {
+        keys[c] = (c > 0) ? ", \"" : "{\"";
+        for(std::size_t j = 0; j < names[c].size(); j++)
+        {
+            if(names[c][j] == '"' || names[c][j] == '\\'){keys[c] += '\\';}
+            keys[c] += names[c][j];
+        }
+        keys[c] += "\": ";
+    }
+
+    m_buffer += '[';
+    End_Line();
+    for(std::size_t i = 0; i < rows; i++)
+    {
+        for(std::size_t c = 0; c < columns.size(); c++)
+        {
+            m_buffer += keys[c];
+            if(std::isfinite(columns[c][i])){Number(columns[c][i], 0);}
+            else{m_buffer += "null";}
+        }
+        m_buffer += columns.empty() ? "{}" : "}";
+        if(i + 1 < rows){m_buffer += ',';}
+        End_Line();
+    }
+    m_buffer += ']';
+    End_Line();
+}
+
+
+//OUTPUT
+
+void ReportBuffer::Flush(const bool& sync)
+{
+    if(m_sink == nullptr){return;}
+    if(!m_buffer.empty())
+    {
+        m_sink->write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+        m_buffer.clear();
+    }
+    if(sync){m_sink->flush();}
+}
+
+std::string const& ReportBuffer::str() const
+{
+    return m_buffer;
+}
+
+void ReportBuffer::clear()
+{
+    m_buffer.clear();
+}
+
+std::size_t ReportBuffer::size() const
+{
+    return m_buffer.size();
+}
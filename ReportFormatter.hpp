@@ -0,0 +1,74 @@
+//ReportFormatter.hpp
+//
+//Purpose: Formatted output without iostreams: ReportBuffer formats text and numbers with std::to_chars into a reusable character buffer, and writes it to its
+//         sink (an output stream) by large blocks, only when the buffer passes its flush threshold at the end of a line or when Flush() is called, rather than
+//         once per value or per std::endl. Numbers are formatted as streams format them by default (6 significant digits, as %g), so that human-readable
+//         reports are unchanged; the bulk CSV and JSON writers use the shortest representation that reads back to the same double. Reports of a whole book
+//         are built by appending every option to one buffer (see EuropeanOption::ToString(ReportBuffer&)), which keeps its capacity from one report to the next.
+//
+//Modification date: 10/18/2026
+
+#ifndef ReportFormatter_hpp
+#define ReportFormatter_hpp
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <cstddef>
+
+class ReportBuffer
+{
+    private:
+        std::string m_buffer;               // Formatted characters not yet written to the sink
+        std::ostream* m_sink;               // Output stream, or nullptr for a buffer read with str()
+        std::size_t m_flush_bytes;          // Size past which the buffer is written to the sink at the end of a line
+        int m_precision;                    // Significant digits of the numbers written with <<, 0 for the shortest round-trip representation
+
+        void Integer(const long long& value);
+        void Unsigned(const unsigned long long& value);
+
+    public:
+    //CONSTRUCTORS AND DESTRUCTOR
+
+        ReportBuffer();                                                     // Default constructor: no sink, 6 significant digits
+        ReportBuffer(std::ostream& sink, const std::size_t& flush_bytes = 64 * 1024, const int& precision = 6);     // Overloaded constructor
+        ReportBuffer(const ReportBuffer& source) = delete;                  // Not copyable, as two buffers would interleave their output to the sink
+        ReportBuffer& operator = (const ReportBuffer& source) = delete;
+        ~ReportBuffer();                                                    // Destructor, writes what remains to the sink (without flushing the sink)
+
+    //FORMATTING
+
+        ReportBuffer& operator << (const char* text);
+        ReportBuffer& operator << (const std::string& text);
+        ReportBuffer& operator << (const char& character);
+        ReportBuffer& operator << (const double& value);                    // With the precision of the buffer
+        ReportBuffer& operator << (const int& value);
+        ReportBuffer& operator << (const long& value);
+        ReportBuffer& operator << (const long long& value);
+        ReportBuffer& operator << (const unsigned& value);
+        ReportBuffer& operator << (const unsigned long& value);
+        ReportBuffer& operator << (const unsigned long long& value);
+
+        ReportBuffer& Number(const double& value, const int& precision);    // With the precision given, 0 for the shortest round-trip representation
+        void End_Line();                    // Newline, then writes the buffer to the sink if past the flush threshold. Unlike std::endl, does not flush the sink.
+
+    //BULK REPORTS
+
+        // One "label at: mesh = result" line per mesh point, as Print_Vector()
+        void Text(const std::string& label, const std::vector<double>& mesh, const std::vector<double>& results);
+
+        // Header line of names, then one line per row of the columns (all of the same size), numbers in shortest round-trip form, non-finite as nan or inf
+        void CSV(const std::vector<std::string>& names, const std::vector<std::vector<double>>& columns);
+
+        // Array of one object per row, {"name": value, ...}, numbers in shortest round-trip form, non-finite as null
+        void JSON(const std::vector<std::string>& names, const std::vector<std::vector<double>>& columns);
+
+    //OUTPUT
+
+        void Flush(const bool& sync = false);   // Writes the buffer to the sink, and with sync also flushes the sink
+        std::string const& str() const;         // Characters not yet written to a sink
+        void clear();                           // Empties the buffer, keeping its capacity
+        std::size_t size() const;
+};
+
+#endif //ReportFormatter_hpp
@@ -0,0 +1,430 @@
+//ResultCache.cpp
+//
+//Purpose: Persistent, content-addressed cache of pricing results, so that overnight jobs repricing the same Matrix grids get their results back instantly,
+//         including across process restarts. The key is a 64-bit FNV-1a hash of the parameter data of the matrix, its mesh, its Param_Type and Base_Type, the option
+//         and exercise types, and the ID and version of the engine: bumping the version of an engine invalidates its entries. As FNV-1a is not collision-resistant,
+//         the key also holds a second, independent 64-bit hash of the same data and the numbers of rows and mesh points, which are stored in the slot and compared
+//         on lookup, so that two grids whose FNV-1a hashes collide are told apart rather than served each other's results. Results are stored in a memory-mapped
+//         file of fixed size, made of a header, an open-addressing table of slots, and a data area of doubles. When the data area or the table is full, the least
+//         recently used entries are evicted and the data area is compacted. Lookups hold a shared lock and inserts an exclusive one, both within the process
+//         (std::shared_mutex) and across processes (flock), so that any number of readers can share the file with one writer at a time.
+//         Hit, miss, insertion and eviction counts are kept in the file header.
+//
+//Modification date: 10/18/2026
+
+
+#include "ResultCache.hpp"
+#include "Matrix.hpp"
+#include <sys/file.h>   // For flock()
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>    // For std::sort
+#include <cerrno>
+#include <cstring>      // For std::memcpy and std::memmove
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+
+
+// Header of the file. The counters and the LRU clock are updated with atomic operations under the shared lock, everything else under the exclusive lock.
+struct ResultCache::Header
+{
+    char m_magic[8];
+    std::uint64_t m_version;
+    std::uint64_t m_slot_count;
+    std::uint64_t m_capacity;       // Size of the data area, in doubles
+    std::uint64_t m_data_end;       // End of the allocated part of the data area, in doubles
+    std::uint64_t m_live;           // Doubles held by live entries (m_data_end minus the holes left by evictions)
+    std::uint64_t m_entries;
+    std::uint64_t m_clock;          // LRU clock, incremented on every hit and insertion
+    std::uint64_t m_hits;
+    std::uint64_t m_misses;
+    std::uint64_t m_insertions;
+    std::uint64_t m_evictions;
+};
+
+// Slot of the table. A hash of 0 marks an empty slot, so hashes of 0 are mapped to 1.
+struct ResultCache::Slot
+{
+    Cache_Key m_key;
+    std::uint64_t m_offset;         // Offset of the results in the data area, in doubles
+    std::uint64_t m_count;          // Number of results
+    std::uint64_t m_last_used;      // Value of the LRU clock at the last hit or insertion
+};
+
+namespace
+{
+    const char Cache_Magic[8] = {'R','E','S','C','A','C','H','E'};
+    const std::uint64_t Cache_Version = 2;     // 2: slots hold the full Cache_Key
+
+    // Locks the file across processes for the lifetime of the object
+    class File_Lock
+    {
+        private:
+            int m_fd;
+        public:
+            File_Lock(const int& fd, const int& operation): m_fd(fd)
+            {
+                while(::flock(m_fd, operation) != 0)
+                {
+                    if(errno != EINTR){throw std::runtime_error("Error: flock() failed on the result cache.");}
+                }
+            }
+            ~File_Lock(){::flock(m_fd, LOCK_UN);}
+            File_Lock(const File_Lock&) = delete;
+            File_Lock& operator = (const File_Lock&) = delete;
+    };
+
+    std::uint64_t Atomic_Load(const std::uint64_t& value){return __atomic_load_n(&value, __ATOMIC_RELAXED);}
+    void Atomic_Add(std::uint64_t& value, const std::uint64_t& increment){__atomic_fetch_add(&value, increment, __ATOMIC_RELAXED);}
+}
+
+
+//Overloaded constructor
+ResultCache::ResultCache(const std::string& path, const std::size_t& capacity_bytes, const std::size_t& slots)
+: m_path(path), m_fd(-1), m_map(nullptr), m_map_size(0)
+{
+    if(slots == 0 || capacity_bytes < sizeof(double)){throw std::invalid_argument("Error: Result cache needs at least one slot and one result of capacity.");}
+
+    m_fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if(m_fd < 0){throw std::invalid_argument("Error: Cannot open result cache " + path + ".");}
+
+    try
+    {
+        File_Lock lock(m_fd, LOCK_EX);     // Only one process creates the file
+        struct stat status;
+        if(::fstat(m_fd, &status) != 0){throw std::runtime_error("Error: fstat() failed on result cache " + path + ".");}
+
+        if(status.st_size == 0)     // New file: sizing it and writing an empty header
+        {
+            Header header = {};
+            std::memcpy(header.m_magic, Cache_Magic, sizeof(Cache_Magic));
+            header.m_version = Cache_Version;
+            header.m_slot_count = slots;
+            header.m_capacity = capacity_bytes / sizeof(double);
+            m_map_size = sizeof(Header) + slots * sizeof(Slot) + header.m_capacity * sizeof(double);
+            if(::ftruncate(m_fd, static_cast<off_t>(m_map_size)) != 0 || ::pwrite(m_fd, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header)))
+            {
+                throw std::runtime_error("Error: Cannot size result cache " + path + ".");
+            }
+        }
+        else    // Existing file: checking its header and keeping its sizes
+        {
+            Header header;
+            if(::pread(m_fd, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header)) || std::memcmp(header.m_magic, Cache_Magic, sizeof(Cache_Magic)) != 0
+                || header.m_version != Cache_Version || header.m_slot_count == 0)
+            {
+                throw std::invalid_argument("Error: " + path + " is not a result cache of this version.");
+            }
+            m_map_size = sizeof(Header) + header.m_slot_count * sizeof(Slot) + header.m_capacity * sizeof(double);
+            if(static_cast<std::size_t>(status.st_size) != m_map_size){throw std::invalid_argument("Error: Result cache " + path + " is truncated.");}
+        }
+
+        void* map = ::mmap(nullptr, m_map_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+        if(map == MAP_FAILED){throw std::runtime_error("Error: Cannot map result cache " + path + ".");}
+        m_map = static_cast<unsigned char*>(map);
+    }
+    catch(...)
+    {
+        ::close(m_fd);
+        throw;
+    }
+}
+
+//Destructor
+ResultCache::~ResultCache()
+{
+    if(m_map != nullptr){::munmap(m_map, m_map_size);}
+    if(m_fd >= 0){::close(m_fd);}
+}
+
+
+ResultCache::Header* ResultCache::Get_Header() const
+{
+    return reinterpret_cast<Header*>(m_map);
+}
+
+ResultCache::Slot* ResultCache::Get_Slots() const
+{
+    return reinterpret_cast<Slot*>(m_map + sizeof(Header));
+}
+
+double* ResultCache::Get_Data() const
+{
+    return reinterpret_cast<double*>(m_map + sizeof(Header) + Get_Header()->m_slot_count * sizeof(Slot));
+}
+
+
+//KEYS
+
+std::uint64_t ResultCache::Hash(const void* data, const std::size_t& size, std::uint64_t hash)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for(std::size_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Multiply-rotate rounds over 64-bit words (as in xxHash64), then a final avalanche: unrelated to FNV-1a, so that data colliding under one hash does not
+// collide under the other but by chance. The tail of fewer than 8 bytes is zero-padded; the sizes hashed in Key() tell apart data differing only by padding.
+std::uint64_t ResultCache::Check_Hash(const void* data, const std::size_t& size, std::uint64_t hash)
+{
+    const std::uint64_t Prime_1 = 11400714785074694791ULL, Prime_2 = 14029467366897019727ULL;
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for(std::size_t i = 0; i < size; i += 8)
+    {
+        std::uint64_t word = 0;
+        std::memcpy(&word, bytes + i, (size - i < 8) ? size - i : 8);
+        hash += word * Prime_2;
+        hash = ((hash << 31) | (hash >> 33)) * Prime_1;
+    }
+    hash ^= hash >> 33;
+    hash *= Prime_2;
+    hash ^= hash >> 29;
+    return hash;
+}
+
+Cache_Key ResultCache::Key(const Matrix& matrix, const Option_Type& optiontype, const Exercise_Type& exercisetype, const std::string& engine_id,
+    const std::uint32_t& engine_version)
+{
+    // Sizes are hashed along with the data. The parameter blocks are trivially copyable and contiguous, so they are hashed as raw bytes in one pass.
+    const std::vector<Param_Data>& data = matrix.getMatrixData();
+    const std::vector<double>& mesh = matrix.getMesh();
+    std::int32_t types[4] = {static_cast<std::int32_t>(matrix.getParamType()), static_cast<std::int32_t>(matrix.getBaseType()), static_cast<std::int32_t>(optiontype),
+        static_cast<std::int32_t>(exercisetype)};
+
+    Cache_Key key;
+    key.m_rows = data.size();
+    key.m_points = mesh.size();
+
+    std::uint64_t hash = Hash(&key.m_rows, sizeof(key.m_rows));
+    hash = Hash(data.data(), data.size() * sizeof(Param_Data), hash);
+    hash = Hash(&key.m_points, sizeof(key.m_points), hash);
+    hash = Hash(mesh.data(), mesh.size() * sizeof(double), hash);
+    hash = Hash(types, sizeof(types), hash);
+    hash = Hash(engine_id.data(), engine_id.size(), hash);
+    hash = Hash(&engine_version, sizeof(engine_version), hash);
+    key.m_hash = (hash == 0) ? 1 : hash;
+
+    std::uint64_t check = Check_Hash(&key.m_rows, sizeof(key.m_rows));
+    check = Check_Hash(data.data(), data.size() * sizeof(Param_Data), check);
+    check = Check_Hash(&key.m_points, sizeof(key.m_points), check);
+    check = Check_Hash(mesh.data(), mesh.size() * sizeof(double), check);
+    check = Check_Hash(types, sizeof(types), check);
+    std::uint64_t id_size = engine_id.size();
+    check = Check_Hash(&id_size, sizeof(id_size), check);
+    check = Check_Hash(engine_id.data(), engine_id.size(), check);
+    key.m_check = Check_Hash(&engine_version, sizeof(engine_version), check);
+    return key;
+}
+
+bool Cache_Key::operator == (const Cache_Key& other) const
+{
+    return m_hash == other.m_hash && m_check == other.m_check && m_rows == other.m_rows && m_points == other.m_points;
+}
+
+
+//LOOKUPS AND UPDATES
+
+std::size_t ResultCache::Find(const Cache_Key& key) const
+{
+    const Slot* slots = Get_Slots();
+    const std::size_t count = Get_Header()->m_slot_count;
+    for(std::size_t i = key.m_hash % count, probes = 0; probes < count; i = (i + 1) % count, probes++)    // Linear probing, the table is never full
+    {
+        if(slots[i].m_key == key){return i;}    // The whole key: a collision of m_hash alone is not a hit
+        if(slots[i].m_key.m_hash == 0){return count;}
+    }
+    return count;
+}
+
+void ResultCache::Erase(std::size_t slot)
+{
+    Header* header = Get_Header();
+    Slot* slots = Get_Slots();
+    const std::size_t count = header->m_slot_count;
+
+    header->m_live -= slots[slot].m_count;
+    header->m_entries--;
+
+    // Backward-shift deletion: later slots of the probe sequence move into the hole if their home slot does not lie strictly after it
+    std::size_t next = slot;
+    while(true)
+    {
+        next = (next + 1) % count;
+        if(slots[next].m_key.m_hash == 0){break;}
+        std::size_t home = slots[next].m_key.m_hash % count;
+        bool movable = (slot <= next) ? (home <= slot || home > next) : (home <= slot && home > next);
+        if(movable)
+        {
+            slots[slot] = slots[next];
+            slot = next;
+        }
+    }
+    slots[slot] = Slot{{0, 0, 0, 0}, 0, 0, 0};
+}
+
+void ResultCache::Evict(const std::uint64_t& needed)
+{
+    Header* header = Get_Header();
+    Slot* slots = Get_Slots();
+    double* data = Get_Data();
+    const std::size_t count = header->m_slot_count;
+
+    // Evicting down to 3/4 of the data area and of the table, so that compaction is amortized over many insertions
+    const std::uint64_t max_live = header->m_capacity * 3 / 4, max_entries = count * 3 / 4;
+    std::vector<Slot> live;
+    live.reserve(header->m_entries);
+    for(std::size_t i = 0; i < count; i++)
+    {
+        if(slots[i].m_key.m_hash != 0){live.push_back(slots[i]);}
+    }
+    std::sort(live.begin(), live.end(), [](const Slot& a, const Slot& b){return a.m_last_used < b.m_last_used;});
+
+    for(std::size_t e = 0; e < live.size() && (header->m_live + needed > max_live || header->m_entries + 1 > max_entries); e++)
+    {
+        Erase(Find(live[e].m_key));
+        Atomic_Add(header->m_evictions, 1);
+    }
+
+    // Compaction: moving the remaining results down to the start of the data area, in order of offset so that moves never overwrite live results
+    std::vector<std::size_t> order;
+    for(std::size_t i = 0; i < count; i++)
+    {
+        if(slots[i].m_key.m_hash != 0){order.push_back(i);}
+    }
+    std::sort(order.begin(), order.end(), [&](const std::size_t& a, const std::size_t& b){return slots[a].m_offset < slots[b].m_offset;});
+    std::uint64_t end = 0;
+    for(std::size_t o = 0; o < order.size(); o++)
+    {
+        Slot& slot = slots[order[o]];
+        if(slot.m_offset != end){std::memmove(data + end, data + slot.m_offset, slot.m_count * sizeof(double));}
+        slot.m_offset = end;
+        end += slot.m_count;
+    }
+    header->m_data_end = end;
+}
+
+bool ResultCache::Lookup(const Cache_Key& key, std::vector<double>& results) const
+{
+    std::shared_lock<std::shared_mutex> guard(m_mutex);
+    File_Lock lock(m_fd, LOCK_SH);
+
+    Header* header = Get_Header();
+    std::size_t slot = Find(key);
+    if(slot == header->m_slot_count)
+    {
+        Atomic_Add(header->m_misses, 1);
+        return false;
+    }
+
+    Slot& entry = Get_Slots()[slot];
+    results.assign(Get_Data() + entry.m_offset, Get_Data() + entry.m_offset + entry.m_count);
+    __atomic_store_n(&entry.m_last_used, __atomic_add_fetch(&header->m_clock, 1, __ATOMIC_RELAXED), __ATOMIC_RELAXED);
+    Atomic_Add(header->m_hits, 1);
+    return true;
+}
+
+void ResultCache::Store(const Cache_Key& key, const std::vector<double>& results)
+{
+    std::unique_lock<std::shared_mutex> guard(m_mutex);
+    File_Lock lock(m_fd, LOCK_EX);
+
+    Header* header = Get_Header();
+    const std::uint64_t needed = results.size();
+    if(needed > header->m_capacity * 3 / 4){return;}     // Would not fit under the low-water mark of eviction
+
+    std::size_t slot = Find(key);
+    if(slot != header->m_slot_count)    // Stored meanwhile by another thread or process
+    {
+        Get_Slots()[slot].m_last_used = ++header->m_clock;
+        return;
+    }
+
+    if(header->m_data_end + needed > header->m_capacity || header->m_entries + 1 > header->m_slot_count * 3 / 4)
+    {
+        Evict(needed);
+    }
+
+    // Writing the results before the slot, so that a crash never leaves a slot pointing at partial results
+    std::memcpy(Get_Data() + header->m_data_end, results.data(), needed * sizeof(double));
+    Slot* slots = Get_Slots();
+    std::size_t i = key.m_hash % header->m_slot_count;
+    while(slots[i].m_key.m_hash != 0){i = (i + 1) % header->m_slot_count;}
+    slots[i].m_offset = header->m_data_end;
+    slots[i].m_count = needed;
+    slots[i].m_last_used = ++header->m_clock;
+    slots[i].m_key.m_check = key.m_check;
+    slots[i].m_key.m_rows = key.m_rows;
+    slots[i].m_key.m_points = key.m_points;
+    slots[i].m_key.m_hash = key.m_hash;     // Last, as a non-zero hash marks the slot as used
+
+    header->m_data_end += needed;
+    header->m_live += needed;
+    header->m_entries++;
+    header->m_insertions++;
+}
+
+std::vector<double> ResultCache::Get_Or_Compute(const Cache_Key& key, const std::function<std::vector<double>()>& compute)
+{
+    std::vector<double> results;
+    if(Lookup(key, results)){return results;}
+    results = compute();    // Computed without holding any lock
+    Store(key, results);
+    return results;
+}
+
+void ResultCache::Clear()
+{
+    std::unique_lock<std::shared_mutex> guard(m_mutex);
+    File_Lock lock(m_fd, LOCK_EX);
+
+    Header* header = Get_Header();
+    std::memset(static_cast<void*>(Get_Slots()), 0, header->m_slot_count * sizeof(Slot));
+    header->m_data_end = header->m_live = header->m_entries = header->m_clock = 0;
+    header->m_hits = header->m_misses = header->m_insertions = header->m_evictions = 0;
+}
+
+
+//GETTERS
+
+Cache_Statistics ResultCache::Statistics() const
+{
+    std::shared_lock<std::shared_mutex> guard(m_mutex);
+    File_Lock lock(m_fd, LOCK_SH);
+
+    const Header* header = Get_Header();
+    Cache_Statistics statistics;
+    statistics.m_hits = Atomic_Load(header->m_hits);
+    statistics.m_misses = Atomic_Load(header->m_misses);
+    statistics.m_insertions = header->m_insertions;
+    statistics.m_evictions = header->m_evictions;
+    statistics.m_entries = header->m_entries;
+    statistics.m_bytes_used = header->m_live * sizeof(double);
+    statistics.m_bytes_capacity = header->m_capacity * sizeof(double);
+    return statistics;
+}
+
+std::string const& ResultCache::getPath() const
+{
+    return m_path;
+}
+
+
+double Cache_Statistics::Hit_Rate() const
+{
+    return (m_hits + m_misses == 0) ? 0.0 : static_cast<double>(m_hits) / static_cast<double>(m_hits + m_misses);
+}
+
+std::string Cache_Statistics::ToString() const
+{
+    std::stringstream ss;
+    ss << "hits: " << m_hits << "; misses: " << m_misses << "; hit rate: " << Hit_Rate() << "; insertions: " << m_insertions << "; evictions: " << m_evictions
+       << "; entries: " << m_entries << "; bytes: " << m_bytes_used << "/" << m_bytes_capacity;
+    return ss.str();
+}
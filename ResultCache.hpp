@@ -0,0 +1,101 @@
+//ResultCache.hpp
+//
+//Purpose: Persistent, content-addressed cache of pricing results, so that overnight jobs repricing the same Matrix grids get their results back instantly,
+//         including across process restarts. The key is a 64-bit FNV-1a hash of the parameter data of the matrix, its mesh, its Param_Type and Base_Type, the option
+//         and exercise types, and the ID and version of the engine: bumping the version of an engine invalidates its entries. As FNV-1a is not collision-resistant,
+//         the key also holds a second, independent 64-bit hash of the same data and the numbers of rows and mesh points, which are stored in the slot and compared
+//         on lookup, so that two grids whose FNV-1a hashes collide are told apart rather than served each other's results. Results are stored in a memory-mapped
+//         file of fixed size, made of a header, an open-addressing table of slots, and a data area of doubles. When the data area or the table is full, the least
+//         recently used entries are evicted and the data area is compacted. Lookups hold a shared lock and inserts an exclusive one, both within the process
+//         (std::shared_mutex) and across processes (flock), so that any number of readers can share the file with one writer at a time.
+//         Hit, miss, insertion and eviction counts are kept in the file header.
+//
+//Modification date: 10/18/2026
+
+#ifndef ResultCache_hpp
+#define ResultCache_hpp
+
+#include "OptionData.hpp"
+#include <string>
+#include <vector>
+#include <functional>
+#include <shared_mutex>
+#include <cstdint>
+#include <cstddef>
+
+class Matrix;
+
+// Counters and occupancy of the cache. The counters are persistent, and shared by every process using the file.
+struct Cache_Statistics
+{
+    std::uint64_t m_hits;
+    std::uint64_t m_misses;
+    std::uint64_t m_insertions;
+    std::uint64_t m_evictions;
+    std::uint64_t m_entries;            // Number of results stored
+    std::uint64_t m_bytes_used;         // Bytes of the data area holding live results
+    std::uint64_t m_bytes_capacity;     // Size of the data area
+
+    double Hit_Rate() const;            // Hits over lookups, 0 if there was no lookup
+    std::string ToString() const;       // One line summary
+};
+
+// Key of a result. m_hash places the entry in the table; every field must match for a hit.
+struct Cache_Key
+{
+    std::uint64_t m_hash;               // FNV-1a hash, never 0 (a hash of 0 marks an empty slot)
+    std::uint64_t m_check;              // Independent hash of the same data (multiply-rotate over 64-bit words), to tell apart collisions of m_hash
+    std::uint64_t m_rows;               // Number of parameter rows of the matrix
+    std::uint64_t m_points;             // Number of mesh points
+
+    bool operator == (const Cache_Key& other) const;
+};
+
+class ResultCache
+{
+    private:
+        struct Header;                      // Layout of the file, defined in ResultCache.cpp
+        struct Slot;
+
+        std::string m_path;
+        int m_fd;                           // Descriptor of the cache file, also used for flock()
+        unsigned char* m_map;               // Mapping of the whole file
+        std::size_t m_map_size;
+        mutable std::shared_mutex m_mutex;  // Readers and writer within the process, as flock() does not exclude threads sharing a descriptor
+
+        Header* Get_Header() const;
+        Slot* Get_Slots() const;
+        double* Get_Data() const;
+        std::size_t Find(const Cache_Key& key) const;        // Slot of the key, or the number of slots if absent
+        void Erase(std::size_t slot);                        // Removes a slot, shifting back the following slots of its probe sequence
+        void Evict(const std::uint64_t& needed);             // Evicts least recently used entries until needed more doubles fit under the low-water mark, then compacts
+
+    public:
+    //CONSTRUCTORS AND DESTRUCTOR
+
+        // Opens the cache file, creating it with the given data capacity and number of slots if it does not exist. An existing file keeps its own sizes.
+        ResultCache(const std::string& path, const std::size_t& capacity_bytes = 64 * 1024 * 1024, const std::size_t& slots = 65536);
+        ResultCache(const ResultCache& source) = delete;                // Not copyable, as it owns a file descriptor and a mapping
+        ResultCache& operator = (const ResultCache& source) = delete;
+        ~ResultCache();                                                 // Destructor, unmaps and closes the file
+
+    //KEYS
+
+        static std::uint64_t Hash(const void* data, const std::size_t& size, std::uint64_t hash = 14695981039346656037ULL);    // FNV-1a, chainable
+        static std::uint64_t Check_Hash(const void* data, const std::size_t& size, std::uint64_t hash = 0x27d4eb2f165667c5ULL); // Independent of Hash(), chainable
+        static Cache_Key Key(const Matrix& matrix, const Option_Type& optiontype, const Exercise_Type& exercisetype, const std::string& engine_id,
+            const std::uint32_t& engine_version);
+
+    //LOOKUPS AND UPDATES
+
+        bool Lookup(const Cache_Key& key, std::vector<double>& results) const;     // True on a hit, with the stored results copied into results
+        void Store(const Cache_Key& key, const std::vector<double>& results);      // Stores results, unless larger than 3/4 of the data area
+        std::vector<double> Get_Or_Compute(const Cache_Key& key, const std::function<std::vector<double>()>& compute);     // Computes and stores on a miss
+        void Clear();                                                                   // Removes every entry and resets the counters
+
+    //GETTERS
+        Cache_Statistics Statistics() const;
+        std::string const& getPath() const;
+};
+
+#endif //ResultCache_hpp
@@ -0,0 +1,337 @@
+//RiskAggregator.cpp
+//
+//Purpose: Aggregation of position Greeks into risk buckets keyed by underlying, expiry bucket and strike bucket. Each position contributes its Greeks times its
+//         quantity, and the totals of each bucket are kept as 64-bit fixed-point integers (units of a resolution, 1e-8 by default): integer addition is associative,
+//         so the parallel reduction gives bit-identical totals whatever the number of threads or the order of the positions, and incremental updates (removing
+//         the old contribution of a repriced position, adding the new one) never drift from a full recomputation. Totals can be rolled up by underlying, or by
+//         underlying and expiry.
+//
+//Modification date: 10/18/2026
+
+
+#include "RiskAggregator.hpp"
+#include "Parallel.hpp"
+#include <algorithm>    // For std::sort, std::unique, std::lower_bound, std::upper_bound
+#include <cmath>        // For std::llround(), std::fabs()
+#include <stdexcept>
+
+
+namespace
+{
+    // Sums of fixed-point totals, checked for overflow of int64 (undefined behaviour otherwise)
+    std::int64_t Checked_Add(const std::int64_t& a, const std::int64_t& b)
+    {
+        std::int64_t sum;
+        if(__builtin_add_overflow(a, b, &sum)){throw std::invalid_argument("Error: risk total exceeds the fixed-point range; use a coarser resolution.");}
+        return sum;
+    }
+
+    std::int64_t Checked_Sub(const std::int64_t& a, const std::int64_t& b)
+    {
+        std::int64_t difference;
+        if(__builtin_sub_overflow(a, b, &difference)){throw std::invalid_argument("Error: risk total exceeds the fixed-point range; use a coarser resolution.");}
+        return difference;
+    }
+}
+
+
+//KEYS
+
+bool Risk_Bucket_Key::operator < (const Risk_Bucket_Key& other) const
+{
+    if(m_underlying != other.m_underlying){return m_underlying < other.m_underlying;}
+    if(m_expiry != other.m_expiry){return m_expiry < other.m_expiry;}
+    return m_strike < other.m_strike;
+}
+
+bool Risk_Bucket_Key::operator == (const Risk_Bucket_Key& other) const
+{
+    return m_underlying == other.m_underlying && m_expiry == other.m_expiry && m_strike == other.m_strike;
+}
+
+
+//Default constructor
+RiskAggregator::RiskAggregator(): m_resolution(1e-8), m_threads(0)
+{
+    //std::cout << "Default constructor in RiskAggregator used." << std::endl;
+}
+
+//Overloaded constructor
+RiskAggregator::RiskAggregator(const double& resolution, const unsigned& threads): m_resolution(resolution), m_threads(threads)
+{
+    if(!(resolution > 0.0)){throw std::invalid_argument("Error: fixed-point resolution must be positive.");}
+    //std::cout << "Overloaded constructor in RiskAggregator used." << std::endl;
+}
+
+//Copy constructor
+RiskAggregator::RiskAggregator(const RiskAggregator& source): m_resolution(source.m_resolution), m_threads(source.m_threads), m_quantities(source.m_quantities),
+    m_greeks(source.m_greeks), m_bucket_of(source.m_bucket_of), m_buckets(source.m_buckets), m_counts(source.m_counts), m_totals(source.m_totals)
+{
+    //std::cout << "Copy constructor in RiskAggregator used." << std::endl;
+}
+
+//Destructor
+RiskAggregator::~RiskAggregator()
+{
+    //std::cout << "Destructor in RiskAggregator used." << std::endl;
+}
+
+//Assignment operator
+RiskAggregator& RiskAggregator::operator = (const RiskAggregator& source)
+{
+    if (this == &source)    // Checking for self-assignment
+    {
+        return *this;
+    }
+    else
+    {
+        m_resolution = source.m_resolution;
+        m_threads = source.m_threads;
+        m_quantities = source.m_quantities;
+        m_greeks = source.m_greeks;
+        m_bucket_of = source.m_bucket_of;
+        m_buckets = source.m_buckets;
+        m_counts = source.m_counts;
+        m_totals = source.m_totals;
+        return *this;
+    }
+}
+
+
+//BUCKETING
+
+Position_Greeks RiskAggregator::From_BS(const BS_Greeks& greeks, const Option_Type& optiontype)
+{
+    bool call = (optiontype == Option_Type::Call);
+    Position_Greeks result = {call ? greeks.m_call_price : greeks.m_put_price, call ? greeks.m_call_delta : greeks.m_put_delta, greeks.m_gamma, greeks.m_vega,
+        call ? greeks.m_call_theta : greeks.m_put_theta, greeks.m_vanna, greeks.m_volga};
+    return result;
+}
+
+std::int32_t RiskAggregator::Bucket(const double& value, const std::vector<double>& edges)
+{
+    return static_cast<std::int32_t>(std::upper_bound(edges.begin(), edges.end(), value) - edges.begin());
+}
+
+
+//AGGREGATION
+
+void RiskAggregator::Contribution(const double& quantity, const Position_Greeks& greeks, std::int64_t* fixed) const
+{
+    const double values[Measures] = {greeks.m_price, greeks.m_delta, greeks.m_gamma, greeks.m_vega, greeks.m_theta, greeks.m_vanna, greeks.m_volga};
+    const double limit = 4.0e18;    // Below 2^63. Sums of contributions are checked where they are formed.
+    for(std::size_t m = 0; m < Measures; m++)
+    {
+        double units = quantity*values[m] / m_resolution;
+        if(!(std::fabs(units) < limit)){throw std::invalid_argument("Error: position contribution is not finite or exceeds the fixed-point range; use a coarser resolution.");}
+        fixed[m] = static_cast<std::int64_t>(std::llround(units));
+    }
+}
+
+Position_Greeks RiskAggregator::To_Greeks(const std::int64_t* fixed) const
+{
+    Position_Greeks result = {double(fixed[0])*m_resolution, double(fixed[1])*m_resolution, double(fixed[2])*m_resolution, double(fixed[3])*m_resolution,
+        double(fixed[4])*m_resolution, double(fixed[5])*m_resolution, double(fixed[6])*m_resolution};
+    return result;
+}
+
+void RiskAggregator::Set_Positions(const std::vector<Risk_Bucket_Key>& keys, const std::vector<double>& quantities, const std::vector<Position_Greeks>& greeks)
+{
+    if(keys.size() != quantities.size() || keys.size() != greeks.size()){throw std::invalid_argument("Error: keys, quantities and Greeks must have one entry per position.");}
+
+    // Everything is computed into locals, and only committed once no contribution or total was out of range
+    std::vector<Risk_Bucket_Key> sorted_buckets = keys;
+    std::sort(sorted_buckets.begin(), sorted_buckets.end());
+    sorted_buckets.erase(std::unique(sorted_buckets.begin(), sorted_buckets.end()), sorted_buckets.end());
+
+    const std::size_t n = keys.size(), buckets = sorted_buckets.size();
+    std::vector<std::uint32_t> bucket_of(n);
+    const std::size_t chunks = Chunk_Count(n, m_threads, 4096);
+    std::vector<std::vector<std::int64_t>> partial(chunks);     // Per-chunk totals, reduced below
+    std::vector<std::vector<std::uint32_t>> partial_counts(chunks);
+
+    Parallel_For(n, [&](std::size_t begin, std::size_t end, std::size_t chunk)
+    {
+        std::vector<std::int64_t>& totals = partial[chunk];
+        std::vector<std::uint32_t>& counts = partial_counts[chunk];
+        totals.assign(buckets*Measures, 0);
+        counts.assign(buckets, 0);
+        std::int64_t fixed[Measures];
+        for(std::size_t i = begin; i < end; i++)
+        {
+            std::size_t b = std::lower_bound(sorted_buckets.begin(), sorted_buckets.end(), keys[i]) - sorted_buckets.begin();
+            bucket_of[i] = static_cast<std::uint32_t>(b);
+            Contribution(quantities[i], greeks[i], fixed);
+            for(std::size_t m = 0; m < Measures; m++)
+            {
+                totals[b*Measures + m] = Checked_Add(totals[b*Measures + m], fixed[m]);
+            }
+            counts[b]++;
+        }
+    }, m_threads, 4096);
+
+    // Integer sums: the result does not depend on how the positions were split into chunks
+    std::vector<std::int64_t> bucket_totals(buckets*Measures, 0);
+    std::vector<std::uint32_t> bucket_counts(buckets, 0);
+    for(std::size_t c = 0; c < chunks; c++)
+    {
+        for(std::size_t k = 0; k < partial[c].size(); k++)
+        {
+            bucket_totals[k] = Checked_Add(bucket_totals[k], partial[c][k]);
+        }
+        for(std::size_t b = 0; b < partial_counts[c].size(); b++)
+        {
+            bucket_counts[b] += partial_counts[c][b];
+        }
+    }
+
+    m_quantities = quantities;
+    m_greeks = greeks;
+    m_buckets.swap(sorted_buckets);
+    m_bucket_of.swap(bucket_of);
+    m_totals.swap(bucket_totals);
+    m_counts.swap(bucket_counts);
+}
+
+void RiskAggregator::Update(const std::vector<std::size_t>& positions, const std::vector<Position_Greeks>& greeks)
+{
+    if(positions.size() != greeks.size()){throw std::invalid_argument("Error: one set of Greeks is required per updated position.");}
+    Apply_Updates(positions, greeks, nullptr);
+}
+
+void RiskAggregator::Update(const std::vector<std::size_t>& positions, const std::vector<Position_Greeks>& greeks, const std::vector<double>& quantities)
+{
+    if(positions.size() != greeks.size() || positions.size() != quantities.size()){throw std::invalid_argument("Error: one set of Greeks and one quantity are required per updated position.");}
+    Apply_Updates(positions, greeks, quantities.data());
+}
+
+void RiskAggregator::Apply_Updates(const std::vector<std::size_t>& positions, const std::vector<Position_Greeks>& greeks, const double* quantities)
+{
+    // Validation of every update before anything is modified: positions in range, and new contributions within the fixed-point range
+    std::int64_t old_fixed[Measures], new_fixed[Measures];
+    for(std::size_t k = 0; k < positions.size(); k++)
+    {
+        if(positions[k] >= m_greeks.size()){throw std::invalid_argument("Error: updated position out of range.");}
+        Contribution(quantities ? quantities[k] : m_quantities[positions[k]], greeks[k], new_fixed);
+    }
+
+    // Updates are applied in order (a position may appear more than once), each bucket written only once its new totals are known to fit. Should a total
+    // overflow, the updates already applied are undone from the log, in reverse order, before rethrowing: an update is applied entirely or not at all.
+    struct Undo_Entry
+    {
+        std::size_t m_position;
+        Position_Greeks m_greeks;
+        double m_quantity;
+        std::int64_t m_totals[Measures];
+    };
+    std::vector<Undo_Entry> log;
+    log.reserve(positions.size());
+    try
+    {
+        for(std::size_t k = 0; k < positions.size(); k++)
+        {
+            std::size_t i = positions[k];
+            const double quantity = quantities ? quantities[k] : m_quantities[i];
+            Contribution(m_quantities[i], m_greeks[i], old_fixed);   // Recomputed exactly as when it was added
+            Contribution(quantity, greeks[k], new_fixed);
+
+            std::int64_t* totals = &m_totals[m_bucket_of[i]*Measures];
+            std::int64_t updated[Measures];
+            for(std::size_t m = 0; m < Measures; m++)
+            {
+                updated[m] = Checked_Add(totals[m], Checked_Sub(new_fixed[m], old_fixed[m]));
+            }
+
+            Undo_Entry entry;
+            entry.m_position = i;
+            entry.m_greeks = m_greeks[i];
+            entry.m_quantity = m_quantities[i];
+            std::copy(totals, totals + Measures, entry.m_totals);
+            log.push_back(entry);
+
+            std::copy(updated, updated + Measures, totals);
+            m_greeks[i] = greeks[k];
+            m_quantities[i] = quantity;
+        }
+    }
+    catch(...)
+    {
+        for(std::size_t e = log.size(); e-- > 0; )
+        {
+            const Undo_Entry& entry = log[e];
+            std::copy(entry.m_totals, entry.m_totals + Measures, &m_totals[m_bucket_of[entry.m_position]*Measures]);
+            m_greeks[entry.m_position] = entry.m_greeks;
+            m_quantities[entry.m_position] = entry.m_quantity;
+        }
+        throw;
+    }
+}
+
+std::vector<Risk_Bucket_Total> RiskAggregator::Totals(const Risk_Level& level) const
+{
+    // Buckets are sorted by underlying, then expiry, then strike, so each roll-up is a run of consecutive buckets
+    std::vector<Risk_Bucket_Total> results;
+    std::int64_t fixed[Measures];
+    std::size_t b = 0;
+    while(b < m_buckets.size())
+    {
+        Risk_Bucket_Key key = m_buckets[b];
+        if(level != Risk_Level::Strike){key.m_strike = Risk_Bucket_Key::All_Buckets;}
+        if(level == Risk_Level::Underlying){key.m_expiry = Risk_Bucket_Key::All_Buckets;}
+
+        std::fill(fixed, fixed + Measures, 0);
+        std::uint32_t positions = 0;
+        std::size_t end = b;
+        while(end < m_buckets.size() && m_buckets[end].m_underlying == key.m_underlying &&
+            (level == Risk_Level::Underlying || m_buckets[end].m_expiry == key.m_expiry) && (level != Risk_Level::Strike || end == b))
+        {
+            for(std::size_t m = 0; m < Measures; m++)
+            {
+                fixed[m] = Checked_Add(fixed[m], m_totals[end*Measures + m]);
+            }
+            positions += m_counts[end];
+            end++;
+        }
+
+        Risk_Bucket_Total total = {key, To_Greeks(fixed), positions};
+        results.push_back(total);
+        b = end;
+    }
+    return results;
+}
+
+Position_Greeks RiskAggregator::Total() const
+{
+    std::int64_t fixed[Measures] = {0, 0, 0, 0, 0, 0, 0};
+    for(std::size_t b = 0; b < m_buckets.size(); b++)
+    {
+        for(std::size_t m = 0; m < Measures; m++)
+        {
+            fixed[m] = Checked_Add(fixed[m], m_totals[b*Measures + m]);
+        }
+    }
+    return To_Greeks(fixed);
+}
+
+
+//GETTERS
+
+std::size_t RiskAggregator::size() const
+{
+    return m_greeks.size();
+}
+
+std::size_t RiskAggregator::Bucket_Count() const
+{
+    return m_buckets.size();
+}
+
+double const& RiskAggregator::getResolution() const
+{
+    return m_resolution;
+}
+
+unsigned const& RiskAggregator::getThreads() const
+{
+    return m_threads;
+}
@@ -0,0 +1,109 @@
+//RiskAggregator.hpp
+//
+//Purpose: Aggregation of position Greeks into risk buckets keyed by underlying, expiry bucket and strike bucket. Each position contributes its Greeks times its
+//         quantity, and the totals of each bucket are kept as 64-bit fixed-point integers (units of a resolution, 1e-8 by default): integer addition is associative,
+//         so the parallel reduction gives bit-identical totals whatever the number of threads or the order of the positions, and incremental updates (removing
+//         the old contribution of a repriced position, adding the new one) never drift from a full recomputation. Totals can be rolled up by underlying, or by
+//         underlying and expiry.
+//
+//Modification date: 10/18/2026
+
+#ifndef RiskAggregator_hpp
+#define RiskAggregator_hpp
+
+#include "OptionData.hpp"
+#include "BSExactPricingEngine.hpp"     // BS_Greeks
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Greeks of one unit of a position
+struct Position_Greeks
+{
+    double m_price;
+    double m_delta, m_gamma, m_vega, m_theta, m_vanna, m_volga;
+};
+
+// Bucket of a position. Roll-ups set the keys they aggregate over to All_Buckets.
+struct Risk_Bucket_Key
+{
+    std::uint32_t m_underlying;
+    std::int32_t m_expiry;
+    std::int32_t m_strike;
+
+    static const std::int32_t All_Buckets = -1;
+
+    bool operator < (const Risk_Bucket_Key& other) const;
+    bool operator == (const Risk_Bucket_Key& other) const;
+};
+
+// Totals of a bucket, in the units of the Greeks times the quantities
+struct Risk_Bucket_Total
+{
+    Risk_Bucket_Key m_key;
+    Position_Greeks m_totals;
+    std::uint32_t m_positions;      // Number of positions in the bucket
+};
+
+// Granularity of the totals reported
+enum class Risk_Level
+{
+    Underlying, Expiry, Strike
+};
+
+class RiskAggregator
+{
+    public:
+        static const std::size_t Measures = 7;     // Fields of Position_Greeks
+
+    private:
+        double m_resolution;                        // Value of one fixed-point unit
+        unsigned m_threads;                         // Number of threads, 0 for the number of hardware threads
+
+        std::vector<double> m_quantities;           // Per position
+        std::vector<Position_Greeks> m_greeks;      // Per position, per unit
+        std::vector<std::uint32_t> m_bucket_of;     // Per position, index into m_buckets
+        std::vector<Risk_Bucket_Key> m_buckets;     // Sorted, distinct
+        std::vector<std::uint32_t> m_counts;        // Positions per bucket
+        std::vector<std::int64_t> m_totals;         // Measures fixed-point totals per bucket
+
+        void Contribution(const double& quantity, const Position_Greeks& greeks, std::int64_t* fixed) const;  // Quantity times Greeks, rounded to fixed point
+        Position_Greeks To_Greeks(const std::int64_t* fixed) const;
+        void Apply_Updates(const std::vector<std::size_t>& positions, const std::vector<Position_Greeks>& greeks, const double* quantities);   // quantities may be nullptr
+
+    public:
+    //CONSTRUCTORS AND DESTRUCTOR
+
+        RiskAggregator();                                               // Default constructor: resolution of 1e-8, all hardware threads
+        RiskAggregator(const double& resolution, const unsigned& threads);  // Overloaded constructor
+        RiskAggregator(const RiskAggregator& source);                   // Copy constructor
+        ~RiskAggregator();                                              // Destructor
+        RiskAggregator& operator = (const RiskAggregator& source);      // Assignment operator
+
+    //BUCKETING
+
+        static Position_Greeks From_BS(const BS_Greeks& greeks, const Option_Type& optiontype);    // Greeks of the call or the put of a fused evaluation
+        static std::int32_t Bucket(const double& value, const std::vector<double>& edges);         // Index of the first edge above value (edges sorted), e.g. for T or K/S
+
+    //AGGREGATION
+
+        // Replaces every position, and recomputes the totals with a parallel reduction. The three vectors must have the same size. Sums of totals are checked:
+        // std::invalid_argument is thrown if one leaves the fixed-point range, and the aggregator is then left unchanged, as it is by a failed Update().
+        void Set_Positions(const std::vector<Risk_Bucket_Key>& keys, const std::vector<double>& quantities, const std::vector<Position_Greeks>& greeks);
+
+        // Repriced positions: the old contributions are removed and the new ones added, in time proportional to the number of positions updated. Keys are unchanged.
+        void Update(const std::vector<std::size_t>& positions, const std::vector<Position_Greeks>& greeks);
+        void Update(const std::vector<std::size_t>& positions, const std::vector<Position_Greeks>& greeks, const std::vector<double>& quantities);  // Also new quantities
+
+        // Roll-ups are checked as well, and throw std::invalid_argument if a sum leaves the fixed-point range
+        std::vector<Risk_Bucket_Total> Totals(const Risk_Level& level = Risk_Level::Strike) const;     // Totals per bucket, rolled up to the level requested, in key order
+        Position_Greeks Total() const;                                                                  // Total over every position
+
+    //GETTERS
+        std::size_t size() const;                   // Number of positions
+        std::size_t Bucket_Count() const;           // Number of distinct buckets
+        double const& getResolution() const;
+        unsigned const& getThreads() const;
+};
+
+#endif //RiskAggregator_hpp
@@ -0,0 +1,228 @@
+//ScenarioEngine.cpp
+//
+//Purpose: Scenario/stress-test engine over a book of European options. The book is copied once into contiguous arrays (no EuropeanOption is modified), and the
+//         cross product of scenarios and positions is evaluated in parallel, tile by tile: a tile of positions stays in cache while every scenario is applied to it.
+//         Results are either the full P&L matrix (one row per scenario), or P&L summed per underlying as the tiles are evaluated, so that the full matrix is
+//         never materialized when only aggregates are needed.
+//
+//Modification date: 10/18/2026
+
+
+#include "ScenarioEngine.hpp"
+#include "BSExactPricingEngine.hpp"
+#include "Parallel.hpp"
+#include <algorithm>    // For std::sort, std::unique, std::lower_bound
+#include <stdexcept>
+
+
+//Default constructor
+ScenarioEngine::ScenarioEngine(): m_tile(256), m_threads(0)
+{
+    //std::cout << "Default constructor in ScenarioEngine used." << std::endl;
+}
+
+//Overloaded constructor
+ScenarioEngine::ScenarioEngine(const std::vector<EuropeanOption>& book, const std::vector<double>& quantities, const std::vector<int>& underlyings,
+    const std::size_t& tile, const unsigned& threads): m_quantity(quantities), m_underlyings(underlyings), m_tile(tile > 0 ? tile : 1), m_threads(threads)
+{
+    const std::size_t n = book.size();
+    if(quantities.size() != n || underlyings.size() != n)
+    {
+        throw std::invalid_argument("Error: Quantities and underlyings must be given for every position of the book.");
+    }
+
+    m_S.resize(n); m_K.resize(n); m_T.resize(n); m_R.resize(n); m_Sig.resize(n); m_B.resize(n);
+    m_base.resize(n); m_call.resize(n); m_spot.resize(n); m_bucket.resize(n);
+
+    // Distinct underlyings, so that aggregated results are dense arrays
+    std::sort(m_underlyings.begin(), m_underlyings.end());
+    m_underlyings.erase(std::unique(m_underlyings.begin(), m_underlyings.end()), m_underlyings.end());
+
+    for(std::size_t i = 0; i < n; i++)  // Copying the book into contiguous arrays
+    {
+        m_S[i] = book[i].getS();
+        m_K[i] = book[i].getK();
+        m_T[i] = book[i].getT();
+        m_R[i] = book[i].getR();
+        m_Sig[i] = book[i].getSig();
+        m_B[i] = book[i].getB();
+        m_call[i] = (book[i].get_OptionType() == Option_Type::Call) ? 1 : 0;
+        m_spot[i] = (book[i].get_ExerciseType() == Exercise_Type::Spot) ? 1 : 0;
+        m_bucket[i] = static_cast<std::size_t>(std::lower_bound(m_underlyings.begin(), m_underlyings.end(), underlyings[i]) - m_underlyings.begin());
+    }
+
+    Scenario base_scenario = {0.0, 0.0, 0.0};
+    for(std::size_t i = 0; i < n; i++)  // Base prices, priced once rather than once per scenario
+    {
+        m_base[i] = Shocked_Price(i, base_scenario);
+    }
+}
+
+//Copy constructor
+ScenarioEngine::ScenarioEngine(const ScenarioEngine& source): m_S(source.m_S), m_K(source.m_K), m_T(source.m_T), m_R(source.m_R), m_Sig(source.m_Sig), m_B(source.m_B),
+m_quantity(source.m_quantity), m_base(source.m_base), m_call(source.m_call), m_spot(source.m_spot), m_bucket(source.m_bucket), m_underlyings(source.m_underlyings),
+m_tile(source.m_tile), m_threads(source.m_threads)
+{
+    //std::cout << "Copy constructor in ScenarioEngine used." << std::endl;
+}
+
+//Destructor
+ScenarioEngine::~ScenarioEngine()
+{
+    //std::cout << "Destructor in ScenarioEngine used." << std::endl;
+}
+
+//Assignment operator
+ScenarioEngine& ScenarioEngine::operator = (const ScenarioEngine& source)
+{
+    if (this == &source)    // Checking for self-assignment
+    {
+        return *this;
+    }
+    else
+    {
+        m_S = source.m_S; m_K = source.m_K; m_T = source.m_T; m_R = source.m_R; m_Sig = source.m_Sig; m_B = source.m_B;
+        m_quantity = source.m_quantity;
+        m_base = source.m_base;
+        m_call = source.m_call;
+        m_spot = source.m_spot;
+        m_bucket = source.m_bucket;
+        m_underlyings = source.m_underlyings;
+        m_tile = source.m_tile;
+        m_threads = source.m_threads;
+        return *this;
+    }
+}
+
+
+//PRIVATE FUNCTIONS
+
+double ScenarioEngine::Shocked_Price(const std::size_t& i, const Scenario& scenario) const
+{
+    double S = m_S[i] * (1.0 + scenario.m_spot_shift);
+    double Sig = m_Sig[i] + scenario.m_vol_shift;
+    double R = m_R[i] + scenario.m_rate_shift;
+    double B = m_spot[i] ? m_B[i] + scenario.m_rate_shift : m_B[i];     // The option's own B: for spot options the rate shift moves it, keeping B - R (a dividend yield, a foreign rate)
+
+    return m_call[i] ? BSExactPricingEngine::Call_Price_BS(S, m_K[i], m_T[i], R, Sig, B) : BSExactPricingEngine::Put_Price_BS(S, m_K[i], m_T[i], R, Sig, B);
+}
+
+// Tiles of positions are distributed across threads. Within a tile, every scenario is applied before moving on to the next tile, so that the position data is read
+// from cache. The sink receives (chunk, scenario, position, P&L), which lets it write into the full matrix, or into per-chunk aggregates.
+template<typename Sink>
+void ScenarioEngine::Run(const std::vector<Scenario>& scenarios, Sink& sink) const
+{
+    const std::size_t n = m_S.size();
+    const std::size_t tiles = (n + m_tile - 1) / m_tile;
+
+    Parallel_For(tiles, [&](std::size_t tile_begin, std::size_t tile_end, std::size_t chunk)
+    {
+        for(std::size_t t = tile_begin; t < tile_end; t++)
+        {
+            const std::size_t begin = t * m_tile;
+            const std::size_t end = (begin + m_tile < n) ? begin + m_tile : n;
+
+            for(std::size_t s = 0; s < scenarios.size(); s++)
+            {
+                for(std::size_t i = begin; i < end; i++)
+                {
+                    sink.Add(chunk, s, i, m_quantity[i] * (Shocked_Price(i, scenarios[s]) - m_base[i]));
+                }
+            }
+        }
+    }, m_threads, 1);
+}
+
+namespace
+{
+    // Writes each P&L into the full scenarios x positions matrix. Tiles write disjoint elements, so no synchronization is needed.
+    struct Matrix_Sink
+    {
+        std::vector<double>& m_results;
+        std::size_t m_positions;
+
+        void Add(const std::size_t&, const std::size_t& s, const std::size_t& i, const double& pnl)
+        {
+            m_results[s * m_positions + i] = pnl;
+        }
+    };
+
+    // Sums each P&L into the scenarios x underlyings aggregates of its chunk. Chunks are merged in order afterwards, so results do not depend on thread timing.
+    struct Aggregate_Sink
+    {
+        std::vector<std::vector<double>>& m_chunk_results;
+        const std::vector<std::size_t>& m_bucket;
+        std::size_t m_buckets;
+
+        void Add(const std::size_t& chunk, const std::size_t& s, const std::size_t& i, const double& pnl)
+        {
+            m_chunk_results[chunk][s * m_buckets + m_bucket[i]] += pnl;
+        }
+    };
+}
+
+
+//SCENARIO FUNCTIONS
+
+std::vector<double> ScenarioEngine::PnL_Matrix(const std::vector<Scenario>& scenarios) const
+{
+    std::vector<double> results(scenarios.size() * m_S.size(), 0.0);
+    Matrix_Sink sink = {results, m_S.size()};
+    Run(scenarios, sink);
+    return results;
+}
+
+std::vector<double> ScenarioEngine::PnL_By_Underlying(const std::vector<Scenario>& scenarios) const
+{
+    const std::size_t tiles = (m_S.size() + m_tile - 1) / m_tile;
+    const std::size_t buckets = m_underlyings.size();
+
+    // Only scenarios x underlyings per chunk are held in memory, never scenarios x positions
+    std::vector<std::vector<double>> chunk_results(Chunk_Count(tiles, m_threads, 1), std::vector<double>(scenarios.size() * buckets, 0.0));
+    Aggregate_Sink sink = {chunk_results, m_bucket, buckets};
+    Run(scenarios, sink);
+
+    std::vector<double> results(scenarios.size() * buckets, 0.0);
+    for(std::size_t c = 0; c < chunk_results.size(); c++)
+    {
+        for(std::size_t k = 0; k < results.size(); k++)
+        {
+            results[k] += chunk_results[c][k];
+        }
+    }
+    return results;
+}
+
+std::vector<double> ScenarioEngine::PnL_Total(const std::vector<Scenario>& scenarios) const
+{
+    std::vector<double> by_underlying = PnL_By_Underlying(scenarios);
+    const std::size_t buckets = m_underlyings.size();
+
+    std::vector<double> results(scenarios.size(), 0.0);
+    for(std::size_t s = 0; s < scenarios.size(); s++)
+    {
+        for(std::size_t u = 0; u < buckets; u++)
+        {
+            results[s] += by_underlying[s * buckets + u];
+        }
+    }
+    return results;
+}
+
+
+//GETTERS
+
+std::vector<int> const& ScenarioEngine::getUnderlyings() const
+{
+    return m_underlyings;
+}
+
+std::vector<double> const& ScenarioEngine::getBasePrices() const
+{
+    return m_base;
+}
+
+std::size_t ScenarioEngine::size() const
+{
+    return m_S.size();
+}
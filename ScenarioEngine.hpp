@@ -0,0 +1,65 @@
+//ScenarioEngine.hpp
+//
+//Purpose: Scenario/stress-test engine over a book of European options. The book is copied once into contiguous arrays (no EuropeanOption is modified), and the
+//         cross product of scenarios and positions is evaluated in parallel, tile by tile: a tile of positions stays in cache while every scenario is applied to it.
+//         Results are either the full P&L matrix (one row per scenario), or P&L summed per underlying as the tiles are evaluated, so that the full matrix is
+//         never materialized when only aggregates are needed.
+//
+//Modification date: 10/18/2026
+
+#ifndef ScenarioEngine_hpp
+#define ScenarioEngine_hpp
+
+#include "EuropeanOption.hpp"
+#include <vector>
+#include <cstddef>
+
+// Market shock applied to every position of the book
+struct Scenario
+{
+    double m_spot_shift;    // Relative shift of the underlying price: -0.05 for S -5%
+    double m_vol_shift;     // Absolute shift of the volatility: 0.02 for +2 vol points
+    double m_rate_shift;    // Absolute shift of the interest rate: 0.001 for +10bp. For spot options, B moves with it; for futures options, B is kept.
+};
+
+class ScenarioEngine
+{
+    private:
+        // Book in structure-of-arrays form
+        std::vector<double> m_S, m_K, m_T, m_R, m_Sig, m_B;
+        std::vector<double> m_quantity;         // Position sizes
+        std::vector<double> m_base;             // Base prices of each option, computed once
+        std::vector<char> m_call;               // 1 for calls, 0 for puts
+        std::vector<char> m_spot;               // 1 for spot options (B shifted with R), 0 for futures options (B kept)
+        std::vector<std::size_t> m_bucket;      // Position of the underlying of each option among m_underlyings
+        std::vector<int> m_underlyings;         // Distinct underlying keys, sorted
+        std::size_t m_tile;                     // Number of positions per tile
+        unsigned m_threads;                     // Number of threads, 0 for the number of hardware threads
+
+        double Shocked_Price(const std::size_t& i, const Scenario& scenario) const;    // Price of position i under the scenario at hand
+        template<typename Sink>
+        void Run(const std::vector<Scenario>& scenarios, Sink& sink) const;          // Tiled, parallel evaluation of the cross product, results handed to the sink
+
+    public:
+    //CONSTRUCTORS AND DESTRUCTOR
+
+        ScenarioEngine();       // Default constructor: empty book
+        ScenarioEngine(const std::vector<EuropeanOption>& book, const std::vector<double>& quantities, const std::vector<int>& underlyings,
+            const std::size_t& tile = 256, const unsigned& threads = 0);    // Book, position sizes, and underlying key of each position
+        ScenarioEngine(const ScenarioEngine& source);               // Copy constructor
+        ~ScenarioEngine();                                          // Destructor
+        ScenarioEngine& operator = (const ScenarioEngine& source);  // Assignment operator
+
+    //SCENARIO FUNCTIONS
+
+        std::vector<double> PnL_Matrix(const std::vector<Scenario>& scenarios) const;          // Full P&L matrix: element [s * size() + i] is the P&L of position i under scenario s
+        std::vector<double> PnL_By_Underlying(const std::vector<Scenario>& scenarios) const;   // Aggregated P&L: element [s * number of underlyings + u] sums the positions on getUnderlyings()[u]
+        std::vector<double> PnL_Total(const std::vector<Scenario>& scenarios) const;           // P&L of the whole book for each scenario
+
+    //GETTERS
+        std::vector<int> const& getUnderlyings() const;     // Distinct underlying keys, in the order of the aggregated results
+        std::vector<double> const& getBasePrices() const;   // Base prices of the book
+        std::size_t size() const;                           // Number of positions
+};
+
+#endif //ScenarioEngine_hpp
@@ -0,0 +1,146 @@
+//ServerConnectionTest.cpp
+//
+//Purpose: Test of the reaping of client connections by the pricing server. Clients connect, send a request, read the reply and disconnect, many times over.
+//         The numbers of threads and file descriptors of the process (read from /proc/self) must then come back to those of the running server, and its virtual
+//         memory must not grow with the stacks of threads never joined, rather than grow by one thread and one socket per client that ever connected. A client
+//         sending a line longer than PricingServer::Max_Line must be answered with an error and disconnected.
+//         Returns 0 on success, 1 on failure.
+//
+//         Usage: server_connection_test [connections per round]
+//         Defaults: 500 connections per round, two rounds
+//
+//Modification date: 10/18/2026
+
+
+#include "PricingServer.hpp"
+#include <dirent.h>
+#include <fstream>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+
+
+// Number of entries of a /proc directory, without . and ..
+static std::size_t Count_Entries(const char* path)
+{
+    DIR* directory = ::opendir(path);
+    if(directory == nullptr){return 0;}
+    std::size_t count = 0;
+    while(dirent* entry = ::readdir(directory))
+    {
+        if(entry->d_name[0] != '.'){count++;}
+    }
+    ::closedir(directory);
+    return count;
+}
+
+static std::size_t Thread_Count() {return Count_Entries("/proc/self/task");}
+static std::size_t Fd_Count() {return Count_Entries("/proc/self/fd") - 1;}     // Less the descriptor of the listing itself
+
+// Virtual memory of the process in kB. Threads that returned but were never joined do not appear in /proc/self/task, but keep their stacks mapped.
+static std::size_t Virtual_Memory()
+{
+    std::ifstream status("/proc/self/status");
+    std::string key;
+    std::size_t value = 0;
+    while(status >> key)
+    {
+        if(key == "VmSize:"){status >> value; break;}
+    }
+    return value;
+}
+
+// One client: connects, sends one request, waits for its reply and disconnects
+static bool Client_Round_Trip(const std::string& address)
+{
+    int fd = PricingServer::Connect(address);
+    if(fd < 0){return false;}
+    const std::string request = "1 E C 60 65 0.25 0.08 0.3 0.08\n";
+    bool ok = ::send(fd, request.data(), request.size(), MSG_NOSIGNAL) == static_cast<ssize_t>(request.size());
+    char buffer[256];
+    std::string reply;
+    while(ok && reply.find('\n') == std::string::npos)
+    {
+        ssize_t n = ::recv(fd, buffer, sizeof(buffer), 0);
+        if(n <= 0){ok = false; break;}
+        reply.append(buffer, static_cast<std::size_t>(n));
+    }
+    ::close(fd);
+    return ok && reply.compare(0, 2, "1 ") == 0;
+}
+
+// One client sending a line longer than the server buffers: it must be answered with an error, and its connection closed
+static bool Client_Overlong_Line(const std::string& address)
+{
+    int fd = PricingServer::Connect(address);
+    if(fd < 0){return false;}
+    const std::string request(2 * PricingServer::Max_Line, '1');
+    bool ok = ::send(fd, request.data(), request.size(), MSG_NOSIGNAL) == static_cast<ssize_t>(request.size());
+    char buffer[256];
+    std::string reply;
+    while(ok)
+    {
+        ssize_t n = ::recv(fd, buffer, sizeof(buffer), 0);
+        if(n <= 0){break;}      // Closed by the server
+        reply.append(buffer, static_cast<std::size_t>(n));
+    }
+    ::close(fd);
+    return ok && reply == "ERR request line too long\n";
+}
+
+
+int main(int argc, char* argv[])
+{
+    std::size_t connections = (argc > 1) ? static_cast<std::size_t>(std::atol(argv[1])) : 500;
+    const std::string address = "unix:/tmp/option_pricing_test_" + std::to_string(::getpid()) + ".sock";
+
+    PricingServer server(address, std::chrono::microseconds(50), 64, 2);
+    server.Start();
+    const std::size_t base_threads = Thread_Count(), base_fds = Fd_Count();
+
+    // Two rounds of connections: the first one lets the allocator create its per-thread arenas (bounded by the number of cores), so that the virtual memory
+    // measured over the second one only grows with thread stacks that are never released
+    std::size_t base_memory = 0;
+    const std::size_t memory_slack = 64 * 1024;     // kB: well below the stacks of the threads of one round, if they were not joined
+    for(int round = 0; round < 2; round++)
+    {
+        if(round == 1){base_memory = Virtual_Memory();}
+        if(!Client_Overlong_Line(address))
+        {
+            std::cout << "FAILED: overlong line not refused" << std::endl;
+            return 1;
+        }
+        for(std::size_t i = 0; i < connections; i++)
+        {
+            if(!Client_Round_Trip(address))
+            {
+                std::cout << "FAILED: no reply on connection " << i << std::endl;
+                return 1;
+            }
+        }
+    }
+
+    // Readers notice the disconnections asynchronously: waiting up to 5s for the counts to come back. One returned reader may be left to be joined.
+    std::size_t threads = 0, fds = 0, memory = 0;
+    bool ok = false;
+    for(int attempt = 0; attempt < 500 && !ok; attempt++)
+    {
+        if(attempt > 0){std::this_thread::sleep_for(std::chrono::milliseconds(10));}
+        threads = Thread_Count();
+        fds = Fd_Count();
+        memory = Virtual_Memory();
+        ok = (threads <= base_threads + 1) && (fds <= base_fds) && (memory <= base_memory + memory_slack);
+    }
+    std::cout << 2 * connections << " connections: threads " << base_threads << " -> " << threads << "; file descriptors " << base_fds << " -> " << fds
+              << "; virtual memory " << base_memory << "kB -> " << memory << "kB" << std::endl;
+
+    server.Stop();
+    ok = ok && (Thread_Count() == 1);       // After Stop(), only the main thread is left
+
+    std::cout << (ok ? "PASSED" : "FAILED: connections are not reaped") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,225 @@
+//SobolSequence.cpp
+//
+//Purpose: Sobol low-discrepancy sequence in base 2, for quasi-Monte Carlo path generation. Coordinates are 32-bit fractions generated in Gray-code order, so that
+//         each point is the previous one XOR a single direction number per dimension. Skip_To() jumps to any index directly (XOR of the direction numbers selected
+//         by the Gray code of the index), which is how parallel workers each generate their own contiguous run of points. The direction numbers of each dimension
+//         come from a primitive polynomial over GF(2) and its odd initial values, those of Joe and Kuo (new-joe-kuo-6.21201, in SobolDirectionNumbers.cpp), chosen
+//         for good two-dimensional projections, so that the points are those of the reference sequence, up to 21201 dimensions.
+//         Randomized quasi-Monte Carlo scrambles the sequence from a seed: a random digital shift (XOR of each coordinate with a random fraction), optionally after
+//         Matousek's random linear scrambling, which multiplies the digits of each direction number by a random lower-triangular binary matrix. Linear scrambling
+//         is the affine form of Owen's nested scrambling: it keeps the net structure of the points, and since it is linear, it applies to the direction numbers
+//         once rather than to each point, so scrambled points cost the same as unscrambled ones. Independent scrambles give independent estimates, and so an
+//         error estimate, which a single deterministic sequence does not.
+//
+//Modification date: 10/18/2026
+
+
+#include "SobolSequence.hpp"
+#include <random>       // For std::mt19937, drawing the scrambles
+#include <stdexcept>
+
+
+// Parity of the number of bits set: the sum over GF(2) of the digits selected by a mask
+static std::uint32_t Parity(std::uint32_t x)
+{
+    x ^= x >> 16; x ^= x >> 8; x ^= x >> 4; x ^= x >> 2; x ^= x >> 1;
+    return x & 1u;
+}
+
+
+//Default constructor
+SobolSequence::SobolSequence(): SobolSequence(1)
+{
+    //std::cout << "Default constructor in SobolSequence used." << std::endl;
+}
+
+//Overloaded constructor
+SobolSequence::SobolSequence(const std::size_t& dimension, const Sobol_Scrambling& scrambling, const std::uint64_t& seed): m_dimension(dimension),
+    m_scrambling(scrambling), m_seed(seed), m_state(dimension, 0u), m_index(0)
+{
+    if(dimension == 0){throw std::invalid_argument("Error: Sobol sequence dimension must be at least 1.");}
+    if(dimension > Max_Dimension){throw std::invalid_argument("Error: Sobol sequence dimension beyond the 21201 of the direction numbers.");}
+    Build_Directions();
+    Scramble(scrambling, seed);
+    //std::cout << "Overloaded constructor in SobolSequence used." << std::endl;
+}
+
+//Copy constructor
+SobolSequence::SobolSequence(const SobolSequence& source): m_dimension(source.m_dimension), m_base(source.m_base), m_directions(source.m_directions),
+    m_shift(source.m_shift), m_scrambling(source.m_scrambling), m_seed(source.m_seed), m_state(source.m_state), m_index(source.m_index)
+{
+    //std::cout << "Copy constructor in SobolSequence used." << std::endl;
+}
+
+//Destructor
+SobolSequence::~SobolSequence()
+{
+    //std::cout << "Destructor in SobolSequence used." << std::endl;
+}
+
+//Assignment operator
+SobolSequence& SobolSequence::operator = (const SobolSequence& source)
+{
+    if (this == &source)    // Checking for self-assignment
+    {
+        return *this;
+    }
+    else
+    {
+        m_dimension = source.m_dimension;
+        m_base = source.m_base;
+        m_directions = source.m_directions;
+        m_shift = source.m_shift;
+        m_scrambling = source.m_scrambling;
+        m_seed = source.m_seed;
+        m_state = source.m_state;
+        m_index = source.m_index;
+        return *this;
+    }
+}
+
+
+//DIRECTION NUMBERS
+
+void SobolSequence::Build_Directions()
+{
+    m_base.assign(m_dimension*Bits, 0u);
+
+    // Dimension 0 is the van der Corput sequence: v_k = 2^-k
+    for(std::size_t k = 0; k < Bits; k++)
+    {
+        m_base[k] = 1u << (Bits - 1 - k);
+    }
+
+    const std::uint32_t* initial = Joe_Kuo_Initial_Values;
+    for(std::size_t d = 1; d < m_dimension; d++)
+    {
+        const std::uint32_t poly = Joe_Kuo_Polynomials[d - 1];
+        unsigned degree = 0;
+        while((poly >> (degree + 1)) != 0){degree++;}
+        std::uint32_t* v = &m_base[d*Bits];
+
+        // Initial values m_k, odd and below 2^k, for k = 1..degree, scaled to v_k = m_k * 2^(32-k)
+        for(unsigned k = 0; k < degree; k++)
+        {
+            v[k] = initial[k] << (Bits - 1 - k);
+        }
+        initial += degree;
+
+        // Recurrence of the polynomial x^s + a_1 x^(s-1) + ... + a_(s-1) x + 1: v_k = v_(k-s) ^ (v_(k-s) >> s) ^ a_1 v_(k-1) ^ ... ^ a_(s-1) v_(k-s+1)
+        for(std::size_t k = degree; k < Bits; k++)
+        {
+            std::uint32_t value = v[k - degree] ^ (v[k - degree] >> degree);
+            for(unsigned i = 1; i < degree; i++)
+            {
+                if((poly >> (degree - i)) & 1u){value ^= v[k - i];}
+            }
+            v[k] = value;
+        }
+    }
+}
+
+
+//SCRAMBLING
+
+void SobolSequence::Scramble(const Sobol_Scrambling& scrambling, const std::uint64_t& seed)
+{
+    m_scrambling = scrambling;
+    m_seed = seed;
+    m_directions = m_base;
+    m_shift.assign(m_dimension, 0u);
+
+    if(scrambling != Sobol_Scrambling::None)
+    {
+        std::seed_seq seeds{std::uint32_t(seed), std::uint32_t(seed >> 32)};
+        std::mt19937 generator(seeds);
+        std::uint32_t rows[Bits];
+        for(std::size_t d = 0; d < m_dimension; d++)
+        {
+            if(scrambling == Sobol_Scrambling::Linear_Matrix)
+            {
+                // Row i gives digit i (bit 31-i) of the scrambled numbers: 1 on the diagonal, random coefficients for the more significant digits, 0 elsewhere
+                for(std::size_t i = 0; i < Bits; i++)
+                {
+                    std::uint32_t above = (i == 0) ? 0u : ~((1u << (Bits - i)) - 1u);
+                    rows[i] = (std::uint32_t(generator()) & above) | (1u << (Bits - 1 - i));
+                }
+                for(std::size_t k = 0; k < Bits; k++)
+                {
+                    const std::uint32_t v = m_base[d*Bits + k];
+                    std::uint32_t scrambled = 0u;
+                    for(std::size_t i = 0; i < Bits; i++)
+                    {
+                        scrambled |= Parity(v & rows[i]) << (Bits - 1 - i);
+                    }
+                    m_directions[d*Bits + k] = scrambled;
+                }
+            }
+            m_shift[d] = std::uint32_t(generator());
+        }
+    }
+    Skip_To(1);
+}
+
+
+//GENERATION
+
+void SobolSequence::Skip_To(const std::uint64_t& index)
+{
+    if(index >= (std::uint64_t(1) << Bits)){throw std::invalid_argument("Error: Sobol sequence index beyond 2^32.");}
+    const std::uint64_t gray = index ^ (index >> 1);
+    for(std::size_t d = 0; d < m_dimension; d++)
+    {
+        std::uint32_t value = m_shift[d];
+        for(std::size_t k = 0; k < Bits; k++)
+        {
+            if((gray >> k) & 1u){value ^= m_directions[d*Bits + k];}
+        }
+        m_state[d] = value;
+    }
+    m_index = index;
+}
+
+void SobolSequence::Next(double* point)
+{
+    if(m_index >= (std::uint64_t(1) << Bits)){throw std::invalid_argument("Error: Sobol sequence exhausted after 2^32 points.");}
+    const double scale = 1.0 / 4294967296.0;   // 2^-32
+    for(std::size_t d = 0; d < m_dimension; d++)
+    {
+        point[d] = (double(m_state[d]) + 0.5)*scale;
+    }
+
+    // Gray code of index + 1 differs from that of index in the lowest set bit of index + 1
+    std::uint64_t next = m_index + 1;
+    std::size_t bit = 0;
+    while(((next >> bit) & 1u) == 0 && bit < Bits - 1){bit++;}
+    const std::uint32_t* v = &m_directions[bit];
+    for(std::size_t d = 0; d < m_dimension; d++)
+    {
+        m_state[d] ^= v[d*Bits];
+    }
+    m_index = next;
+}
+
+
+//GETTERS
+
+std::size_t const& SobolSequence::getDimension() const
+{
+    return m_dimension;
+}
+
+std::uint64_t const& SobolSequence::getIndex() const
+{
+    return m_index;
+}
+
+Sobol_Scrambling const& SobolSequence::getScrambling() const
+{
+    return m_scrambling;
+}
+
+std::uint64_t const& SobolSequence::getSeed() const
+{
+    return m_seed;
+}
@@ -0,0 +1,71 @@
+//SobolSequence.hpp
+//
+//Purpose: Sobol low-discrepancy sequence in base 2, for quasi-Monte Carlo path generation. Coordinates are 32-bit fractions generated in Gray-code order, so that
+//         each point is the previous one XOR a single direction number per dimension. Skip_To() jumps to any index directly (XOR of the direction numbers selected
+//         by the Gray code of the index), which is how parallel workers each generate their own contiguous run of points. The direction numbers of each dimension
+//         come from a primitive polynomial over GF(2) and its odd initial values, those of Joe and Kuo (new-joe-kuo-6.21201, in SobolDirectionNumbers.cpp), chosen
+//         for good two-dimensional projections, so that the points are those of the reference sequence, up to 21201 dimensions.
+//         Randomized quasi-Monte Carlo scrambles the sequence from a seed: a random digital shift (XOR of each coordinate with a random fraction), optionally after
+//         Matousek's random linear scrambling, which multiplies the digits of each direction number by a random lower-triangular binary matrix. Linear scrambling
+//         is the affine form of Owen's nested scrambling: it keeps the net structure of the points, and since it is linear, it applies to the direction numbers
+//         once rather than to each point, so scrambled points cost the same as unscrambled ones. Independent scrambles give independent estimates, and so an
+//         error estimate, which a single deterministic sequence does not.
+//
+//Modification date: 10/18/2026
+
+#ifndef SobolSequence_hpp
+#define SobolSequence_hpp
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+enum class Sobol_Scrambling
+{
+    None, Digital_Shift, Linear_Matrix      // Linear_Matrix: random linear scrambling, then a random digital shift
+};
+
+class SobolSequence
+{
+    public:
+        static const std::size_t Bits = 32;         // Bits of each coordinate, and log2 of the number of points before the sequence repeats
+        static const std::size_t Max_Dimension = 21201;     // Dimensions of the Joe and Kuo direction numbers
+
+    private:
+        static const std::uint32_t Joe_Kuo_Polynomials[Max_Dimension - 1];  // Primitive polynomial of each dimension after the first, with its leading and constant terms
+        static const std::uint32_t Joe_Kuo_Initial_Values[];                // Initial values m_1..m_s of each dimension after the first, s the degree of its polynomial
+
+        std::size_t m_dimension;
+        std::vector<std::uint32_t> m_base;          // Bits direction numbers per dimension, dimension after dimension
+        std::vector<std::uint32_t> m_directions;    // Direction numbers used, scrambled or equal to m_base
+        std::vector<std::uint32_t> m_shift;         // Digital shift per dimension, 0 without scrambling
+        Sobol_Scrambling m_scrambling;
+        std::uint64_t m_seed;
+        std::vector<std::uint32_t> m_state;         // Coordinates of the point at m_index, as 32-bit fractions
+        std::uint64_t m_index;                      // Index of the next point returned
+
+        void Build_Directions();
+
+    public:
+    //CONSTRUCTORS AND DESTRUCTOR
+
+        SobolSequence();                                            // Default constructor: dimension 1
+        SobolSequence(const std::size_t& dimension, const Sobol_Scrambling& scrambling = Sobol_Scrambling::None, const std::uint64_t& seed = 0);   // Overloaded constructor: starts at index 1, dimension up to Max_Dimension
+        SobolSequence(const SobolSequence& source);                 // Copy constructor
+        ~SobolSequence();                                           // Destructor
+        SobolSequence& operator = (const SobolSequence& source);    // Assignment operator
+
+    //GENERATION
+
+        void Scramble(const Sobol_Scrambling& scrambling, const std::uint64_t& seed);     // Rescrambles from the seed (None restores the plain sequence), and restarts at index 1
+        void Skip_To(const std::uint64_t& index);       // Next point returned is the one at index (below 2^32)
+        void Next(double* point);                       // Writes the dimension coordinates of the next point, at the centres of their 2^-32 cells so in (0,1)
+
+    //GETTERS
+        std::size_t const& getDimension() const;
+        std::uint64_t const& getIndex() const;
+        Sobol_Scrambling const& getScrambling() const;
+        std::uint64_t const& getSeed() const;
+};
+
+#endif //SobolSequence_hpp
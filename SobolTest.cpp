@@ -0,0 +1,58 @@
+//SobolTest.cpp
+//
+//Purpose: Test of the direction numbers of the Sobol sequence against the reference points of Joe and Kuo's sequence (new-joe-kuo-6.21201), as returned
+//         by scipy.stats.qmc.Sobol without scrambling: points 1 to 8 of the first 8 dimensions. SobolSequence returns the centres of
+//         the 2^-32 cells, so each coordinate must be within 2^-32 of the reference. Points reached by Skip_To() must be the same as those reached by Next().
+//         Returns 0 on success, 1 on failure.
+//
+//         Usage: sobol_test
+//
+//Modification date: 10/18/2026
+
+
+#include "SobolSequence.hpp"
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+
+int main()
+{
+    const std::size_t dimension = 8, points = 8;
+    const double reference[points][dimension] =
+    {
+        {0.5,    0.5,    0.5,    0.5,    0.5,    0.5,    0.5,    0.5   },
+        {0.75,   0.25,   0.25,   0.25,   0.75,   0.75,   0.25,   0.75  },
+        {0.25,   0.75,   0.75,   0.75,   0.25,   0.25,   0.75,   0.25  },
+        {0.375,  0.375,  0.625,  0.875,  0.375,  0.125,  0.375,  0.875 },
+        {0.875,  0.875,  0.125,  0.375,  0.875,  0.625,  0.875,  0.375 },
+        {0.625,  0.125,  0.875,  0.625,  0.625,  0.875,  0.125,  0.125 },
+        {0.125,  0.625,  0.375,  0.125,  0.125,  0.375,  0.625,  0.625 },
+        {0.1875, 0.3125, 0.9375, 0.4375, 0.5625, 0.3125, 0.4375, 0.9375}
+    };
+    const double tolerance = std::ldexp(1.0, -32);
+    bool ok = true;
+
+    SobolSequence sobol(dimension);
+    std::vector<double> point(dimension), skipped(dimension);
+    for(std::size_t i = 0; i < points; i++)
+    {
+        sobol.Next(point.data());
+        SobolSequence other(dimension);
+        other.Skip_To(i + 1);
+        other.Next(skipped.data());
+        for(std::size_t d = 0; d < dimension; d++)
+        {
+            if(std::fabs(point[d] - reference[i][d]) > tolerance || skipped[d] != point[d])
+            {
+                std::cout << "Point " << i + 1 << ", dimension " << d + 1 << ": " << point[d] << " (skipped to: " << skipped[d] << "), expected "
+                          << reference[i][d] << "  <-- FAILED" << std::endl;
+                ok = false;
+            }
+        }
+    }
+
+    std::cout << points << " points of " << dimension << " dimensions against the reference" << std::endl;
+    std::cout << (ok ? "PASSED" : "FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
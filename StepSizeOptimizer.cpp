@@ -0,0 +1,218 @@
+//StepSizeOptimizer.cpp
+//
+//Purpose: Choice of the step h of divided differences for a batch of options. For each option, the error of the divided-difference delta or gamma against the
+//         exact Black-Scholes Greek is minimized over h: truncation error grows with h and rounding error with 1/h, so the error is roughly unimodal in log h.
+//         A coarse scan on a logarithmic grid brackets the minimum, which is then refined by golden-section search in log h. All options of a batch advance in
+//         lockstep (each scan point or golden-section step is one loop over the options), so that the inner loops run across options rather than across h, and
+//         the batch is split into chunks processed in parallel with Parallel_For().
+//
+//Modification date: 10/18/2026
+
+
+#include "StepSizeOptimizer.hpp"
+#include "PricingKernels.hpp"
+#include "Parallel.hpp"
+#include <cmath>        // For log(), exp(), fabs(), std::isfinite()
+#include <limits>
+#include <stdexcept>
+
+
+//Default constructor
+StepSizeOptimizer::StepSizeOptimizer(): m_h_min(1e-6), m_h_max(10.0), m_scan_points(16), m_iterations(30), m_threads(0)
+{
+    //std::cout << "Default constructor in StepSizeOptimizer used." << std::endl;
+}
+
+//Overloaded constructor
+StepSizeOptimizer::StepSizeOptimizer(const double& h_min, const double& h_max, const std::size_t& scan_points, const std::size_t& iterations, const unsigned& threads)
+    : m_h_min(h_min), m_h_max(h_max), m_scan_points(scan_points), m_iterations(iterations), m_threads(threads)
+{
+    if(!(h_min > 0.0 && h_max > h_min)){throw std::invalid_argument("Error: step range must satisfy 0 < h_min < h_max.");}
+    if(scan_points < 3){throw std::invalid_argument("Error: at least 3 scan points are required to bracket the optimal step.");}
+    //std::cout << "Overloaded constructor in StepSizeOptimizer used." << std::endl;
+}
+
+//Copy constructor
+StepSizeOptimizer::StepSizeOptimizer(const StepSizeOptimizer& source): m_h_min(source.m_h_min), m_h_max(source.m_h_max), m_scan_points(source.m_scan_points),
+    m_iterations(source.m_iterations), m_threads(source.m_threads)
+{
+    //std::cout << "Copy constructor in StepSizeOptimizer used." << std::endl;
+}
+
+//Destructor
+StepSizeOptimizer::~StepSizeOptimizer()
+{
+    //std::cout << "Destructor in StepSizeOptimizer used." << std::endl;
+}
+
+//Assignment operator
+StepSizeOptimizer& StepSizeOptimizer::operator = (const StepSizeOptimizer& source)
+{
+    if (this == &source)    // Checking for self-assignment
+    {
+        return *this;
+    }
+    else
+    {
+        m_h_min = source.m_h_min;
+        m_h_max = source.m_h_max;
+        m_scan_points = source.m_scan_points;
+        m_iterations = source.m_iterations;
+        m_threads = source.m_threads;
+        return *this;
+    }
+}
+
+
+//OPTIMIZATION
+
+// Divided difference at step h and its exact counterpart, both from the double kernels
+static double Divided_Difference(const Param_Data& p, const Step_Greek& greek, const double& h)
+{
+    switch(greek)
+    {
+        case (Step_Greek::Delta_Call):  return DividedDiff_Kernel<double>::Delta_Call(p.m_S, p.m_K, p.m_T, p.m_R, p.m_Sig, p.m_B, h);
+        case (Step_Greek::Delta_Put):   return DividedDiff_Kernel<double>::Delta_Put(p.m_S, p.m_K, p.m_T, p.m_R, p.m_Sig, p.m_B, h);
+        default:                        return DividedDiff_Kernel<double>::Gamma(p.m_S, p.m_K, p.m_T, p.m_R, p.m_Sig, p.m_B, h);
+    }
+}
+
+static double Exact_Greek(const Param_Data& p, const Step_Greek& greek)
+{
+    switch(greek)
+    {
+        case (Step_Greek::Delta_Call):  return BS_Kernel<double>::Call_Delta(p.m_S, p.m_K, p.m_T, p.m_R, p.m_Sig, p.m_B);
+        case (Step_Greek::Delta_Put):   return BS_Kernel<double>::Put_Delta(p.m_S, p.m_K, p.m_T, p.m_R, p.m_Sig, p.m_B);
+        default:                        return BS_Kernel<double>::Gamma(p.m_S, p.m_K, p.m_T, p.m_R, p.m_Sig, p.m_B);
+    }
+}
+
+// Error against a precomputed exact Greek, +infinity when the divided difference is not finite so that such steps are never retained
+static double Error_Against(const Param_Data& p, const Step_Greek& greek, const double& h, const double& exact)
+{
+    double error = std::fabs(Divided_Difference(p, greek, h) - exact);
+    return std::isfinite(error) ? error : std::numeric_limits<double>::infinity();
+}
+
+double StepSizeOptimizer::Error(const Param_Data& option, const Step_Greek& greek, const double& h)
+{
+    return Error_Against(option, greek, h, Exact_Greek(option, greek));
+}
+
+std::vector<Step_Size_Result> StepSizeOptimizer::Optimize(const std::vector<Param_Data>& options, const Step_Greek& greek) const
+{
+    std::vector<Step_Size_Result> results;
+    Optimize(options, greek, results);
+    return results;
+}
+
+void StepSizeOptimizer::Optimize(const std::vector<Param_Data>& options, const Step_Greek& greek, std::vector<Step_Size_Result>& results) const
+{
+    results.resize(options.size());
+    const double golden = 0.5*(std::sqrt(5.0) - 1.0);   // 0.618...
+    const double log_h_min = std::log(m_h_min);
+
+    Parallel_For(options.size(), [&](std::size_t begin, std::size_t end, std::size_t)
+    {
+        // State of the chunk, one column per quantity: bracket [a, b] in log h, golden-section points x1 < x2 and their errors, best point so far
+        const std::size_t n = end - begin;
+        std::vector<double> exact(n), low(n), step(n), a(n), b(n), x1(n), x2(n), f1(n), f2(n), best_x(n), best_f(n), trial(n);
+        std::vector<std::size_t> best_k(n);
+        std::vector<unsigned char> left(n);
+
+        for(std::size_t i = 0; i < n; i++)
+        {
+            const Param_Data& p = options[begin + i];
+            exact[i] = Exact_Greek(p, greek);
+            double log_h_max = std::log(std::fmin(m_h_max, 0.5*p.m_S));
+            low[i] = log_h_min;
+            step[i] = (log_h_max > log_h_min) ? (log_h_max - log_h_min) / double(m_scan_points - 1) : 0.0;
+            best_f[i] = std::numeric_limits<double>::infinity();
+            best_x[i] = log_h_min;
+            best_k[i] = 0;
+        }
+
+        // Coarse scan: one pass over the options per grid point
+        for(std::size_t k = 0; k < m_scan_points; k++)
+        {
+            for(std::size_t i = 0; i < n; i++)
+            {
+                double x = low[i] + double(k)*step[i];
+                double f = Error_Against(options[begin + i], greek, std::exp(x), exact[i]);
+                bool better = f < best_f[i];
+                best_f[i] = better ? f : best_f[i];
+                best_x[i] = better ? x : best_x[i];
+                best_k[i] = better ? k : best_k[i];
+            }
+        }
+
+        // Bracket around the best grid point, and the two interior golden-section points
+        for(std::size_t i = 0; i < n; i++)
+        {
+            a[i] = low[i] + double((best_k[i] > 0) ? best_k[i] - 1 : 0)*step[i];
+            b[i] = low[i] + double((best_k[i] + 1 < m_scan_points) ? best_k[i] + 1 : m_scan_points - 1)*step[i];
+            x1[i] = b[i] - golden*(b[i] - a[i]);
+            x2[i] = a[i] + golden*(b[i] - a[i]);
+        }
+        for(std::size_t i = 0; i < n; i++)
+        {
+            f1[i] = Error_Against(options[begin + i], greek, std::exp(x1[i]), exact[i]);
+            f2[i] = Error_Against(options[begin + i], greek, std::exp(x2[i]), exact[i]);
+        }
+
+        // Golden-section steps in lockstep: the bracket of each option keeps the lower of its two interior points, and one new point is evaluated per option
+        for(std::size_t iteration = 0; iteration < m_iterations; iteration++)
+        {
+            for(std::size_t i = 0; i < n; i++)
+            {
+                left[i] = f1[i] <= f2[i];       // Minimum in [a, x2]: new point left of x1; otherwise minimum in [x1, b]: new point right of x2
+                b[i] = left[i] ? x2[i] : b[i];
+                a[i] = left[i] ? a[i] : x1[i];
+                trial[i] = left[i] ? b[i] - golden*(b[i] - a[i]) : a[i] + golden*(b[i] - a[i]);
+            }
+            for(std::size_t i = 0; i < n; i++)
+            {
+                double f = Error_Against(options[begin + i], greek, std::exp(trial[i]), exact[i]);
+                if(left[i]) {x2[i] = x1[i]; f2[i] = f1[i]; x1[i] = trial[i]; f1[i] = f;}
+                else        {x1[i] = x2[i]; f1[i] = f2[i]; x2[i] = trial[i]; f2[i] = f;}
+            }
+        }
+
+        for(std::size_t i = 0; i < n; i++)
+        {
+            double x = best_x[i], f = best_f[i];
+            if(f1[i] < f){x = x1[i]; f = f1[i];}
+            if(f2[i] < f){x = x2[i]; f = f2[i];}
+            results[begin + i].m_h = std::exp(x);
+            results[begin + i].m_error = f;
+        }
+    }, m_threads, 64);
+}
+
+
+//GETTERS
+
+double const& StepSizeOptimizer::getHMin() const
+{
+    return m_h_min;
+}
+
+double const& StepSizeOptimizer::getHMax() const
+{
+    return m_h_max;
+}
+
+std::size_t const& StepSizeOptimizer::getScanPoints() const
+{
+    return m_scan_points;
+}
+
+std::size_t const& StepSizeOptimizer::getIterations() const
+{
+    return m_iterations;
+}
+
+unsigned const& StepSizeOptimizer::getThreads() const
+{
+    return m_threads;
+}
@@ -0,0 +1,64 @@
+//StepSizeOptimizer.hpp
+//
+//Purpose: Choice of the step h of divided differences for a batch of options. For each option, the error of the divided-difference delta or gamma against the
+//         exact Black-Scholes Greek is minimized over h: truncation error grows with h and rounding error with 1/h, so the error is roughly unimodal in log h.
+//         A coarse scan on a logarithmic grid brackets the minimum, which is then refined by golden-section search in log h. All options of a batch advance in
+//         lockstep (each scan point or golden-section step is one loop over the options), so that the inner loops run across options rather than across h, and
+//         the batch is split into chunks processed in parallel with Parallel_For().
+//
+//Modification date: 10/18/2026
+
+#ifndef StepSizeOptimizer_hpp
+#define StepSizeOptimizer_hpp
+
+#include "OptionData.hpp"
+#include <vector>
+#include <cstddef>
+
+// Divided-difference Greek whose step is optimized
+enum class Step_Greek
+{
+    Delta_Call, Delta_Put, Gamma
+};
+
+// Optimal step of an option, and the absolute error of the divided difference against the exact Greek at that step
+struct Step_Size_Result
+{
+    double m_h;
+    double m_error;
+};
+
+class StepSizeOptimizer
+{
+    private:
+        double m_h_min;             // Smallest step searched
+        double m_h_max;             // Largest step searched, further capped at S/2 for each option so that S-h stays positive
+        std::size_t m_scan_points;  // Points of the coarse logarithmic scan, at least 3
+        std::size_t m_iterations;   // Golden-section iterations after the scan, each shrinking the bracket by 0.618
+        unsigned m_threads;         // Number of threads, 0 for the number of hardware threads
+
+    public:
+    //CONSTRUCTORS AND DESTRUCTOR
+
+        StepSizeOptimizer();                                            // Default constructor: h in [1e-6, 10], 16 scan points, 30 iterations, all hardware threads
+        StepSizeOptimizer(const double& h_min, const double& h_max, const std::size_t& scan_points, const std::size_t& iterations, const unsigned& threads);  // Overloaded constructor
+        StepSizeOptimizer(const StepSizeOptimizer& source);             // Copy constructor
+        ~StepSizeOptimizer();                                           // Destructor
+        StepSizeOptimizer& operator = (const StepSizeOptimizer& source);    // Assignment operator
+
+    //OPTIMIZATION
+
+        static double Error(const Param_Data& option, const Step_Greek& greek, const double& h);   // |divided difference - exact Greek| at step h (m_h is ignored), +infinity if not finite
+
+        std::vector<Step_Size_Result> Optimize(const std::vector<Param_Data>& options, const Step_Greek& greek) const;     // Optimal step of each option, in the order of the batch
+        void Optimize(const std::vector<Param_Data>& options, const Step_Greek& greek, std::vector<Step_Size_Result>& results) const;  // Same, reusing the buffer provided
+
+    //GETTERS
+        double const& getHMin() const;
+        double const& getHMax() const;
+        std::size_t const& getScanPoints() const;
+        std::size_t const& getIterations() const;
+        unsigned const& getThreads() const;
+};
+
+#endif //StepSizeOptimizer_hpp
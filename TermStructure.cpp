@@ -0,0 +1,218 @@
+//TermStructure.cpp
+//
+//Purpose: Term structures for the interest rate R and the cost of carry B. A curve is defined by its discount factors at pillar times, and interpolated log-linearly
+//         in discount factors, which amounts to piecewise-flat forward rates. DiscountCache evaluates the curves once per distinct expiry of a batch of options, so that
+//         pricing kernels consume precomputed discount factors rather than computing exp(-R*T) for each option.
+//
+//Modification date: 10/18/2026
+
+
+#include "TermStructure.hpp"
+#include <algorithm>    // For std::sort, std::unique, std::lower_bound, std::upper_bound
+#include <cmath>        // For exp() and sqrt()
+
+
+//Default constructor
+TermStructure::TermStructure(): m_times(1, 1.0), m_logDF(1, -0.08)
+{
+    //std::cout << "Default constructor in TermStructure used." << std::endl;
+}
+
+//Flat curve
+TermStructure::TermStructure(const double& flat_rate): m_times(1, 1.0), m_logDF(1, -flat_rate)
+{
+    //std::cout << "Overloaded constructor in TermStructure used." << std::endl;
+}
+
+//Curve from zero rates at pillar times
+TermStructure::TermStructure(const std::vector<double>& times, const std::vector<double>& zero_rates): m_times(times), m_logDF(times.size())
+{
+    if(times.empty() || times.size() != zero_rates.size())
+    {
+        throw std::invalid_argument("Error: Pillar times and zero rates of the term structure are not of the same size.");
+    }
+
+    for(std::size_t i = 0; i < m_times.size(); i++)
+    {
+        if(m_times[i] <= 0.0 || (i > 0 && m_times[i] <= m_times[i-1]))
+        {
+            throw std::invalid_argument("Error: Pillar times of the term structure must be positive and strictly increasing.");
+        }
+        m_logDF[i] = -zero_rates[i] * m_times[i];   // ln(DF) = -R*T
+    }
+}
+
+//Copy constructor
+TermStructure::TermStructure(const TermStructure& source): m_times(source.m_times), m_logDF(source.m_logDF)
+{
+    //std::cout << "Copy constructor in TermStructure used." << std::endl;
+}
+
+//Destructor
+TermStructure::~TermStructure()
+{
+    //std::cout << "Destructor in TermStructure used." << std::endl;
+}
+
+//Assignment operator
+TermStructure& TermStructure::operator = (const TermStructure& source)
+{
+    if (this == &source)    // Checking for self-assignment
+    {
+        return *this;
+    }
+    else
+    {
+        m_times = source.m_times;
+        m_logDF = source.m_logDF;
+        return *this;
+    }
+}
+
+
+//CURVE FUNCTIONS
+
+double TermStructure::DF(const double& T) const
+{
+    const std::size_t n = m_times.size();
+
+    if(T <= m_times[0])     // Before the first pillar, the forward rate is flat at the first zero rate
+    {
+        return exp(m_logDF[0] * T / m_times[0]);
+    }
+    if(T >= m_times[n-1])   // After the last pillar, the last forward rate is extrapolated
+    {
+        double last_forward = (n > 1) ? (m_logDF[n-2] - m_logDF[n-1]) / (m_times[n-1] - m_times[n-2]) : -m_logDF[0] / m_times[0];
+        return exp(m_logDF[n-1] - last_forward * (T - m_times[n-1]));
+    }
+
+    // Log-linear interpolation between the bracketing pillars, i.e. flat forward rate over the interval
+    std::size_t i = static_cast<std::size_t>(std::upper_bound(m_times.begin(), m_times.end(), T) - m_times.begin()) - 1;
+    double w = (T - m_times[i]) / (m_times[i+1] - m_times[i]);
+    return exp((1.0 - w) * m_logDF[i] + w * m_logDF[i+1]);
+}
+
+double TermStructure::Rate(const double& T) const
+{
+    if(T <= 0.0){return -m_logDF[0] / m_times[0];}  // Short rate limit
+    return -log(DF(T)) / T;
+}
+
+double TermStructure::Forward_Rate(const double& T1, const double& T2) const
+{
+    if(T2 <= T1){throw std::invalid_argument("Error: Forward rate requires T1 < T2.");}
+    return log(DF(T1) / DF(T2)) / (T2 - T1);
+}
+
+std::vector<double> TermStructure::DF(const std::vector<double>& T) const
+{
+    std::vector<double> results(T.size());
+    for(std::size_t i = 0; i < T.size(); i++)
+    {
+        results[i] = DF(T[i]);
+    }
+    return results;
+}
+
+
+//GETTERS
+
+std::vector<double> const& TermStructure::getTimes() const
+{
+    return m_times;
+}
+
+
+
+//DISCOUNT CACHE
+
+//Default constructor
+DiscountCache::DiscountCache()
+{
+    //std::cout << "Default constructor in DiscountCache used." << std::endl;
+}
+
+//Caching the rate and carry curves at the distinct expiries of the batch
+DiscountCache::DiscountCache(const std::vector<double>& T, const TermStructure& rate_curve, const TermStructure& carry_curve): m_expiries(T), m_index(T.size())
+{
+    // Distinct expiries: thousands of options usually share a handful of them
+    std::sort(m_expiries.begin(), m_expiries.end());
+    m_expiries.erase(std::unique(m_expiries.begin(), m_expiries.end()), m_expiries.end());
+
+    m_DF_R.resize(m_expiries.size());
+    m_DF_B.resize(m_expiries.size());
+    m_sqrtT.resize(m_expiries.size());
+
+    for(std::size_t e = 0; e < m_expiries.size(); e++)  // Only one evaluation of each curve per distinct expiry
+    {
+        m_DF_R[e] = rate_curve.DF(m_expiries[e]);
+        m_DF_B[e] = carry_curve.DF(m_expiries[e]);
+        m_sqrtT[e] = sqrt(m_expiries[e]);
+    }
+
+    for(std::size_t i = 0; i < T.size(); i++)   // Mapping each option of the batch to its distinct expiry
+    {
+        m_index[i] = static_cast<std::size_t>(std::lower_bound(m_expiries.begin(), m_expiries.end(), T[i]) - m_expiries.begin());
+    }
+}
+
+//Copy constructor
+DiscountCache::DiscountCache(const DiscountCache& source): m_expiries(source.m_expiries), m_DF_R(source.m_DF_R), m_DF_B(source.m_DF_B), m_sqrtT(source.m_sqrtT),
+m_index(source.m_index)
+{
+    //std::cout << "Copy constructor in DiscountCache used." << std::endl;
+}
+
+//Destructor
+DiscountCache::~DiscountCache()
+{
+    //std::cout << "Destructor in DiscountCache used." << std::endl;
+}
+
+//Assignment operator
+DiscountCache& DiscountCache::operator = (const DiscountCache& source)
+{
+    if (this == &source)    // Checking for self-assignment
+    {
+        return *this;
+    }
+    else
+    {
+        m_expiries = source.m_expiries;
+        m_DF_R = source.m_DF_R;
+        m_DF_B = source.m_DF_B;
+        m_sqrtT = source.m_sqrtT;
+        m_index = source.m_index;
+        return *this;
+    }
+}
+
+std::vector<double> const& DiscountCache::getExpiries() const
+{
+    return m_expiries;
+}
+
+std::vector<double> const& DiscountCache::getDF_R() const
+{
+    return m_DF_R;
+}
+
+std::vector<double> const& DiscountCache::getDF_B() const
+{
+    return m_DF_B;
+}
+
+std::vector<double> const& DiscountCache::getSqrtT() const
+{
+    return m_sqrtT;
+}
+
+std::vector<std::size_t> const& DiscountCache::getIndex() const
+{
+    return m_index;
+}
+
+std::size_t DiscountCache::size() const
+{
+    return m_index.size();
+}
@@ -0,0 +1,71 @@
+//TermStructure.hpp
+//
+//Purpose: Term structures for the interest rate R and the cost of carry B. A curve is defined by its discount factors at pillar times, and interpolated log-linearly
+//         in discount factors, which amounts to piecewise-flat forward rates. DiscountCache evaluates the curves once per distinct expiry of a batch of options, so that
+//         pricing kernels consume precomputed discount factors rather than computing exp(-R*T) for each option.
+//
+//Modification date: 10/18/2026
+
+#ifndef TermStructure_hpp
+#define TermStructure_hpp
+
+#include <vector>
+#include <cstddef>
+#include <stdexcept>
+
+class TermStructure
+{
+    private:
+        std::vector<double> m_times;        // Pillar times, strictly increasing and positive
+        std::vector<double> m_logDF;        // Log of the discount factors at the pillar times
+
+    public:
+    //CONSTRUCTORS AND DESTRUCTOR
+
+        TermStructure();                                    // Default constructor: flat curve at 8%, as for the Batch 1 default values
+        TermStructure(const double& flat_rate);             // Flat curve, with a continuously compounded rate
+        TermStructure(const std::vector<double>& times, const std::vector<double>& zero_rates);    // Curve from continuously compounded zero rates at pillar times
+        TermStructure(const TermStructure& source);         // Copy constructor
+        ~TermStructure();                                   // Destructor
+        TermStructure& operator = (const TermStructure& source);    // Assignment operator
+
+    //CURVE FUNCTIONS
+
+        double DF(const double& T) const;                   // Discount factor exp(-integral of forward rates from 0 to T)
+        double Rate(const double& T) const;                 // Continuously compounded zero rate, -ln(DF(T))/T
+        double Forward_Rate(const double& T1, const double& T2) const;     // Continuously compounded forward rate between T1 and T2
+        std::vector<double> DF(const std::vector<double>& T) const;       // Discount factors for a vector of times
+
+    //GETTERS
+        std::vector<double> const& getTimes() const;        // Pillar times
+};
+
+
+class DiscountCache
+{
+    private:
+        std::vector<double> m_expiries;         // Distinct expiries of the batch, sorted
+        std::vector<double> m_DF_R;             // Discount factors of the rate curve at each distinct expiry
+        std::vector<double> m_DF_B;             // Discount factors of the carry curve at each distinct expiry, exp(-B*T) for a flat carry
+        std::vector<double> m_sqrtT;            // sqrt(T) at each distinct expiry
+        std::vector<std::size_t> m_index;       // For each option of the batch, position of its expiry among the distinct expiries
+
+    public:
+    //CONSTRUCTORS AND DESTRUCTOR
+
+        DiscountCache();                        // Default constructor: empty batch
+        DiscountCache(const std::vector<double>& T, const TermStructure& rate_curve, const TermStructure& carry_curve); // Caching the curves at the distinct expiries of the batch
+        DiscountCache(const DiscountCache& source);     // Copy constructor
+        ~DiscountCache();                       // Destructor
+        DiscountCache& operator = (const DiscountCache& source);    // Assignment operator
+
+    //GETTERS
+        std::vector<double> const& getExpiries() const;     // Distinct expiries
+        std::vector<double> const& getDF_R() const;         // Rate discount factors at the distinct expiries
+        std::vector<double> const& getDF_B() const;         // Carry discount factors at the distinct expiries
+        std::vector<double> const& getSqrtT() const;        // sqrt(T) at the distinct expiries
+        std::vector<std::size_t> const& getIndex() const;   // Position of the expiry of each option among the distinct expiries
+        std::size_t size() const;                           // Number of options in the batch
+};
+
+#endif //TermStructure_hpp
@@ -0,0 +1,278 @@
+//VolSurface.cpp
+//
+//Purpose: Volatility surface on a strike/expiry grid. The vols are stored contiguously (one row per expiry slice), and each slice caches its natural cubic spline
+//         coefficients in strike, so that lookups only require locating the bracketing nodes (O(1) on a uniform strike axis, binary search otherwise). Between expiries,
+//         we interpolate linearly in total variance (Sig^2 * T). Changing one expiry slice only rebuilds the spline of that slice.
+//
+//Modification date: 10/18/2026
+
+
+#include "VolSurface.hpp"
+#include <algorithm>    // For std::upper_bound
+#include <cmath>        // For sqrt() and fabs()
+
+
+//Default constructor
+VolSurface::VolSurface(): m_strikes(1, 65.0), m_expiries(1, 0.25), m_vols(1, 0.30), m_spline(1, 0.0), m_uniform_strikes(false), m_strike_step(0.0)
+{
+    //std::cout << "Default constructor in VolSurface used." << std::endl;
+}
+
+//Overloaded constructor
+VolSurface::VolSurface(const std::vector<double>& strikes, const std::vector<double>& expiries, const std::vector<double>& vols)
+: m_strikes(strikes), m_expiries(expiries), m_vols(vols), m_spline(vols.size(), 0.0), m_uniform_strikes(false), m_strike_step(0.0)
+{
+    Check_Grid();   // Throws if the axes are not sorted, or if the grid is not of the appropriate size
+
+    // Detecting a uniform strike axis (the usual case for grids generated with Mesh_Generate()), so that Strike_Index() does not need to search
+    if(m_strikes.size() > 1)
+    {
+        m_strike_step = m_strikes[1] - m_strikes[0];
+        m_uniform_strikes = true;
+        for(std::size_t j = 1; j < m_strikes.size(); j++)
+        {
+            if(std::fabs((m_strikes[j] - m_strikes[j-1]) - m_strike_step) > 1e-12 * std::fabs(m_strike_step))
+            {
+                m_uniform_strikes = false;
+                break;
+            }
+        }
+    }
+
+    for(std::size_t i = 0; i < m_expiries.size(); i++)  // Building the cached spline coefficients for every slice
+    {
+        Build_Slice(i);
+    }
+}
+
+//Copy constructor
+VolSurface::VolSurface(const VolSurface& source): m_strikes(source.m_strikes), m_expiries(source.m_expiries), m_vols(source.m_vols), m_spline(source.m_spline),
+m_uniform_strikes(source.m_uniform_strikes), m_strike_step(source.m_strike_step)
+{
+    //std::cout << "Copy constructor in VolSurface used." << std::endl;
+}
+
+//Destructor
+VolSurface::~VolSurface()
+{
+    //std::cout << "Destructor in VolSurface used." << std::endl;
+}
+
+//Assignment operator
+VolSurface& VolSurface::operator = (const VolSurface& source)
+{
+    if (this == &source)    // Checking for self-assignment
+    {
+        return *this;
+    }
+    else
+    {
+        m_strikes = source.m_strikes;
+        m_expiries = source.m_expiries;
+        m_vols = source.m_vols;
+        m_spline = source.m_spline;         // Cached coefficients are copied as well, there is no need to rebuild them
+        m_uniform_strikes = source.m_uniform_strikes;
+        m_strike_step = source.m_strike_step;
+        return *this;
+    }
+}
+
+
+//PRIVATE FUNCTIONS
+
+void VolSurface::Check_Grid() const
+{
+    if(m_strikes.empty() || m_expiries.empty() || m_vols.size() != m_strikes.size() * m_expiries.size())
+    {
+        throw std::invalid_argument("Error: Grid of vols does not match the strike and expiry axes of the volatility surface.");
+    }
+
+    for(std::size_t j = 1; j < m_strikes.size(); j++)
+    {
+        if(m_strikes[j] <= m_strikes[j-1]){throw std::invalid_argument("Error: Strikes of the volatility surface must be strictly increasing.");}
+    }
+
+    for(std::size_t i = 1; i < m_expiries.size(); i++)
+    {
+        if(m_expiries[i] <= m_expiries[i-1]){throw std::invalid_argument("Error: Expiries of the volatility surface must be strictly increasing.");}
+    }
+}
+
+//Natural cubic spline in strike for one expiry slice: solving the tridiagonal system for the second derivatives, with zero second derivatives at both ends
+void VolSurface::Build_Slice(const std::size_t& expiry_index)
+{
+    const std::size_t n = m_strikes.size();
+    const double* x = m_strikes.data();
+    const double* y = m_vols.data() + expiry_index * n;     // Slice at hand in the contiguous grid
+    double* y2 = m_spline.data() + expiry_index * n;
+
+    y2[0] = 0.0;
+    if(n < 3)   // With one or two strikes, the natural spline is constant or linear
+    {
+        for(std::size_t j = 0; j < n; j++){y2[j] = 0.0;}
+        return;
+    }
+
+    std::vector<double> u(n, 0.0);  // Temporary storage for the decomposition
+    for(std::size_t j = 1; j < n - 1; j++)
+    {
+        double sig = (x[j] - x[j-1]) / (x[j+1] - x[j-1]);
+        double p = sig * y2[j-1] + 2.0;
+        y2[j] = (sig - 1.0) / p;
+        u[j] = (y[j+1] - y[j]) / (x[j+1] - x[j]) - (y[j] - y[j-1]) / (x[j] - x[j-1]);
+        u[j] = (6.0 * u[j] / (x[j+1] - x[j-1]) - sig * u[j-1]) / p;
+    }
+
+    y2[n-1] = 0.0;
+    for(std::size_t j = n - 1; j-- > 0; )   // Back-substitution
+    {
+        y2[j] = y2[j] * y2[j+1] + u[j];
+    }
+}
+
+std::size_t VolSurface::Strike_Index(const double& K) const
+{
+    const std::size_t n = m_strikes.size();
+    if(n < 2 || K <= m_strikes[0]){return 0;}
+    if(K >= m_strikes[n-1]){return n - 2;}
+
+    if(m_uniform_strikes)   // O(1) on a uniform axis
+    {
+        std::size_t j = static_cast<std::size_t>((K - m_strikes[0]) / m_strike_step);
+        return (j > n - 2) ? n - 2 : j;
+    }
+
+    // Binary search otherwise
+    return static_cast<std::size_t>(std::upper_bound(m_strikes.begin(), m_strikes.end(), K) - m_strikes.begin()) - 1;
+}
+
+std::size_t VolSurface::Expiry_Index(const double& T) const
+{
+    const std::size_t n = m_expiries.size();
+    if(n < 2 || T <= m_expiries[0]){return 0;}
+    if(T >= m_expiries[n-1]){return n - 2;}
+    return static_cast<std::size_t>(std::upper_bound(m_expiries.begin(), m_expiries.end(), T) - m_expiries.begin()) - 1;
+}
+
+double VolSurface::Slice_Vol(const std::size_t& expiry_index, const double& K, const std::size_t& strike_index) const
+{
+    const std::size_t n = m_strikes.size();
+    const double* y = m_vols.data() + expiry_index * n;
+    if(n == 1){return y[0];}
+
+    const double* y2 = m_spline.data() + expiry_index * n;
+
+    // Flat extrapolation outside of the strike axis
+    if(K <= m_strikes[0]){return y[0];}
+    if(K >= m_strikes[n-1]){return y[n-1];}
+
+    const std::size_t j = strike_index;
+    double h = m_strikes[j+1] - m_strikes[j];
+    double a = (m_strikes[j+1] - K) / h;
+    double b = (K - m_strikes[j]) / h;
+
+    return a * y[j] + b * y[j+1] + ((a*a*a - a) * y2[j] + (b*b*b - b) * y2[j+1]) * (h*h) / 6.0;
+}
+
+double VolSurface::Interpolate(const double& K, const double& T, std::size_t& expiry_hint) const
+{
+    const std::size_t n = m_expiries.size();
+    const std::size_t j = Strike_Index(K);
+
+    if(n == 1 || T <= m_expiries[0]){return Slice_Vol(0, K, j);}      // Flat extrapolation before the first expiry
+    if(T >= m_expiries[n-1]){return Slice_Vol(n-1, K, j);}            // Flat extrapolation after the last expiry
+
+    // Batches are usually sorted or clustered by expiry, so we first check whether the previous bracket still holds before searching
+    if(!(expiry_hint < n - 1 && m_expiries[expiry_hint] <= T && T < m_expiries[expiry_hint+1]))
+    {
+        expiry_hint = Expiry_Index(T);
+    }
+
+    const std::size_t i = expiry_hint;
+    double T1 = m_expiries[i], T2 = m_expiries[i+1];
+    double vol1 = Slice_Vol(i, K, j), vol2 = Slice_Vol(i+1, K, j);
+
+    // Linear interpolation in total variance
+    double w = ((T2 - T) * vol1 * vol1 * T1 + (T - T1) * vol2 * vol2 * T2) / (T2 - T1);
+    return std::sqrt(w / T);
+}
+
+
+//LOOKUPS
+
+double VolSurface::Vol(const double& K, const double& T) const
+{
+    std::size_t expiry_hint = 0;
+    return Interpolate(K, T, expiry_hint);
+}
+
+std::vector<double> VolSurface::Vol(const std::vector<double>& K, const std::vector<double>& T) const
+{
+    if(K.size() != T.size()){throw std::invalid_argument("Error: Vectors of strikes and expiries are not of the same size.");}
+
+    std::vector<double> results(K.size());
+    Vol_Batch(K.data(), T.data(), results.data(), K.size());
+    return results;
+}
+
+void VolSurface::Vol_Batch(const double* K, const double* T, double* results, const std::size_t& size) const
+{
+    std::size_t expiry_hint = 0;    // Shared across the batch, so that options of the same expiry do not search again
+    for(std::size_t i = 0; i < size; i++)
+    {
+        results[i] = Interpolate(K[i], T[i], expiry_hint);
+    }
+}
+
+
+//UPDATES
+
+void VolSurface::setSlice(const std::size_t& expiry_index, const std::vector<double>& slice_vols)
+{
+    if(expiry_index >= m_expiries.size() || slice_vols.size() != m_strikes.size())
+    {
+        throw std::invalid_argument("Error: Slice of vols does not match the volatility surface.");
+    }
+
+    std::copy(slice_vols.begin(), slice_vols.end(), m_vols.begin() + expiry_index * m_strikes.size());
+    Build_Slice(expiry_index);  // Only the slice at hand needs new spline coefficients
+}
+
+void VolSurface::setVol(const std::size_t& expiry_index, const std::size_t& strike_index, const double& newVol)
+{
+    if(expiry_index >= m_expiries.size() || strike_index >= m_strikes.size())
+    {
+        throw std::invalid_argument("Error: Node out of the range of the volatility surface.");
+    }
+
+    m_vols[expiry_index * m_strikes.size() + strike_index] = newVol;
+    Build_Slice(expiry_index);
+}
+
+
+//GETTERS
+
+std::vector<double> const& VolSurface::getStrikes() const
+{
+    return m_strikes;
+}
+
+std::vector<double> const& VolSurface::getExpiries() const
+{
+    return m_expiries;
+}
+
+std::vector<double> const& VolSurface::getVols() const
+{
+    return m_vols;
+}
+
+std::size_t VolSurface::size_strikes() const
+{
+    return m_strikes.size();
+}
+
+std::size_t VolSurface::size_expiries() const
+{
+    return m_expiries.size();
+}
@@ -0,0 +1,61 @@
+//VolSurface.hpp
+//
+//Purpose: Volatility surface on a strike/expiry grid. The vols are stored contiguously (one row per expiry slice), and each slice caches its natural cubic spline
+//         coefficients in strike, so that lookups only require locating the bracketing nodes (O(1) on a uniform strike axis, binary search otherwise). Between expiries,
+//         we interpolate linearly in total variance (Sig^2 * T). Changing one expiry slice only rebuilds the spline of that slice.
+//
+//Modification date: 10/18/2026
+
+#ifndef VolSurface_hpp
+#define VolSurface_hpp
+
+#include <vector>
+#include <cstddef>
+#include <stdexcept>
+
+class VolSurface
+{
+    private:
+        std::vector<double> m_strikes;      // Strike axis, strictly increasing and shared by every expiry slice
+        std::vector<double> m_expiries;     // Expiry axis, strictly increasing
+        std::vector<double> m_vols;         // Contiguous grid of vols, row-major: m_vols[i * number of strikes + j] is the vol at expiry i and strike j
+        std::vector<double> m_spline;       // Cached second derivatives of the natural cubic spline of each expiry slice, same layout as m_vols
+        bool m_uniform_strikes;             // True if the strike axis is uniform, in which case the strike index is found in O(1)
+        double m_strike_step;               // Strike step when the strike axis is uniform
+
+        void Check_Grid() const;                                    // Checks the axes are sorted and that the grid of vols is of the appropriate size
+        void Build_Slice(const std::size_t& expiry_index);          // Rebuilds the cached spline coefficients of one expiry slice only
+        std::size_t Strike_Index(const double& K) const;            // Index j such that m_strikes[j] <= K < m_strikes[j+1]
+        std::size_t Expiry_Index(const double& T) const;            // Index i such that m_expiries[i] <= T < m_expiries[i+1]
+        double Slice_Vol(const std::size_t& expiry_index, const double& K, const std::size_t& strike_index) const;    // Spline evaluation within one expiry slice
+        double Interpolate(const double& K, const double& T, std::size_t& expiry_hint) const;   // Surface lookup, reusing the bracketing expiry of the previous lookup when possible
+
+    public:
+    //CONSTRUCTORS AND DESTRUCTOR
+
+        VolSurface();                                   // Default constructor: flat surface at 30% volatility, as for the Batch 1 default values
+        VolSurface(const std::vector<double>& strikes, const std::vector<double>& expiries, const std::vector<double>& vols);  // Overloaded constructor, vols given row-major (one row per expiry)
+        VolSurface(const VolSurface& source);           // Copy constructor
+        ~VolSurface();                                  // Destructor
+        VolSurface& operator = (const VolSurface& source);  // Assignment operator
+
+    //LOOKUPS
+
+        double Vol(const double& K, const double& T) const;     // Interpolated volatility for strike K and expiry T
+        std::vector<double> Vol(const std::vector<double>& K, const std::vector<double>& T) const;  // Batch lookup, for vectors of strikes and expiries of the same size
+        void Vol_Batch(const double* K, const double* T, double* results, const std::size_t& size) const;   // Batch lookup writing into a caller-provided buffer
+
+    //UPDATES
+
+        void setSlice(const std::size_t& expiry_index, const std::vector<double>& slice_vols);  // Replaces the vols of one expiry slice, and only rebuilds that slice
+        void setVol(const std::size_t& expiry_index, const std::size_t& strike_index, const double& newVol);   // Replaces a single node, and rebuilds its slice
+
+    //GETTERS
+        std::vector<double> const& getStrikes() const;      // Strike axis
+        std::vector<double> const& getExpiries() const;     // Expiry axis
+        std::vector<double> const& getVols() const;         // Contiguous grid of vols
+        std::size_t size_strikes() const;                   // Number of strikes
+        std::size_t size_expiries() const;                  // Number of expiries
+};
+
+#endif //VolSurface_hpp